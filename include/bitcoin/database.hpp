@@ -65,10 +65,12 @@
 #include <bitcoin/database/tables/archives/output.hpp>
 #include <bitcoin/database/tables/archives/outs.hpp>
 #include <bitcoin/database/tables/archives/point.hpp>
+#include <bitcoin/database/tables/archives/spend.hpp>
 #include <bitcoin/database/tables/archives/transaction.hpp>
 #include <bitcoin/database/tables/archives/txs.hpp>
 #include <bitcoin/database/tables/caches/duplicate.hpp>
 #include <bitcoin/database/tables/caches/ecdsa.hpp>
+#include <bitcoin/database/tables/caches/fee_tx.hpp>
 #include <bitcoin/database/tables/caches/prevalid.hpp>
 #include <bitcoin/database/tables/caches/prevout.hpp>
 #include <bitcoin/database/tables/caches/schnorr.hpp>
@@ -77,12 +79,18 @@
 #include <bitcoin/database/tables/caches/validated_tx.hpp>
 #include <bitcoin/database/tables/indexes/height.hpp>
 #include <bitcoin/database/tables/indexes/strong_tx.hpp>
+#include <bitcoin/database/tables/optionals/activity.hpp>
 #include <bitcoin/database/tables/optionals/address.hpp>
+#include <bitcoin/database/tables/optionals/fee_bk.hpp>
 #include <bitcoin/database/tables/optionals/filter_bk.hpp>
 #include <bitcoin/database/tables/optionals/filter_tx.hpp>
+#include <bitcoin/database/tables/optionals/summary.hpp>
+#include <bitcoin/database/tables/optionals/touched.hpp>
+#include <bitcoin/database/types/address_summary.hpp>
 #include <bitcoin/database/types/association.hpp>
 #include <bitcoin/database/types/associations.hpp>
 #include <bitcoin/database/types/block_state.hpp>
+#include <bitcoin/database/types/fee_histogram.hpp>
 #include <bitcoin/database/types/fee_rate.hpp>
 #include <bitcoin/database/types/header_state.hpp>
 #include <bitcoin/database/types/history.hpp>
@@ -71,6 +71,7 @@ enum error_t : uint8_t
     sysconf_failure,
     ftruncate_failure,
     fsync_failure,
+    mlock_failure,
 
     /// locks
     transactor_lock,
@@ -89,6 +90,7 @@ enum error_t : uint8_t
     not_coalesced,
     missing_snapshot,
     unloaded_file,
+    rehash_active,
 
     /// tables
     create_table,
@@ -97,6 +99,7 @@ enum error_t : uint8_t
     backup_table,
     restore_table,
     verify_table,
+    rehash_table,
 
     /// validation/confirmation
     tx_connected,
@@ -122,6 +125,7 @@ enum error_t : uint8_t
     tx_tx_set,
     tx_address_allocate,
     tx_address_put,
+    tx_spend_put,
     tx_tx_commit,
 
     /// header archive
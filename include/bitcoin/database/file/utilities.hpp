@@ -62,10 +62,11 @@ BCD_API bool rename(const path& from, const path& to) NOEXCEPT;
 BCD_API code rename_ex(const path& from, const path& to) NOEXCEPT;
 
 /// Copy file, false if did not exist/error or target existed.
+/// Cloned (reflink) or kernel copied where supported, otherwise user copied.
 BCD_API bool copy(const path& from, const path& to) NOEXCEPT;
 BCD_API code copy_ex(const path& from, const path& to) NOEXCEPT;
 
-/// Copy directory with contents non-recursively.
+/// Copy directory with contents (regular files) non-recursively, as copy().
 /// False if did not exist/error or target existed.
 BCD_API bool copy_directory(const path& from, const path& to) NOEXCEPT;
 BCD_API code copy_directory_ex(const path& from, const path& to) NOEXCEPT;
@@ -31,7 +31,7 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 
 TEMPLATE
 inline CLASS::accessor(Mutex& mutex) NOEXCEPT
-  : shared_lock_(mutex)
+  : lock_(mutex)
 {
 }
 
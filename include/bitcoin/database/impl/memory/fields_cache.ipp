@@ -0,0 +1,178 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_FIELDS_CACHE_IPP
+#define LIBBITCOIN_DATABASE_MEMORY_FIELDS_CACHE_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// Push only appends at count, so the cache cannot get ahead of a gap (e.g.
+// following open, until rebuilt). Pop truncates, so it remains a prefix.
+
+TEMPLATE
+CLASS::fields_cache(bool enabled) NOEXCEPT
+  : enabled_(enabled)
+{
+}
+
+TEMPLATE
+bool CLASS::enabled() const NOEXCEPT
+{
+    return enabled_;
+}
+
+TEMPLATE
+size_t CLASS::count() const NOEXCEPT
+{
+    std::shared_lock lock{ mutex_ };
+    return links_.size();
+}
+
+TEMPLATE
+void CLASS::push(const Header& link, size_t height,
+    const fields& values) NOEXCEPT
+{
+    using namespace system;
+    if (!enabled_ || link.is_terminal())
+        return;
+
+    std::unique_lock lock{ mutex_ };
+    if (height != links_.size())
+        return;
+
+    links_.push_back(possible_narrow_cast<uint32_t>(link.value));
+    versions_.push_back(values.version);
+    timestamps_.push_back(values.timestamp);
+    bits_.push_back(values.bits);
+    mtps_.push_back(values.mtp);
+}
+
+TEMPLATE
+void CLASS::pop(size_t height) NOEXCEPT
+{
+    if (!enabled_)
+        return;
+
+    std::unique_lock lock{ mutex_ };
+    if (height >= links_.size())
+        return;
+
+    links_.resize(height);
+    versions_.resize(height);
+    timestamps_.resize(height);
+    bits_.resize(height);
+    mtps_.resize(height);
+}
+
+TEMPLATE
+template <typename Iterator>
+bool CLASS::get_versions(Iterator out, size_t count, size_t height,
+    const Header& link) const NOEXCEPT
+{
+    return copy(out, versions_, count, height, link);
+}
+
+TEMPLATE
+template <typename Iterator>
+bool CLASS::get_timestamps(Iterator out, size_t count, size_t height,
+    const Header& link) const NOEXCEPT
+{
+    return copy(out, timestamps_, count, height, link);
+}
+
+TEMPLATE
+template <typename Iterator>
+bool CLASS::get_bits(Iterator out, size_t count, size_t height,
+    const Header& link) const NOEXCEPT
+{
+    return copy(out, bits_, count, height, link);
+}
+
+TEMPLATE
+template <typename Iterator>
+bool CLASS::get_mtps(Iterator out, size_t count, size_t height,
+    const Header& link) const NOEXCEPT
+{
+    return copy(out, mtps_, count, height, link);
+}
+
+TEMPLATE
+bool CLASS::get_timestamp(uint32_t& out, size_t at, size_t height,
+    const Header& link) const NOEXCEPT
+{
+    if (!enabled_ || at > height)
+        return false;
+
+    std::shared_lock lock{ mutex_ };
+    if (!is_cached(height, link))
+        return false;
+
+    out = timestamps_[at];
+    return true;
+}
+
+TEMPLATE
+void CLASS::clear() NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    links_.clear();
+    versions_.clear();
+    timestamps_.clear();
+    bits_.clear();
+    mtps_.clear();
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+template <typename Iterator>
+bool CLASS::copy(Iterator out, const column& values, size_t count,
+    size_t height, const Header& link) const NOEXCEPT
+{
+    if (!enabled_ || count > add1(height))
+        return false;
+
+    std::shared_lock lock{ mutex_ };
+    if (!is_cached(height, link))
+        return false;
+
+    const auto end = std::next(values.begin(), add1(height));
+    std::copy(std::prev(end, count), end, out);
+    return true;
+}
+
+// protected by caller
+TEMPLATE
+bool CLASS::is_cached(size_t height, const Header& link) const NOEXCEPT
+{
+    return height < links_.size() &&
+        (link.is_terminal() || links_[height] == link.value);
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -33,24 +33,26 @@ namespace database {
 
 TEMPLATE
 CLASS::mmap(const path& filename, size_t minimum, size_t expansion,
-    bool random) NOEXCEPT
+    bool random, const map_options& options) NOEXCEPT
     requires (is_one(columns))
   : filenames_{ filename },
     minimum_(to_rows(minimum)),
     expansion_(expansion),
     random_(random),
+    options_(options),
     opened_{ file::invalid }
 {
 }
 
 TEMPLATE
 CLASS::mmap(const paths& filenames, size_t minimum, size_t expansion,
-    bool random) NOEXCEPT
+    bool random, const map_options& options) NOEXCEPT
     requires (columns > one)
   : filenames_(filenames),
     minimum_(to_rows(minimum)),
     expansion_(expansion),
     random_(random),
+    options_(options),
     opened_{}
 {
     opened_.fill(file::invalid);
@@ -82,6 +84,12 @@ bool CLASS::is_loaded() const NOEXCEPT
     return loaded_;
 }
 
+TEMPLATE
+size_t CLASS::written() const NOEXCEPT
+{
+    return written_.load(std::memory_order_relaxed);
+}
+
 // protected
 // ----------------------------------------------------------------------------
 
@@ -94,6 +102,32 @@ size_t CLASS::to_capacity(size_t required) const NOEXCEPT
     return std::max(minimum_, ceilinged_add(required, growth));
 }
 
+TEMPLATE
+bool CLASS::is_reserved(size_t capacity) const NOEXCEPT
+{
+    for (size_t index{}; index < columns; ++index)
+        if (capacity * widths.at(index) > reserved_.at(index))
+            return false;
+
+    return true;
+}
+
+// Requires exclusive field_mutex_.
+TEMPLATE
+bool CLASS::grow(size_t capacity) NOEXCEPT
+{
+    // Base pointers do not move within the reservation, so accessors remain
+    // valid and the remap lock is not required.
+    if (is_reserved(capacity))
+        return extend_all_(capacity, sequence{});
+
+    // TODO: Could loop over a try lock here and log deadlock warning.
+    std::unique_lock remap_lock(remap_mutex_);
+
+    // Disk full condition leaves store in valid state despite false.
+    return remap_all_(capacity, sequence{});
+}
+
 // Read-write protected by atomic, write-write protected by remap_mutex.
 TEMPLATE
 void CLASS::set_first_code(const error::error_t& ec) NOEXCEPT
@@ -38,7 +38,8 @@ memory_ptr CLASS::get_capacity(size_t offset) const NOEXCEPT
 {
     const auto allocated = to_width<zero>(capacity());
 
-    const auto ptr = std::make_shared<access>(remap_mutex_);
+    const auto ptr = std::allocate_shared<access>(
+        recycler<access>{}, remap_mutex_);
     if (!loaded_ || is_null(ptr))
         return {};
 
@@ -47,6 +48,23 @@ memory_ptr CLASS::get_capacity(size_t offset) const NOEXCEPT
     return ptr;
 }
 
+TEMPLATE
+memory_ptr CLASS::get_exclusive() const NOEXCEPT
+{
+    // Obtaining size before access prevents mutual mutex wait (deadlock).
+    const auto allocated = to_width<zero>(size());
+
+    // Takes an exclusive lock on remap_mutex_ until destruct, blocking all.
+    const auto ptr = std::allocate_shared<exclusive>(
+        recycler<exclusive>{}, remap_mutex_);
+    if (!loaded_ || is_null(ptr))
+        return {};
+
+    auto data = memory_map_.front();
+    ptr->assign(data, std::next(data, allocated));
+    return ptr;
+}
+
 TEMPLATE
 memory::iterator CLASS::get_raw(size_t offset) const NOEXCEPT
 {
@@ -70,13 +88,8 @@ memory_ptr CLASS::set(size_t offset, size_t size, uint8_t backfill) NOEXCEPT
         const auto end = std::max(logical_, offset + size);
         if (end > capacity_)
         {
-            const auto extended = to_capacity(end);
-
-            // TODO: Could loop over a try lock here and log deadlock warning.
-            std::unique_lock remap_lock(remap_mutex_);
-
             // Disk full condition leaves store in valid state despite null.
-            if (!remap_all_(extended, sequence{}))
+            if (!grow(to_capacity(end)))
                 return {};
 
             // Fill new capacity as offset may not be at end due to expansion.
@@ -88,6 +101,7 @@ memory_ptr CLASS::set(size_t offset, size_t size, uint8_t backfill) NOEXCEPT
         }
 
         logical_ = end;
+        size_.store(logical_, std::memory_order_release);
     }
 
     return get(offset);
@@ -106,10 +120,12 @@ memory_ptr CLASS::get_at(size_t column, size_t offset) const NOEXCEPT
         return {};
 
     // Obtaining size before access prevents mutual mutex wait (deadlock).
+    // size() is lock-free, so this is one atomic load (not a field lock).
     const auto allocated = size() * widths.at(column);
 
     // Takes a shared lock on remap_mutex_ until destruct, blocking remap.
-    const auto ptr = std::make_shared<access>(remap_mutex_);
+    const auto ptr = std::allocate_shared<access>(
+        recycler<access>{}, remap_mutex_);
 
     // loaded_ update is precluded by above lock, making this read atomic.
     if (!loaded_ || is_null(ptr))
@@ -34,9 +34,25 @@ namespace database {
 
 TEMPLATE
 template <size_t... Index>
-bool CLASS::flush_all_(std::index_sequence<Index...>) NOEXCEPT
+bool CLASS::flush_all_(size_t to, std::index_sequence<Index...>) NOEXCEPT
 {
-    return (flush_<Index>() && ...);
+    return (flush_<Index>(to) && ...);
+}
+
+TEMPLATE
+template <size_t... Index>
+bool CLASS::flush_appended_all_(size_t from, size_t to,
+    std::index_sequence<Index...>) NOEXCEPT
+{
+    return (flush_appended_<Index>(from, to) && ...);
+}
+
+TEMPLATE
+template <size_t... Index>
+bool CLASS::writeback_all_(size_t from, size_t to,
+    std::index_sequence<Index...>) NOEXCEPT
+{
+    return (writeback_<Index>(from, to) && ...);
 }
 
 TEMPLATE
@@ -76,6 +92,18 @@ bool CLASS::remap_all_(size_t capacity, std::index_sequence<Index...>) NOEXCEPT
     return true;
 }
 
+// Extension failure leaves mapping and capacity_ unchanged (no unmap).
+TEMPLATE
+template <size_t... Index>
+bool CLASS::extend_all_(size_t capacity, std::index_sequence<Index...>) NOEXCEPT
+{
+    if (!(extend_<Index>(capacity) && ...))
+        return false;
+
+    capacity_ = capacity;
+    return true;
+}
+
 // mman wrappers, not thread safe.
 // ----------------------------------------------------------------------------
 // private
@@ -83,19 +111,20 @@ bool CLASS::remap_all_(size_t capacity, std::index_sequence<Index...>) NOEXCEPT
 // Never results in unmapped.
 TEMPLATE
 template <size_t Column>
-bool CLASS::flush_() NOEXCEPT
+bool CLASS::flush_(size_t to) NOEXCEPT
 {
 #if defined(HAVE_MSC)
     // unmap (and therefore msync) must be called before ftruncate.
     // "To flush all the dirty pages plus the metadata for the file and ensure
     // that they are physically written to disk..."
-    const auto size = to_width<Column>(logical_);
+    const auto size = to_width<Column>(to);
     const auto success =
            (::msync(memory_map_[Column], size, MS_SYNC) != fail)
         && (::fsync(opened_[Column]) != fail);
 #elif defined(F_FULLFSYNC)
     // macOS msync fails with zero logical size (but we are no longer calling).
     // non-standard macOS behavior: news.ycombinator.com/item?id=30372218
+    std::ignore = to;
     const auto success = ::fcntl(opened_[Column], F_FULLFSYNC, 0) != fail;
 #else
     // msync should not be required on modern linux, see linus et al.
@@ -106,6 +135,7 @@ bool CLASS::flush_() NOEXCEPT
     // can be retrieved even if the system crashes or is rebooted. This
     // includes writing through or flushing a disk cache if present. The
     // call blocks until the device reports that transfer has completed."
+    std::ignore = to;
     const auto success = ::fsync(opened_[Column]) != fail;
 #endif
 
@@ -115,13 +145,72 @@ bool CLASS::flush_() NOEXCEPT
     return success;
 }
 
+// Never results in unmapped.
+TEMPLATE
+template <size_t Column>
+bool CLASS::flush_appended_(size_t from, size_t to) NOEXCEPT
+{
+#if defined(SYNC_FILE_RANGE_WRITE)
+    // sync_file_range writes back only the appended byte range, but persists
+    // no metadata and does not flush the device cache. So fdatasync follows,
+    // which is left with only metadata (size) and device cache to flush.
+    using namespace system;
+    const auto start = to_width<Column>(from);
+    const auto length = floored_subtract(to_width<Column>(to), start);
+    constexpr auto flags = SYNC_FILE_RANGE_WAIT_BEFORE |
+        SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER;
+
+    const auto success =
+           (::sync_file_range(opened_[Column],
+                possible_narrow_sign_cast<off_t>(start),
+                possible_narrow_sign_cast<off_t>(length), flags) != fail)
+        && (::fdatasync(opened_[Column]) != fail);
+
+    if (!success)
+        set_first_code(error::fsync_failure);
+
+    return success;
+#else
+    // Full file flush where range writeback is not available.
+    std::ignore = from;
+    return flush_<Column>(to);
+#endif
+}
+
+// Never results in unmapped, failure does not fault (advisory).
+TEMPLATE
+template <size_t Column>
+bool CLASS::writeback_(size_t from, size_t to) NOEXCEPT
+{
+#if defined(SYNC_FILE_RANGE_WRITE)
+    // Initiates writeback of the dirty pages of the range, waits on none. This
+    // leaves only residual dirty pages for flush_appended_ (or flush_).
+    using namespace system;
+    const auto start = to_width<Column>(from);
+    const auto length = to_width<Column>(to) - start;
+    return ::sync_file_range(opened_[Column],
+        possible_narrow_sign_cast<off_t>(start),
+        possible_narrow_sign_cast<off_t>(length),
+        SYNC_FILE_RANGE_WRITE) != fail;
+#else
+    // Writeback is left to the kernel where range writeback is not available.
+    std::ignore = from;
+    std::ignore = to;
+    return true;
+#endif
+}
+
 // Always results in unmapped, file is unchanged.
 TEMPLATE
 template <size_t Column>
 bool CLASS::release_(size_t size) NOEXCEPT
 {
-    const auto success =
-        ::munmap(memory_map_[Column], to_width<Column>(size)) != fail;
+    // A reservation is released in full (mapped file and unused remainder).
+    const auto bytes = is_zero(reserved_[Column]) ? to_width<Column>(size) :
+        reserved_[Column];
+
+    reserved_[Column] = zero;
+    const auto success = ::munmap(memory_map_[Column], bytes) != fail;
 
     if (!success)
         set_first_code(error::munmap_failure);
@@ -181,9 +270,25 @@ bool CLASS::map_() NOEXCEPT
     if ((size < minimum_) && !resize_<Column>(size = minimum_))
         return false;
 
+#if !defined(HAVE_MSC) && defined(MAP_NORESERVE)
+    if (!is_zero(options_.reserve))
+    {
+        memory_map_[Column] = reserve_<Column>(size);
+        return finalize_<Column>(size);
+    }
+#endif
+
+#if defined(MAP_POPULATE)
+    // Prefault the initial mapping (remap extension is populated by advice).
+    const auto flags = options_.populate ? MAP_SHARED | MAP_POPULATE :
+        MAP_SHARED;
+#else
+    constexpr auto flags = MAP_SHARED;
+#endif
+
     memory_map_[Column] = system::pointer_cast<uint8_t>(
         ::mmap(nullptr, to_width<Column>(size), PROT_READ | PROT_WRITE,
-            MAP_SHARED, opened_[Column], 0));
+            flags, opened_[Column], 0));
 
     return finalize_<Column>(size);
 }
@@ -200,6 +305,22 @@ bool CLASS::remap_(size_t size) NOEXCEPT
     if (is_zero(size))
         size = minimum_;
 
+#if !defined(HAVE_MSC) && defined(MAP_NORESERVE)
+    if (!is_zero(reserved_[Column]))
+    {
+        // Another column may have exhausted its reservation, not this one.
+        if (to_width<Column>(size) <= reserved_[Column])
+            return extend_<Column>(size);
+
+        // Exhausted, so release and reserve anew (base moves, as with remap).
+        if (!resize_<Column>(size) || !release_<Column>(capacity_))
+            return false;
+
+        memory_map_[Column] = reserve_<Column>(size);
+        return finalize_<Column>(size);
+    }
+#endif
+
 #if !defined(HAVE_MSC) && !defined(MREMAP_MAYMOVE)
     // macOS cannot remap in place, so release the mapping without trimming and
     // the file remains at capacity_ bytes and resize_'s fallocate delta (and
@@ -245,9 +366,10 @@ bool CLASS::remap_(size_t size) NOEXCEPT
 }
 
 // disk_full: space is set but no code is set with false return.
+// Other failure unmaps, unless not release (concurrent access in progress).
 TEMPLATE
 template <size_t Column>
-bool CLASS::resize_(size_t size) NOEXCEPT
+bool CLASS::resize_(size_t size, bool release) NOEXCEPT
 {
     const auto target = to_width<Column>(size);
     const auto capacity = to_width<Column>(capacity_);
@@ -268,7 +390,9 @@ bool CLASS::resize_(size_t size) NOEXCEPT
         }
 
         set_first_code(error::ftruncate_failure);
-        unmap_<Column>(capacity_);
+        if (release)
+            unmap_<Column>(capacity_);
+
         return false;
     }
 
@@ -278,11 +402,7 @@ bool CLASS::resize_(size_t size) NOEXCEPT
 // Finalize failure results in unmapped.
 TEMPLATE
 template <size_t Column>
-bool CLASS::finalize_(size_t
-    #if !defined (WITHOUT_MADVISE) && !defined(HAVE_MSC)
-    size
-    #endif
-) NOEXCEPT
+bool CLASS::finalize_(size_t size) NOEXCEPT
 {
     if (memory_map_[Column] == MAP_FAILED)
     {
@@ -294,24 +414,125 @@ bool CLASS::finalize_(size_t
         return false;
     }
 
-#if !defined (WITHOUT_MADVISE) && !defined(HAVE_MSC)
-    // Get page size (usually 4KB).
-    const int page_size = ::sysconf(_SC_PAGESIZE);
-    const auto page = system::possible_narrow_sign_cast<size_t>(page_size);
+    if (!advise_(memory_map_[Column], to_width<Column>(size)))
+    {
+        unmap_<Column>(size);
+        return false;
+    }
+
+    loaded_ = true;
+    return true;
+}
+
+// Reservation failure results in MAP_FAILED (no reservation).
+// The file is mapped at the base of an inaccessible address range reserved for
+// growth, which is twice the mapping if that exceeds the configured size.
+TEMPLATE
+template <size_t Column>
+uint8_t* CLASS::reserve_(size_t size) NOEXCEPT
+{
+    using namespace system;
+    const auto failed = pointer_cast<uint8_t>(MAP_FAILED);
+
+#if !defined(HAVE_MSC) && defined(MAP_NORESERVE)
+    const auto page = page_size_();
+    if (is_zero(page))
+        return failed;
+
+    const auto max = sub1(page);
+    const auto bytes = to_width<Column>(size);
+    const auto request = std::max(options_.reserve, ceilinged_multiply(bytes,
+        two));
+    const auto reserve = bit_and(ceilinged_add(request, max), bit_not(max));
+
+    const auto base = ::mmap(nullptr, reserve, PROT_NONE,
+        MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (base == MAP_FAILED)
+        return failed;
+
+#if defined(MAP_POPULATE)
+    const auto flags = options_.populate ? MAP_SHARED | MAP_FIXED |
+        MAP_POPULATE : MAP_SHARED | MAP_FIXED;
+#else
+    constexpr auto flags = MAP_SHARED | MAP_FIXED;
+#endif
+
+    if (::mmap(base, bytes, PROT_READ | PROT_WRITE, flags, opened_[Column],
+        0) == MAP_FAILED)
+    {
+        ::munmap(base, reserve);
+        return failed;
+    }
+
+    reserved_[Column] = reserve;
+    return pointer_cast<uint8_t>(base);
+#else
+    std::ignore = size;
+    return failed;
+#endif
+}
 
-    // If not one bit then page size is not a power of two as required.
-    if (page_size == fail || !is_one(system::ones_count(page)))
+// Extension failure leaves mapping unchanged (concurrent access in progress).
+// Maps the file extension over the reserved range, so base does not move.
+TEMPLATE
+template <size_t Column>
+bool CLASS::extend_(size_t size) NOEXCEPT
+{
+#if !defined(HAVE_MSC) && defined(MAP_NORESERVE)
+    // disk_full: space is set but no code is set with false return.
+    if (!resize_<Column>(size, false))
+        return false;
+
+    using namespace system;
+    const auto page = page_size_();
+    if (is_zero(page))
+    {
+        set_first_code(error::sysconf_failure);
+        return false;
+    }
+
+    // The existing mapping extends to the page boundary above capacity.
+    const auto max = sub1(page);
+    const auto bytes = to_width<Column>(size);
+    const auto mapped = bit_and(ceilinged_add(to_width<Column>(capacity_),
+        max), bit_not(max));
+
+    if (bytes <= mapped)
+        return true;
+
+    const auto start = std::next(memory_map_[Column], mapped);
+    if (::mmap(start, bytes - mapped, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_FIXED, opened_[Column],
+        possible_narrow_sign_cast<off_t>(mapped)) == MAP_FAILED)
+    {
+        set_first_code(error::mmap_failure);
+        return false;
+    }
+
+    return advise_(start, bytes - mapped);
+#else
+    std::ignore = size;
+    set_first_code(error::mmap_failure);
+    return false;
+#endif
+}
+
+// Advise failure (or lock failure) sets code, mapping is unchanged.
+TEMPLATE
+bool CLASS::advise_(uint8_t* start, size_t bytes) NOEXCEPT
+{
+#if !defined (WITHOUT_MADVISE) && !defined(HAVE_MSC)
+    const auto page = page_size_();
+    if (is_zero(page))
     {
         set_first_code(error::sysconf_failure);
-        unmap_<Column>(size);
         return false;
     }
 
     // Align mapped bytes up to page boundary.
     using namespace system;
     const auto max = sub1(page);
-    const auto target = to_width<Column>(size);
-    const auto align = bit_and(ceilinged_add(target, max), bit_not(max));
+    const auto align = bit_and(ceilinged_add(bytes, max), bit_not(max));
 
     // Use 1GB chunks to avoid large-length issues.
     constexpr auto chunk = power2(30u);
@@ -320,22 +541,55 @@ bool CLASS::finalize_(size_t
     for (auto offset = zero; offset < align; offset += chunk)
     {
         const auto length = std::min(chunk, align - offset);
-        const auto start = std::next(memory_map_[Column], offset);
+        const auto next = std::next(start, offset);
 
-        if (::madvise(start, length, advice) == fail || (random_ &&
-            ::madvise(start, length, MADV_WILLNEED) == fail))
+        if (::madvise(next, length, advice) == fail || (random_ &&
+            ::madvise(next, length, MADV_WILLNEED) == fail))
         {
             set_first_code(error::madvise_failure);
-            unmap_<Column>(size);
             return false;
         }
+
+#if defined(MADV_HUGEPAGE)
+        // Advisory only, as file-backed huge pages depend on kernel and fs.
+        if (options_.huge)
+            std::ignore = ::madvise(next, length, MADV_HUGEPAGE);
+#endif
+#if defined(MADV_POPULATE_WRITE)
+        // Advisory only, prefaults remap extension (map_ uses MAP_POPULATE).
+        if (options_.populate)
+            std::ignore = ::madvise(next, length, MADV_POPULATE_WRITE);
+#endif
     }
 #endif // !WITHOUT_MADVISE && !HAVE_MSC
 
-    loaded_ = true;
+    // The full mapping is (re)locked on remap, as remap may relocate it.
+    if (options_.lock && ::mlock(start, bytes) == fail)
+    {
+        set_first_code(error::mlock_failure);
+        return false;
+    }
+
     return true;
 }
 
+// Zero if page size is unavailable or not a power of two (as required).
+TEMPLATE
+size_t CLASS::page_size_() NOEXCEPT
+{
+#if !defined(HAVE_MSC)
+    // Get page size (usually 4KB).
+    const auto page_size = ::sysconf(_SC_PAGESIZE);
+    if (page_size == fail)
+        return zero;
+
+    const auto page = system::possible_narrow_sign_cast<size_t>(page_size);
+    return is_one(system::ones_count(page)) ? page : zero;
+#else
+    return zero;
+#endif
+}
+
 } // namespace database
 } // namespace libbitcoin
 
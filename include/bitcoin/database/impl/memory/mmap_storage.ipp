@@ -19,6 +19,7 @@
 #ifndef LIBBITCOIN_DATABASE_MEMORY_MMAP_STORAGE_IPP
 #define LIBBITCOIN_DATABASE_MEMORY_MMAP_STORAGE_IPP
 
+#include <algorithm>
 #include <filesystem>
 #include <mutex>
 #include <utility>
@@ -85,6 +86,7 @@ code CLASS::open() NOEXCEPT
         return ec;
 
     logical_ = logical_rows(bytes);
+    size_.store(logical_, std::memory_order_release);
     return error::success;
 }
 
@@ -101,6 +103,7 @@ code CLASS::close() NOEXCEPT
         return error::success;
 
     logical_ = zero;
+    size_.store(logical_, std::memory_order_release);
     for (auto& descriptor: opened_)
     {
         if (descriptor != file::invalid)
@@ -141,6 +144,15 @@ code CLASS::load() NOEXCEPT
             return error::load_failure;
         }
 
+        // The mapped file is clean and no page is written since any dump.
+        const auto pages = random_ ? system::ceilinged_divide(
+            to_width<zero>(capacity_), page_bytes) : zero;
+        stamps_ = std::vector<std::atomic<size_t>>(pages);
+        untracked_.store(!random_, std::memory_order_relaxed);
+        generation_.store(one, std::memory_order_relaxed);
+        flushed_.store(logical_, std::memory_order_relaxed);
+        written_.store(logical_, std::memory_order_relaxed);
+
         remap_mutex_.unlock();
         return error::success;
     }
@@ -172,19 +184,107 @@ code CLASS::reload() NOEXCEPT
     return error::reload_locked;
 }
 
-// Suspend writes before calling.
+// Suspend writes before calling (for consistency, not safety).
 TEMPLATE
 code CLASS::flush() NOEXCEPT
 {
-    // Prevent unload, resize, remap.
+    size_t to{};
+    {
+        std::shared_lock field_lock(field_mutex_);
+
+        if (!loaded_)
+            return error::flush_unloaded;
+
+        to = logical_;
+    }
+
+    // Obtaining fields before remap guard prevents mutual mutex wait, so
+    // writes within capacity proceed during sync (rows as of call flushed).
+    // Prevents unload, resize, remap.
     std::shared_lock map_lock(remap_mutex_);
-    std::shared_lock field_lock(field_mutex_);
 
+    // loaded_ update is precluded by above lock, making this read atomic.
     if (!loaded_)
         return error::flush_unloaded;
 
-    // Reads fields and the memory map.
-    return flush_all_(sequence{}) ? error::success : error::flush_failure;
+    if (!flush_all_(to, sequence{}))
+        return error::flush_failure;
+
+    flushed_.store(to, std::memory_order_relaxed);
+    written_.store(to, std::memory_order_relaxed);
+    return error::success;
+}
+
+// Suspend writes before calling (for consistency, not safety).
+TEMPLATE
+code CLASS::flush_appended() NOEXCEPT
+{
+    size_t from{};
+    size_t to{};
+    {
+        std::shared_lock field_lock(field_mutex_);
+
+        if (!loaded_)
+            return error::flush_unloaded;
+
+        from = flushed_.load(std::memory_order_relaxed);
+        to = logical_;
+    }
+
+    // Bodies are append-only, so no appended (or truncated) rows is clean.
+    if (to <= from)
+        return error::success;
+
+    // Obtaining fields before remap guard prevents mutual mutex wait.
+    // Prevents unload, resize, remap.
+    std::shared_lock map_lock(remap_mutex_);
+
+    // loaded_ update is precluded by above lock, making this read atomic.
+    if (!loaded_)
+        return error::flush_unloaded;
+
+    if (!flush_appended_all_(from, to, sequence{}))
+        return error::flush_failure;
+
+    flushed_.store(to, std::memory_order_relaxed);
+    written_.store(to, std::memory_order_relaxed);
+    return error::success;
+}
+
+// Does not suspend writes, truncation may precede (or follow) writeback.
+TEMPLATE
+code CLASS::writeback(size_t bytes) NOEXCEPT
+{
+    size_t from{};
+    size_t to{};
+    {
+        std::shared_lock field_lock(field_mutex_);
+
+        if (!loaded_)
+            return error::flush_unloaded;
+
+        from = std::max(written_.load(std::memory_order_relaxed),
+            flushed_.load(std::memory_order_relaxed));
+        to = logical_;
+    }
+
+    // Below target (or truncated) is deferred.
+    if (to <= from || system::ceilinged_multiply(to - from, stride) < bytes)
+        return error::success;
+
+    // Obtaining fields before remap guard prevents mutual mutex wait.
+    // Prevents unload (and therefore descriptor close) during initiation.
+    std::shared_lock map_lock(remap_mutex_);
+
+    // loaded_ update is precluded by above lock, making this read atomic.
+    if (!loaded_)
+        return error::flush_unloaded;
+
+    if (!writeback_all_(from, to, sequence{}))
+        return error::flush_failure;
+
+    written_.store(to, std::memory_order_relaxed);
+    return error::success;
 }
 
 // Suspend writes before calling.
@@ -262,13 +362,164 @@ code CLASS::dump(const std::filesystem::path& path) const NOEXCEPT
     return file::create_file_ex(path, ptr->begin(), ptr->size());
 }
 
+TEMPLATE
+code CLASS::dump(const std::filesystem::path& path,
+    size_t since) const NOEXCEPT
+{
+    BC_ASSERT(is_one(columns));
+    const auto ptr = get();
+    if (!ptr)
+        return error::unloaded_file;
+
+    const auto size = ptr->size();
+    const auto pages = system::ceilinged_divide(size, page_bytes);
+
+    size_t prior{};
+    if (is_zero(since) || untracked_.load(std::memory_order_relaxed) ||
+        (pages > stamps_.size()) || !file::size(prior, path) ||
+        (prior != size))
+        return file::create_file_ex(path, ptr->begin(), size);
+
+#if defined(HAVE_MSC)
+    return file::create_file_ex(path, ptr->begin(), size);
+#else
+    int descriptor{};
+    if (const auto ec = file::open_ex(descriptor, path))
+        return ec;
+
+    // Write only pages marked after the generation of the prior dump.
+    for (size_t page{}; page < pages; ++page)
+    {
+        if (stamps_.at(page).load(std::memory_order_relaxed) <= since)
+            continue;
+
+        const auto offset = page * page_bytes;
+        const auto bytes = std::min(page_bytes, size - offset);
+        const auto data = std::next(ptr->begin(), offset);
+        if (::pwrite(descriptor, data, bytes, system::possible_narrow_sign_cast<
+            off_t>(offset)) != system::possible_narrow_sign_cast<ssize_t>(bytes))
+        {
+            file::close(descriptor);
+            return system::error::errorno_t::not_a_stream;
+        }
+    }
+
+    return file::close_ex(descriptor);
+#endif
+}
+
+// Used to copy headers in snapshot (scalar only), under suspended writes.
+TEMPLATE
+code CLASS::capture(image& out, const std::filesystem::path& path,
+    size_t since, size_t limit, const std::filesystem::path& staged) const NOEXCEPT
+{
+    using namespace system;
+    BC_ASSERT(is_one(columns));
+    const auto ptr = get();
+    if (!ptr)
+        return error::unloaded_file;
+
+    const auto size = possible_narrow_sign_cast<size_t>(ptr->size());
+    const auto pages = ceilinged_divide(size, page_bytes);
+
+    out.size = size;
+    out.page = page_bytes;
+    out.pages.clear();
+    out.data.clear();
+    out.staged.clear();
+
+#if defined(HAVE_MSC)
+    // Patches are written with pwrite, so not captured here.
+    std::ignore = path;
+    std::ignore = since;
+    out.patch = false;
+#else
+    size_t prior{};
+    out.patch = !is_zero(since) && !untracked_.load(std::memory_order_relaxed)
+        && (pages <= stamps_.size()) && file::size(prior, path) &&
+        (prior == size);
+#endif
+
+    // Copy only pages marked after the generation of the prior dump.
+    if (out.patch)
+        for (size_t page{}; page < pages; ++page)
+            if (stamps_.at(page).load(std::memory_order_relaxed) > since)
+                out.pages.push_back(page);
+
+    // Oversized capture is dumped in full (in place of memory), and moved by
+    // the deferred dump. This bounds memory at the cost of a longer capture.
+    const auto bytes = out.patch ? out.pages.size() * page_bytes : size;
+    if (!staged.empty() && bytes > limit)
+    {
+        out.patch = false;
+        out.pages.clear();
+        out.staged = staged;
+        return file::create_file_ex(staged, ptr->begin(), size);
+    }
+
+    if (!out.patch)
+    {
+        out.data.assign(ptr->begin(), ptr->end());
+        return error::success;
+    }
+
+    out.data.reserve(out.pages.size() * page_bytes);
+    for (const auto page: out.pages)
+    {
+        const auto offset = page * page_bytes;
+        const auto bytes = std::min(page_bytes, size - offset);
+        const auto data = std::next(ptr->begin(), offset);
+        out.data.insert(out.data.end(), data, std::next(data, bytes));
+    }
+
+    return error::success;
+}
+
+TEMPLATE
+void CLASS::mark(size_t offset, size_t bytes) NOEXCEPT
+{
+    using namespace system;
+    if (is_zero(bytes) || stamps_.empty())
+        return;
+
+    // Pages beyond the loaded capacity (remap) are not tracked.
+    const auto first = offset / page_bytes;
+    const auto last = ceilinged_add(offset, sub1(bytes)) / page_bytes;
+    if (last >= stamps_.size())
+    {
+        untracked_.store(true, std::memory_order_relaxed);
+        return;
+    }
+
+    // Avoid the store (cache line ownership) when already stamped.
+    const auto current = generation_.load(std::memory_order_relaxed);
+    for (auto page = first; page <= last; ++page)
+    {
+        auto& stamp = stamps_[page];
+        if (stamp.load(std::memory_order_relaxed) != current)
+            stamp.store(current, std::memory_order_relaxed);
+    }
+}
+
+TEMPLATE
+size_t CLASS::generation() const NOEXCEPT
+{
+    return generation_.load(std::memory_order_relaxed);
+}
+
+TEMPLATE
+void CLASS::advance() NOEXCEPT
+{
+    generation_.fetch_add(one, std::memory_order_relaxed);
+}
+
 // ----------------------------------------------------------------------------
 
 TEMPLATE
 size_t CLASS::size() const NOEXCEPT
 {
-    std::shared_lock field_lock(field_mutex_);
-    return logical_;
+    // Mirrors logical_ (updated under field_mutex_), read without the lock.
+    return size_.load(std::memory_order_acquire);
 }
 
 TEMPLATE
@@ -286,7 +537,15 @@ bool CLASS::truncate(size_t count) NOEXCEPT
     if (count > logical_)
         return false;
 
+    // Rows rewritten above count are appended with respect to last flush.
+    if (count < flushed_.load(std::memory_order_relaxed))
+        flushed_.store(count, std::memory_order_relaxed);
+
+    if (count < written_.load(std::memory_order_relaxed))
+        written_.store(count, std::memory_order_relaxed);
+
     logical_ = count;
+    size_.store(logical_, std::memory_order_release);
     return true;
 }
 
@@ -301,15 +560,11 @@ bool CLASS::expand(size_t count) NOEXCEPT
     if (count <= logical_)
         return true;
 
-    if (count > capacity_)
-    {
-        const auto extended = to_capacity(count);
-        std::unique_lock remap_lock(remap_mutex_);
-        if (!remap_all_(extended, sequence{}))
-            return false;
-    }
+    if (count > capacity_ && !grow(to_capacity(count)))
+        return false;
 
     logical_ = count;
+    size_.store(logical_, std::memory_order_release);
     return true;
 }
 
@@ -322,21 +577,17 @@ bool CLASS::reserve(size_t count) NOEXCEPT
         return false;
 
     const auto end = logical_ + count;
-    if (end > capacity_)
-    {
-        const auto extended = to_capacity(end);
-        std::unique_lock remap_lock(remap_mutex_);
-        if (!remap_all_(extended, sequence{}))
-            return false;
-    }
+    if (end > capacity_ && !grow(to_capacity(end)))
+        return false;
 
     // Same as allocate except logical does not change.
     return true;
 }
 
-// Waits until all access pointers are destructed. Will deadlock if any access
-// pointer is waiting on allocation. Lock safety requires that access pointers
-// are short-lived and do not block on allocation.
+// Waits until all access pointers are destructed, unless growth is within the
+// address space reservation. Will deadlock if any access pointer is waiting on
+// allocation. Lock safety requires that access pointers are short-lived and do
+// not block on allocation.
 TEMPLATE
 size_t CLASS::allocate(size_t count) NOEXCEPT
 {
@@ -345,20 +596,13 @@ size_t CLASS::allocate(size_t count) NOEXCEPT
     if (fault_ || !loaded_ || system::is_add_overflow(logical_, count))
         return storage::eof;
 
+    // Disk full condition leaves store in valid state despite eof return.
     auto end = logical_ + count;
-    if (end > capacity_)
-    {
-        const auto extended = to_capacity(end);
-
-        // TODO: Could loop over a try lock here and log deadlock warning.
-        std::unique_lock remap_lock(remap_mutex_);
-
-        // Disk full condition leaves store in valid state despite eof return.
-        if (!remap_all_(extended, sequence{}))
-            return storage::eof;
-    }
+    if (end > capacity_ && !grow(to_capacity(end)))
+        return storage::eof;
 
     std::swap(logical_, end);
+    size_.store(logical_, std::memory_order_release);
     return end;
 }
 
@@ -0,0 +1,159 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_OBJECT_CACHE_IPP
+#define LIBBITCOIN_DATABASE_MEMORY_OBJECT_CACHE_IPP
+
+#include <algorithm>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+TEMPLATE
+CLASS::object_cache(size_t capacity, size_t shards) NOEXCEPT
+  : limit_(is_zero(capacity) ? zero :
+        system::ceilinged_divide(capacity, std::max(one, shards))),
+    shards_(is_zero(capacity) ? zero : std::max(one, shards))
+{
+}
+
+TEMPLATE
+bool CLASS::enabled() const NOEXCEPT
+{
+    return !shards_.empty();
+}
+
+TEMPLATE
+size_t CLASS::size() const NOEXCEPT
+{
+    size_t total{};
+    for (const auto& shard: shards_)
+    {
+        std::shared_lock lock{ shard.mutex };
+        total += shard.map.size();
+    }
+
+    return total;
+}
+
+TEMPLATE
+size_t CLASS::hits() const NOEXCEPT
+{
+    return hits_.load(std::memory_order_relaxed);
+}
+
+TEMPLATE
+size_t CLASS::misses() const NOEXCEPT
+{
+    return misses_.load(std::memory_order_relaxed);
+}
+
+TEMPLATE
+typename CLASS::cptr CLASS::get(const Link& link) const NOEXCEPT
+{
+    if (!enabled())
+        return {};
+
+    auto& shard = to_shard(link);
+    std::shared_lock lock{ shard.mutex };
+    const auto it = shard.map.find(link.value);
+    if (it == shard.map.end())
+    {
+        misses_.fetch_add(one, std::memory_order_relaxed);
+        return {};
+    }
+
+    hits_.fetch_add(one, std::memory_order_relaxed);
+    return it->second.object;
+}
+
+TEMPLATE
+void CLASS::put(const Link& link, const cptr& object) NOEXCEPT
+{
+    if (!enabled() || !object)
+        return;
+
+    auto& shard = to_shard(link);
+    std::unique_lock lock{ shard.mutex };
+    auto& map = shard.map;
+    auto& order = shard.order;
+
+    // Replacement does not change insertion order.
+    if (const auto it = map.find(link.value); it != map.end())
+    {
+        it->second.object = object;
+        return;
+    }
+
+    // Order holds exactly the cached keys, so the oldest is evicted.
+    while (map.size() >= limit_ && !order.empty())
+    {
+        map.erase(order.front());
+        order.pop_front();
+    }
+
+    order.push_back(link.value);
+    map.emplace(link.value, entry{ object, std::prev(order.end()) });
+}
+
+TEMPLATE
+void CLASS::erase(const Link& link) NOEXCEPT
+{
+    if (!enabled())
+        return;
+
+    auto& shard = to_shard(link);
+    std::unique_lock lock{ shard.mutex };
+    const auto it = shard.map.find(link.value);
+    if (it == shard.map.end())
+        return;
+
+    // Remove from order (constant time), so reinsertion is not evicted early.
+    shard.order.erase(it->second.position);
+    shard.map.erase(it);
+}
+
+TEMPLATE
+void CLASS::clear() NOEXCEPT
+{
+    for (auto& shard: shards_)
+    {
+        std::unique_lock lock{ shard.mutex };
+        shard.map.clear();
+        shard.order.clear();
+    }
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+typename CLASS::shard& CLASS::to_shard(const Link& link) const NOEXCEPT
+{
+    // Links are sequential, so modulo distributes evenly across shards.
+    return shards_.at(link.value % shards_.size());
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,327 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_POOL_IPP
+#define LIBBITCOIN_DATABASE_MEMORY_POOL_IPP
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/memory/mman.hpp>
+#include <bitcoin/database/memory/recycler.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// Residency state is advisory, the mapping is always addressable. So a race
+// between a pin and an eviction (or a missed frame allocation) costs a page
+// fault, never correctness. Frames are allocated in blocks on first reference
+// and are retained until destruct, so a view's pin counter never dangles.
+
+TEMPLATE
+CLASS::pool(const path& filename, size_t minimum, size_t expansion,
+    bool random, const map_options& options) NOEXCEPT
+    requires (is_one(columns))
+  : base(filename, minimum, expansion, random, options),
+    limit_(to_limit(options))
+{
+}
+
+TEMPLATE
+CLASS::pool(const paths& filenames, size_t minimum, size_t expansion,
+    bool random, const map_options& options) NOEXCEPT
+    requires (columns > one)
+  : base(filenames, minimum, expansion, random, options),
+    limit_(to_limit(options))
+{
+}
+
+BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+
+TEMPLATE
+CLASS::~pool() NOEXCEPT
+{
+    for (auto& directory: directories_)
+        for (auto& slot: directory.slots)
+            delete[] slot.load(std::memory_order_relaxed);
+}
+
+BC_POP_WARNING()
+
+TEMPLATE
+size_t CLASS::resident(size_t column) const NOEXCEPT
+{
+    if (column >= columns)
+        return zero;
+
+    return directories_.at(column).resident.load(std::memory_order_relaxed);
+}
+
+TEMPLATE
+size_t CLASS::pinned(size_t column) const NOEXCEPT
+{
+    if (column >= columns)
+        return zero;
+
+    size_t count{};
+    for (const auto& slot: directories_.at(column).slots)
+        if (const auto frames = slot.load(std::memory_order_acquire))
+            for (size_t index{}; index < block; ++index)
+                if (!is_zero(frames[index].pins.load(
+                    std::memory_order_relaxed)))
+                    ++count;
+
+    return count;
+}
+
+TEMPLATE
+code CLASS::unload() NOEXCEPT
+{
+    if (const auto ec = base::unload())
+        return ec;
+
+    // Unload precludes views, and unmapping releases all residency.
+    for (auto& directory: directories_)
+    {
+        for (auto& slot: directory.slots)
+            if (const auto frames = slot.load(std::memory_order_acquire))
+                for (size_t index{}; index < block; ++index)
+                    frames[index].state.store(evicted,
+                        std::memory_order_relaxed);
+
+        directory.resident.store(zero, std::memory_order_relaxed);
+    }
+
+    return error::success;
+}
+
+TEMPLATE
+memory_ptr CLASS::get_at(size_t column, size_t offset) const NOEXCEPT
+{
+    auto ptr = base::get_at(column, offset);
+    if (!ptr || ptr->size() <= 0)
+        return ptr;
+
+    const auto index = offset / chunk;
+    const auto frame = get_frame(column, index, true);
+    if (is_null(frame))
+        return ptr;
+
+    // The accessor holds the remap guard, so base and logical are stable.
+    const auto logical = offset + system::possible_narrow_sign_cast<size_t>(
+        ptr->size());
+    const auto origin = std::prev(ptr->begin(), offset);
+
+    frame->pins.fetch_add(one, std::memory_order_relaxed);
+    reference(column, *frame, origin, index, logical);
+
+    return std::allocate_shared<view>(recycler<view>{}, std::move(ptr),
+        frame->pins);
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+size_t CLASS::to_limit(const map_options& options) NOEXCEPT
+{
+    // Zero resident budget implies unbounded (never sweep).
+    if (is_zero(options.resident))
+        return max_size_t;
+
+    return std::max(one, options.resident / chunk);
+}
+
+TEMPLATE
+void CLASS::advise(uint8_t* start, size_t bytes, bool evict) NOEXCEPT
+{
+#if !defined(WITHOUT_MADVISE) && !defined(HAVE_MSC)
+    // Pageout writes back and reclaims, dontneed only drops page tables
+    // (shared file pages remain cached). Both are advisory only.
+#if defined(MADV_PAGEOUT)
+    constexpr auto eviction = MADV_PAGEOUT;
+#else
+    constexpr auto eviction = MADV_DONTNEED;
+#endif
+    std::ignore = ::madvise(start, bytes, evict ? eviction : MADV_WILLNEED);
+#else
+    std::ignore = start;
+    std::ignore = bytes;
+    std::ignore = evict;
+#endif
+}
+
+BC_PUSH_WARNING(NO_NEW_OR_DELETE)
+
+TEMPLATE
+typename CLASS::frame* CLASS::get_frame(size_t column, size_t index,
+    bool create) const NOEXCEPT
+{
+    const auto outer = index / block;
+    if (outer >= blocks)
+        return nullptr;
+
+    auto& slot = directories_.at(column).slots.at(outer);
+    auto frames = slot.load(std::memory_order_acquire);
+    if (is_null(frames) && create)
+    {
+        const auto fresh = new (std::nothrow) frame[block];
+        if (is_null(fresh))
+            return nullptr;
+
+        if (slot.compare_exchange_strong(frames, fresh,
+            std::memory_order_acq_rel))
+            frames = fresh;
+        else
+            delete[] fresh;
+    }
+
+    return is_null(frames) ? nullptr : &frames[index % block];
+}
+
+BC_POP_WARNING()
+
+TEMPLATE
+void CLASS::reference(size_t column, frame& item, uint8_t* origin,
+    size_t index, size_t logical) const NOEXCEPT
+{
+    auto state = item.state.load(std::memory_order_relaxed);
+    if (state == hot)
+        return;
+
+    // Second reference promotes.
+    if (state == cold)
+    {
+        item.state.store(hot, std::memory_order_relaxed);
+        return;
+    }
+
+    // First reference, one thread prefetches and may sweep.
+    if (!item.state.compare_exchange_strong(state, cold,
+        std::memory_order_relaxed))
+        return;
+
+    const auto start = index * chunk;
+    advise(std::next(origin, start), std::min(chunk, logical - start), false);
+
+    auto& directory = directories_.at(column);
+    if (directory.resident.fetch_add(one, std::memory_order_relaxed) >= limit_)
+        sweep(column, origin, logical);
+}
+
+TEMPLATE
+void CLASS::sweep(size_t column, uint8_t* origin,
+    size_t logical) const NOEXCEPT
+{
+    // One sweeper at a time, others proceed over budget (advisory).
+    std::unique_lock lock(sweep_mutex_, std::try_to_lock);
+    if (!lock.owns_lock())
+        return;
+
+    auto& directory = directories_.at(column);
+    const auto chunks = system::ceilinged_divide(logical, chunk);
+
+    // Two revolutions demote and then evict any unpinned chunk.
+    for (size_t step{}; step < two * chunks && directory.resident.load(
+        std::memory_order_relaxed) > limit_; ++step)
+    {
+        // Logical may have been truncated since the last sweep.
+        const auto index = directory.hand % chunks;
+        directory.hand = add1(index);
+
+        const auto frame = get_frame(column, index, false);
+        if (is_null(frame) ||
+            !is_zero(frame->pins.load(std::memory_order_relaxed)))
+            continue;
+
+        auto state = frame->state.load(std::memory_order_relaxed);
+        if (state == hot)
+        {
+            frame->state.store(cold, std::memory_order_relaxed);
+            continue;
+        }
+
+        if (state == cold && frame->state.compare_exchange_strong(state,
+            evicted, std::memory_order_relaxed))
+        {
+            const auto start = index * chunk;
+            advise(std::next(origin, start), std::min(chunk, logical - start),
+                true);
+            directory.resident.fetch_sub(one, std::memory_order_relaxed);
+        }
+    }
+}
+
+// view
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+CLASS::view::view(memory_ptr&& memory, std::atomic<uint32_t>& pins) NOEXCEPT
+  : memory_(std::move(memory)), pins_(pins)
+{
+}
+
+TEMPLATE
+CLASS::view::~view() NOEXCEPT
+{
+    pins_.fetch_sub(one, std::memory_order_relaxed);
+}
+
+TEMPLATE
+uint8_t* CLASS::view::offset(size_t bytes) const NOEXCEPT
+{
+    return memory_->offset(bytes);
+}
+
+TEMPLATE
+ptrdiff_t CLASS::view::size() const NOEXCEPT
+{
+    return memory_->size();
+}
+
+TEMPLATE
+uint8_t* CLASS::view::data() const NOEXCEPT
+{
+    return memory_->data();
+}
+
+TEMPLATE
+CLASS::view::operator system::data_slab() const NOEXCEPT
+{
+    return *memory_;
+}
+
+TEMPLATE
+uint8_t* CLASS::view::begin() const NOEXCEPT
+{
+    return memory_->begin();
+}
+
+TEMPLATE
+uint8_t* CLASS::view::end() const NOEXCEPT
+{
+    return memory_->end();
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
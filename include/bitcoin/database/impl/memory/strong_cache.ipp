@@ -0,0 +1,149 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_STRONG_CACHE_IPP
+#define LIBBITCOIN_DATABASE_MEMORY_STRONG_CACHE_IPP
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// Tx element is header link value plus one, zero implies not strong.
+// Block element is height (high) and mtp (low), valid only when referenced.
+// Block is stored before its txs are released, and txs are acquired before
+// their block is read, so a referenced block context is always visible.
+
+TEMPLATE
+CLASS::strong_cache(bool enabled) NOEXCEPT
+  : enabled_(enabled)
+{
+}
+
+TEMPLATE
+bool CLASS::enabled() const NOEXCEPT
+{
+    return enabled_;
+}
+
+TEMPLATE
+void CLASS::reserve(size_t txs, size_t headers) NOEXCEPT
+{
+    if (!enabled_)
+        return;
+
+    expand(txs_, txs);
+    expand(blocks_, headers);
+}
+
+TEMPLATE
+void CLASS::set_block(const Header& link, uint32_t height,
+    uint32_t mtp) NOEXCEPT
+{
+    using namespace system;
+    if (!enabled_ || link.is_terminal())
+        return;
+
+    const auto index = possible_narrow_cast<size_t>(link.value);
+    expand(blocks_, add1(index));
+
+    std::shared_lock lock{ mutex_ };
+    const auto value = bit_or(shift_left(possible_wide_cast<uint64_t>(height),
+        bits<uint32_t>), possible_wide_cast<uint64_t>(mtp));
+    std::atomic_ref{ blocks_[index] }.store(value, std::memory_order_relaxed);
+}
+
+TEMPLATE
+void CLASS::set(const Tx& first, size_t count, const Header& block,
+    bool positive) NOEXCEPT
+{
+    using namespace system;
+    if (!enabled_ || first.is_terminal() || is_zero(count))
+        return;
+
+    const auto start = possible_narrow_cast<size_t>(first.value);
+    const auto value = positive && !block.is_terminal() ?
+        add1(possible_narrow_cast<uint32_t>(block.value)) : uint32_t{};
+
+    expand(txs_, start + count);
+
+    std::shared_lock lock{ mutex_ };
+    for (auto index = start; index < start + count; ++index)
+        std::atomic_ref{ txs_[index] }.store(value, std::memory_order_release);
+}
+
+TEMPLATE
+bool CLASS::get(uint32_t& height, uint32_t& mtp,
+    const Tx& link) const NOEXCEPT
+{
+    using namespace system;
+    if (!enabled_ || link.is_terminal())
+        return false;
+
+    const auto index = possible_narrow_cast<size_t>(link.value);
+
+    std::shared_lock lock{ mutex_ };
+    if (index >= txs_.size())
+        return false;
+
+    const auto block = std::atomic_ref{ txs_[index] }.load(
+        std::memory_order_acquire);
+    if (is_zero(block) || sub1(block) >= blocks_.size())
+        return false;
+
+    const auto value = std::atomic_ref{ blocks_[sub1(block)] }.load(
+        std::memory_order_relaxed);
+    height = narrow_cast<uint32_t>(shift_right(value, bits<uint32_t>));
+    mtp = narrow_cast<uint32_t>(value);
+    return true;
+}
+
+TEMPLATE
+void CLASS::clear() NOEXCEPT
+{
+    std::unique_lock lock{ mutex_ };
+    std::fill(txs_.begin(), txs_.end(), uint32_t{});
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+template <typename Integer>
+void CLASS::expand(std::vector<Integer>& table, size_t count) NOEXCEPT
+{
+    {
+        std::shared_lock lock{ mutex_ };
+        if (count <= table.size())
+            return;
+    }
+
+    // Grow by half to amortize the exclusive lock over sequential links.
+    std::unique_lock lock{ mutex_ };
+    if (count > table.size())
+        table.resize(std::max(count, table.size() + system::to_half(table.size())));
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -72,6 +72,7 @@ bool CLASS::clear() NOEXCEPT
     // remains unchanged and subject to initialization size at each startup. So
     // there is no reduction until restart, which can include config change.
     std::fill_n(ptr->data(), size(), system::bit_all<uint8_t>);
+    file_.mark(zero, size());
     return set_body_count(zero);
 }
 
@@ -120,6 +121,7 @@ bool CLASS::set_body_count(const Link& count) NOEXCEPT
     // offsetting is a multiple of cell size, a full cell is consumed for it.
     // In case of nomap or disabled there are no cells, so file is link size.
     to_array<Link::size>(ptr->data()) = count;
+    file_.mark(zero, Link::size);
     return true;
 }
 
@@ -167,10 +169,13 @@ bool CLASS::push(const Link& link, const Link& index) NOEXCEPT
     constexpr auto fill = bit_all<uint8_t>;
 
     // Allocate as necessary and fill allocations.
-    const auto ptr = file_.set(link_to_position(index), bucket_size, fill);
+    const auto position = link_to_position(index);
+    const auto ptr = file_.set(position, bucket_size, fill);
     if (is_null(ptr))
         return false;
 
+    file_.mark(position, bucket_size);
+
     if constexpr (aligned)
     {
         // Writes full padded word (0x00 fill).
@@ -190,6 +195,49 @@ bool CLASS::push(const Link& link, const Link& index) NOEXCEPT
     return true;
 }
 
+TEMPLATE
+template <typename Function>
+bool CLASS::merge(const Link& index, const Function& function) NOEXCEPT
+{
+    using namespace system;
+    constexpr auto fill = bit_all<uint8_t>;
+
+    // Allocate as necessary and fill allocations.
+    const auto position = link_to_position(index);
+    const auto ptr = file_.set(position, bucket_size, fill);
+    if (is_null(ptr))
+        return false;
+
+    file_.mark(position, bucket_size);
+
+    if constexpr (aligned)
+    {
+        // Exchanges full padded word (0x00 fill), retrying on a race.
+        const auto raw = ptr->data();
+        auto& head = *pointer_cast<std::atomic<CLASS::link>>(raw);
+        auto prior = head.load(std::memory_order_relaxed);
+        CLASS::link next{};
+        do
+        {
+            next = function(Link{ bit_and(Link::terminal, prior) });
+        }
+        while (!head.compare_exchange_weak(prior, next,
+            std::memory_order_relaxed));
+    }
+    else
+    {
+        auto& head = to_array<bucket_size>(ptr->data());
+
+        mutex_.lock();
+        Link prior{};
+        prior = head;
+        head = function(prior);
+        mutex_.unlock();
+    }
+
+    return true;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -121,6 +121,12 @@ Link CLASS::count() const NOEXCEPT
     return body_.count();
 }
 
+TEMPLATE
+bool CLASS::truncate(const Link& count) NOEXCEPT
+{
+    return body_.truncate(count);
+}
+
 TEMPLATE
 bool CLASS::expand(const Link& count) NOEXCEPT
 {
@@ -208,6 +214,27 @@ bool CLASS::put(size_t key, const Element& element) NOEXCEPT
     return element.to_data(sink) && head_.push(link, head_.index(key));
 }
 
+TEMPLATE
+bool CLASS::set(size_t key, const Link& value) NOEXCEPT
+{
+    // Avoid setting at/above terminal sentinel into a bucket position.
+    if (key >= Link::terminal)
+        return false;
+
+    return head_.push(value, head_.index(key));
+}
+
+TEMPLATE
+template <typename Function>
+bool CLASS::merge(size_t key, const Function& function) NOEXCEPT
+{
+    // Avoid setting at/above terminal sentinel into a bucket position.
+    if (key >= Link::terminal)
+        return false;
+
+    return head_.merge(head_.index(key), function);
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -42,13 +42,13 @@ CLASS::hashhead(storage& head, size_t buckets) NOEXCEPT
 TEMPLATE
 inline size_t CLASS::size() const NOEXCEPT
 {
-    return link_to_position(buckets_);
+    return link_to_position(buckets_.load(std::memory_order_relaxed));
 }
 
 TEMPLATE
 inline size_t CLASS::buckets() const NOEXCEPT
 {
-    return buckets_;
+    return buckets_.load(std::memory_order_relaxed);
 }
 
 TEMPLATE
@@ -73,6 +73,7 @@ bool CLASS::create() NOEXCEPT
     // std::memset/fill_n have identical performance (on win32).
     ////std::memset(ptr->data(), system::bit_all<uint8_t>, allocation);
     std::fill_n(ptr->data(), allocation, system::bit_all<uint8_t>);
+    file_.mark(start, allocation);
     return set_body_count(zero);
 }
 
@@ -108,6 +109,19 @@ bool CLASS::set_body_count(const Link& count) NOEXCEPT
     // In case of disabled there are no cells, so file is link size.
     auto value = count.value;
     link_array(ptr->data()) = link_array(value);
+    file_.mark(zero, link_size);
+
+    // The shadow replaces the head upon completion, so it carries the count.
+    if (!system::is_null(shadow_))
+    {
+        const auto shadow = shadow_->get();
+        if (!shadow)
+            return false;
+
+        link_array(shadow->data()) = link_array(value);
+        shadow_->mark(zero, link_size);
+    }
+
     return true;
 }
 
@@ -117,7 +131,13 @@ bool CLASS::set_body_count(const Link& count) NOEXCEPT
 TEMPLATE
 inline Link CLASS::index(const Key& key) const NOEXCEPT
 {
-    return keys::bucket(key, buckets_.value);
+    const auto buckets = buckets_.load(std::memory_order_relaxed);
+    const auto bucket = keys::bucket(key, buckets);
+    if (system::is_null(shadow_) || bucket >= migrated_)
+        return bucket;
+
+    // Keys of migrated buckets resolve to shadow (following head buckets).
+    return buckets + keys::bucket(key, shadow_buckets_);
 }
 
 TEMPLATE
@@ -129,7 +149,14 @@ inline Link CLASS::top(const Link& index) const NOEXCEPT
 TEMPLATE
 inline Link CLASS::top(const Key& key) const NOEXCEPT
 {
-    const auto value = get_cell(index(key));
+    return top(index(key), key);
+}
+
+TEMPLATE
+inline Link CLASS::top(const Link& index, const Key& key) const NOEXCEPT
+{
+    BC_ASSERT(index == this->index(key));
+    const auto value = get_cell(index);
     if (screened(value, keys::thumb(key)))
         return to_link(value);
 
@@ -138,6 +165,17 @@ inline Link CLASS::top(const Key& key) const NOEXCEPT
     return {};
 }
 
+TEMPLATE
+inline void CLASS::prefetch(const Link& index) const NOEXCEPT
+{
+    // Hint only, allows multiple independent cell misses to be in flight.
+    auto bucket = index.value;
+    const auto& file = to_file(bucket);
+    const auto raw = file.get_raw(link_to_position(bucket));
+    if (!system::is_null(raw))
+        database::prefetch(raw);
+}
+
 TEMPLATE
 inline bool CLASS::push(const Link& current, bytes& next,
     const Key& key) NOEXCEPT
@@ -154,15 +192,169 @@ inline bool CLASS::push(bool& collision, const Link& current, bytes& next,
     return set_cell(collision, next, current, key);
 }
 
+// rehash
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+bool CLASS::adopt() NOEXCEPT
+{
+    using namespace system;
+    // Disabled heads are not rehashable, so retain configured buckets.
+    if (buckets() <= one)
+        return true;
+
+    // A rehashed head is sized differently than configured.
+    const auto bytes = file_.size();
+    if (!is_null(shadow_) || is_zero(bytes) || !is_zero(bytes % cell_size))
+        return false;
+
+    // Head is [body_count][[bucket[0]...bucket[buckets-1]]], all cells.
+    const auto buckets = sub1(bytes / cell_size);
+    if (buckets <= one || buckets >= Link::terminal)
+        return false;
+
+    buckets_.store(possible_narrow_cast<link>(buckets),
+        std::memory_order_relaxed);
+    return true;
+}
+
+TEMPLATE
+bool CLASS::begin_rehash(storage& shadow, size_t buckets) NOEXCEPT
+{
+    using namespace system;
+    const auto current = this->buckets();
+    if (!is_null(shadow_) || current <= one || buckets <= one ||
+        is_nonzero(shadow.size()) || is_add_overflow(current, buckets) ||
+        (current + buckets) > Link::terminal)
+        return false;
+
+    const auto allocation = link_to_position(
+        possible_narrow_cast<link>(buckets));
+    const auto start = shadow.allocate(allocation);
+    if (start == storage::eof)
+        return false;
+
+    const auto ptr = shadow.get(start);
+    const auto head = file_.get();
+    if (!ptr || !head)
+        return false;
+
+    // Shadow is created as is the head, and carries the current body count.
+    std::fill_n(ptr->data(), allocation, bit_all<uint8_t>);
+    link_array(ptr->data()) = link_array(head->data());
+    shadow.mark(start, allocation);
+
+    shadow_ = &shadow;
+    shadow_buckets_ = possible_narrow_cast<link>(buckets);
+    migrated_ = zero;
+    return true;
+}
+
+TEMPLATE
+inline bool CLASS::is_rehashing() const NOEXCEPT
+{
+    return !system::is_null(shadow_);
+}
+
+TEMPLATE
+inline size_t CLASS::migrated() const NOEXCEPT
+{
+    return migrated_;
+}
+
+TEMPLATE
+inline size_t CLASS::span() const NOEXCEPT
+{
+    // Migrated head buckets are vacated, their lists follow in the shadow.
+    return buckets() + shadow_buckets_;
+}
+
+TEMPLATE
+bool CLASS::migrate(Link& top) NOEXCEPT
+{
+    if (system::is_null(shadow_) || migrated_ >= buckets())
+        return false;
+
+    using namespace system;
+    const auto position = link_to_position(migrated_);
+    const auto raw = file_.get_raw(position);
+    if (is_null(raw))
+        return false;
+
+    // Obtain top before advancing, as its keys then resolve to shadow.
+    top = to_link(get_cell(migrated_));
+
+    // Vacate the bucket (terminal), as its conflict list is to be relinked.
+    std::fill_n(raw, cell_size, bit_all<uint8_t>);
+    file_.mark(position, cell_size);
+    ++migrated_;
+    return true;
+}
+
+TEMPLATE
+bool CLASS::end_rehash() NOEXCEPT
+{
+    if (system::is_null(shadow_) || migrated_ < buckets())
+        return false;
+
+    // The head file is now the shadow file, so adopt its bucket count.
+    buckets_.store(shadow_buckets_, std::memory_order_relaxed);
+    shadow_ = nullptr;
+    shadow_buckets_ = zero;
+    migrated_ = zero;
+    return verify();
+}
+
+TEMPLATE
+bool CLASS::abort_rehash(std::vector<Link>& tops) NOEXCEPT
+{
+    if (system::is_null(shadow_))
+        return false;
+
+    // Shadow lists are obtained before release, as shadow is then unmapped.
+    tops.clear();
+    const auto buckets = this->buckets();
+    for (link bucket{}; bucket < shadow_buckets_; ++bucket)
+    {
+        // An unmapped shadow cannot be read (get_cell would imply terminal).
+        if (system::is_null(shadow_->get_raw(link_to_position(bucket))))
+            return false;
+
+        const auto top = to_link(get_cell(buckets + bucket));
+        if (top != Link::terminal)
+            tops.push_back(top);
+    }
+
+    // All keys again resolve to head buckets (migrated buckets are vacated).
+    shadow_ = nullptr;
+    shadow_buckets_ = zero;
+    migrated_ = zero;
+    return true;
+}
+
 // protected
 // ----------------------------------------------------------------------------
 // read/write
 
+TEMPLATE
+inline storage& CLASS::to_file(link& index) const NOEXCEPT
+{
+    // Shadow buckets follow head buckets, rebase index to shadow file.
+    const auto buckets = this->buckets();
+    if (system::is_null(shadow_) || index < buckets)
+        return file_;
+
+    index -= buckets;
+    return *shadow_;
+}
+
 TEMPLATE
 inline CLASS::cell CLASS::get_cell(const Link& index) const NOEXCEPT
 {
     using namespace system;
-    const auto raw = file_.get_raw(link_to_position(index));
+    auto bucket = index.value;
+    const auto& file = to_file(bucket);
+    const auto raw = file.get_raw(link_to_position(bucket));
     if (is_null(raw))
         return terminal;
 
@@ -195,10 +387,15 @@ inline bool CLASS::set_cell(bool& collision, bytes& next, const Link& current,
     const Key& key) NOEXCEPT
 {
     using namespace system;
-    const auto raw = file_.get_raw(link_to_position(index(key)));
+    auto bucket = index(key).value;
+    auto& file = to_file(bucket);
+    const auto position = link_to_position(bucket);
+    const auto raw = file.get_raw(position);
     if (is_null(raw))
         return false;
 
+    file.mark(position, cell_size);
+
     const auto entropy = keys::thumb(key);
     if constexpr (aligned)
     {
@@ -21,6 +21,7 @@
 
 #include <atomic>
 #include <algorithm>
+#include <span>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -86,6 +87,14 @@ size_t CLASS::buckets() const NOEXCEPT
     return head_.buckets();
 }
 
+TEMPLATE
+size_t CLASS::span() const NOEXCEPT
+{
+    // Shadow is guarded by body access (see rehash).
+    const auto ptr = get_memory();
+    return ptr ? head_.span() : zero;
+}
+
 TEMPLATE
 size_t CLASS::head_size() const NOEXCEPT
 {
@@ -131,6 +140,90 @@ size_t CLASS::negative_search_count() const NOEXCEPT
     return negative_.load(std::memory_order_relaxed);
 }
 
+TEMPLATE
+bool CLASS::get_statistics(hash_statistics& out, size_t samples) const NOEXCEPT
+{
+    using namespace system;
+    constexpr auto range = 4096_size;
+    constexpr auto last_bin = sub1(hash_statistics::bins);
+    constexpr auto relaxed = std::memory_order_relaxed;
+    constexpr auto parallel = poolstl::execution::par;
+
+    out = {};
+    out.buckets = head_.buckets();
+    out.body_count = body_.count();
+    if (!enabled())
+        return true;
+
+    const auto buckets = out.buckets;
+    const auto stride = is_zero(samples) ? max_size_t :
+        std::max(one, buckets / samples);
+
+    stopper fail{};
+    const auto ranges = ceilinged_divide(buckets, range);
+    std::vector<hash_statistics> parts(ranges);
+    std::vector<size_t> it(ranges);
+    std::iota(it.begin(), it.end(), zero);
+    std::for_each(parallel, it.cbegin(), it.cend(), [&](size_t index) NOEXCEPT
+    {
+        // Remap (allocation) is blocked only during the scan of each range.
+        const auto ptr = get_memory();
+        if (!ptr)
+        {
+            fail.store(true, relaxed);
+            return;
+        }
+
+        auto& part = parts.at(index);
+        const auto start = index * range;
+        const auto end = std::min(buckets, start + range);
+        for (auto bucket = start; bucket < end; ++bucket)
+        {
+            size_t length{};
+            const auto sampled = is_zero(bucket % stride);
+            using integer = typename Link::integer;
+            const Link index = possible_narrow_cast<integer>(bucket);
+            for (auto link = head_.top(index); !link.is_terminal(); ++length)
+            {
+                const auto offset = ptr->offset(body::link_to_position(link));
+                if (is_null(offset))
+                {
+                    fail.store(true, relaxed);
+                    return;
+                }
+
+                if (sampled)
+                    sample(part, ptr, unsafe_array_cast<uint8_t, key_size>(
+                        std::next(offset, Link::size)));
+
+                link = unsafe_array_cast<uint8_t, Link::size>(offset);
+            }
+
+            ++part.chains.at(std::min(length, last_bin));
+            part.elements += length;
+            part.longest = std::max(part.longest, length);
+        }
+    });
+
+    if (fail.load(relaxed))
+        return false;
+
+    for (const auto& part: parts)
+    {
+        for (size_t bin{}; bin < hash_statistics::bins; ++bin)
+            out.chains.at(bin) += part.chains.at(bin);
+
+        out.elements += part.elements;
+        out.longest = std::max(out.longest, part.longest);
+        out.lookups += part.lookups;
+        out.probes += part.probes;
+        out.filter_hits += part.filter_hits;
+        out.filter_misses += part.filter_misses;
+    }
+
+    return true;
+}
+
 // query interface
 // ----------------------------------------------------------------------------
 
@@ -152,13 +245,130 @@ code CLASS::reload() NOEXCEPT
     return body_.reload();
 }
 
+// rehash
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+bool CLASS::adopt() NOEXCEPT
+{
+    return head_.adopt();
+}
+
+TEMPLATE
+bool CLASS::begin_rehash(storage& shadow, size_t buckets) NOEXCEPT
+{
+    const auto ptr = body_.get_exclusive();
+    return ptr && head_.begin_rehash(shadow, buckets);
+}
+
+TEMPLATE
+bool CLASS::rehash(bool& complete, size_t buckets) NOEXCEPT
+{
+    using namespace system;
+
+    // Exclusive body access blocks all readers (including iterators).
+    const auto ptr = body_.get_exclusive();
+    if (!ptr || !head_.is_rehashing())
+        return false;
+
+    Link top{};
+    std::vector<Link> list{};
+    for (size_t bucket{}; bucket < buckets && head_.migrate(top); ++bucket)
+    {
+        // Collect the conflict list of the migrated bucket.
+        list.clear();
+        for (auto link = top; !link.is_terminal();)
+        {
+            const auto offset = ptr->offset(body::link_to_position(link));
+            if (is_null(offset))
+                return false;
+
+            list.push_back(link);
+            link = unsafe_array_cast<uint8_t, Link::size>(offset);
+        }
+
+        // Reinsert from the bottom, preserving conflict list order by key.
+        // Keys of the migrated bucket now resolve to shadow buckets.
+        for (auto it = list.rbegin(); it != list.rend(); ++it)
+        {
+            const auto offset = ptr->offset(body::link_to_position(*it));
+            auto& next = unsafe_array_cast<uint8_t, Link::size>(offset);
+            const auto key = keys::read<Key>(unsafe_array_cast<uint8_t,
+                key_size>(std::next(offset, Link::size)));
+
+            if (!head_.push(*it, next, key))
+                return false;
+        }
+    }
+
+    complete = (head_.migrated() == head_.buckets());
+    return true;
+}
+
+TEMPLATE
+bool CLASS::end_rehash(const std::function<bool()>& replace) NOEXCEPT
+{
+    // Obtained before exclusive access to preclude lock order inversion.
+    if (!head_.set_body_count(body_.count()))
+        return false;
+
+    const auto ptr = body_.get_exclusive();
+    return ptr && replace() && head_.end_rehash();
+}
+
+TEMPLATE
+bool CLASS::abort_rehash() NOEXCEPT
+{
+    using namespace system;
+
+    // Exclusive body access blocks all readers (including iterators).
+    const auto ptr = body_.get_exclusive();
+    std::vector<Link> tops{};
+    if (!ptr || !head_.abort_rehash(tops))
+        return false;
+
+    std::vector<Link> list{};
+    for (const auto& top: tops)
+    {
+        // Collect the conflict list of the shadow bucket.
+        list.clear();
+        for (auto link = top; !link.is_terminal();)
+        {
+            const auto offset = ptr->offset(body::link_to_position(link));
+            if (is_null(offset))
+                return false;
+
+            list.push_back(link);
+            link = unsafe_array_cast<uint8_t, Link::size>(offset);
+        }
+
+        // Reinsert from the bottom, preserving conflict list order by key.
+        // Keys of all buckets now resolve to (vacated) head buckets.
+        for (auto it = list.rbegin(); it != list.rend(); ++it)
+        {
+            const auto offset = ptr->offset(body::link_to_position(*it));
+            auto& next = unsafe_array_cast<uint8_t, Link::size>(offset);
+            const auto key = keys::read<Key>(unsafe_array_cast<uint8_t,
+                key_size>(std::next(offset, Link::size)));
+
+            if (!head_.push(*it, next, key))
+                return false;
+        }
+    }
+
+    return true;
+}
+
 // query interface
 // ----------------------------------------------------------------------------
 
 TEMPLATE
 inline Link CLASS::top(const Link& link) const NOEXCEPT
 {
-    if (link >= head_.buckets())
+    // Head is read under body access, guarded against concurrent rehash.
+    // Shadow buckets follow head buckets, so scanning span covers migration.
+    const auto ptr = get_memory();
+    if (!ptr || link >= head_.span())
         return {};
 
     return head_.top(link);
@@ -188,11 +398,107 @@ inline Link CLASS::first(const Key& key) const NOEXCEPT
     return first(get_memory(), key);
 }
 
+TEMPLATE
+bool CLASS::exists_many(std::span<const Key> keys,
+    std::span<bool> found) const NOEXCEPT
+{
+    if (keys.size() != found.size())
+        return false;
+
+    std::vector<Link> links(keys.size());
+    if (!first_many(keys, links))
+        return false;
+
+    std::transform(links.begin(), links.end(), found.begin(),
+        [](const Link& link) NOEXCEPT { return !link.is_terminal(); });
+
+    return true;
+}
+
+TEMPLATE
+bool CLASS::first_many(std::span<const Key> keys,
+    std::span<Link> links) const NOEXCEPT
+{
+    using namespace system;
+    if (keys.size() != links.size())
+        return false;
+
+    // One remap guard is held across the whole batch.
+    const auto ptr = get_memory();
+    if (!ptr)
+        return false;
+
+    const auto count = keys.size();
+    const auto prefetch_row = [&ptr](const Link& link) NOEXCEPT
+    {
+        const auto offset = ptr->offset(body::link_to_position(link));
+        if (!is_null(offset))
+            database::prefetch(offset);
+    };
+
+    // Hash all keys and prefetch all head cells (independent misses).
+    for (size_t index{}; index < count; ++index)
+    {
+        links[index] = head_.index(keys[index]);
+        head_.prefetch(links[index]);
+    }
+
+    // Screen each (now cached) cell and prefetch its top body row.
+    std::vector<size_t> pending{};
+    pending.reserve(count);
+    for (size_t index{}; index < count; ++index)
+    {
+        links[index] = head_.top(links[index], keys[index]);
+        if (!links[index].is_terminal())
+        {
+            prefetch_row(links[index]);
+            pending.push_back(index);
+        }
+    }
+
+    // Advance each unresolved key one row per round, prefetching the next.
+    while (!pending.empty())
+    {
+        auto unresolved = pending.begin();
+        for (const auto index: pending)
+        {
+            auto& link = links[index];
+
+            // get element offset (fault)
+            const auto offset = ptr->offset(body::link_to_position(link));
+            if (is_null(offset))
+            {
+                link = {};
+                continue;
+            }
+
+            // element key matches (found)
+            if (keys::compare(unsafe_array_cast<uint8_t, key_size>(
+                std::next(offset, Link::size)), keys[index]))
+                continue;
+
+            // set next element link (not found if terminal)
+            link = unsafe_array_cast<uint8_t, Link::size>(offset);
+            if (link.is_terminal())
+                continue;
+
+            prefetch_row(link);
+            *unresolved++ = index;
+        }
+
+        pending.erase(unresolved, pending.end());
+    }
+
+    return true;
+}
+
 TEMPLATE
 inline typename CLASS::iterator CLASS::it(Key&& key) const NOEXCEPT
 {
+    // Head is read under body access, guarded against concurrent rehash.
+    auto ptr = get_memory();
     const auto top = head_.top(key);
-    return { get_memory(), top, std::forward<Key>(key) };
+    return { std::move(ptr), top, std::forward<Key>(key) };
 }
 
 TEMPLATE
@@ -305,13 +611,11 @@ bool CLASS::set(const memory_ptr& ptr, const Link& link, const Key& key,
     if (is_null(offset))
         return false;
 
-    // Set element search key.
-    unsafe_array_cast<uint8_t, key_size>(std::next(offset,
-        Link::size)) = key;
-
+    // Set element search key (next is skipped, set by commit).
     iostream stream{ offset, size - position };
     finalizer sink{ stream };
-    sink.skip_bytes(index_size);
+    sink.skip_bytes(Link::size);
+    keys::write(sink, key);
 
     if constexpr (!is_slab) { BC_DEBUG_ONLY(sink.set_limit(RowSize * element.count());) }
     return element.to_data(sink);
@@ -446,6 +750,30 @@ bool CLASS::commit(const memory_ptr& ptr, const Link& link,
     return head_.push(link, next, key);
 }
 
+TEMPLATE
+bool CLASS::commit(bool& duplicate, const memory_ptr& ptr, const Link& link,
+    const Key& key) NOEXCEPT
+{
+    using namespace system;
+    if (!ptr)
+        return false;
+
+    // get element offset (fault)
+    const auto offset = ptr->offset(body::link_to_position(link));
+    if (is_null(offset))
+        return false;
+
+    // Commit element to search index (terminal is a valid bucket index).
+    bool search{};
+    auto& next = unsafe_array_cast<uint8_t, Link::size>(offset);
+    if (!head_.push(search, link, next, key))
+        return false;
+
+    // Search the previous conflicts to determine if actual duplicate.
+    duplicate = search && !first(ptr, Link{ next }, key).is_terminal();
+    return true;
+}
+
 // protected
 // ----------------------------------------------------------------------------
 
@@ -563,6 +891,59 @@ bool CLASS::write(Link& previous, const memory_ptr& ptr, const Link& link,
     return true;
 }
 
+// private
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+size_t CLASS::probes(const memory_ptr& ptr, Link link, const Key& key) NOEXCEPT
+{
+    using namespace system;
+    size_t count{};
+    while (!link.is_terminal())
+    {
+        const auto offset = ptr->offset(body::link_to_position(link));
+        if (is_null(offset))
+            break;
+
+        ++count;
+        if (keys::compare(unsafe_array_cast<uint8_t, key_size>(
+            std::next(offset, Link::size)), key))
+            break;
+
+        link = unsafe_array_cast<uint8_t, Link::size>(offset);
+    }
+
+    return count;
+}
+
+TEMPLATE
+void CLASS::sample(hash_statistics& out, const memory_ptr& ptr,
+    const key_bytes& bytes) const NOEXCEPT
+{
+    using namespace system;
+
+    // Existing key, count of elements visited to find it.
+    const auto key = keys::read<Key>(bytes);
+    out.probes += probes(ptr, head_.top(key), key);
+    ++out.lookups;
+
+    // Key of inverted bytes is presumed absent, counted if bucket occupied.
+    key_bytes inverse{};
+    std::transform(bytes.begin(), bytes.end(), inverse.begin(),
+        [](uint8_t byte) NOEXCEPT { return bit_not(byte); });
+
+    const auto absent = keys::read<Key>(inverse);
+    const auto index = head_.index(absent);
+    if (head_.top(index).is_terminal())
+        return;
+
+    const auto top = head_.top(index, absent);
+    if (top.is_terminal())
+        ++out.filter_hits;
+    else if (first(ptr, top, absent).is_terminal())
+        ++out.filter_misses;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
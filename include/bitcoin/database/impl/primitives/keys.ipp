@@ -144,6 +144,32 @@ INLINE void write(writer& sink, const Key& key) NOEXCEPT
     }
 }
 
+template <class Key, class Array>
+INLINE Key read(const Array& bytes) NOEXCEPT
+{
+    using namespace system;
+    static_assert(size<Key>() <= array_count<Array>);
+    if constexpr (is_same_type<Key, chain::point>)
+    {
+        // Index is truncated to three bytes (all bits set is null).
+        constexpr uint32_t null_index = 0x00ffffff;
+        const auto index = bit_or<uint32_t>(bit_or<uint32_t>(
+            bytes.at(hash_size + 0),
+            shift_left<uint32_t>(bytes.at(hash_size + 1), byte_bits)),
+            shift_left<uint32_t>(bytes.at(hash_size + 2), two * byte_bits));
+
+        return
+        {
+            array_cast<uint8_t, hash_size>(bytes),
+            index == null_index ? chain::point::null_index : index
+        };
+    }
+    else if constexpr (is_std_array<Key>)
+    {
+        return array_cast<uint8_t, size<Key>()>(bytes);
+    }
+}
+
 template <class Array, class Key>
 INLINE bool compare(const Array& bytes, const Key& key) NOEXCEPT
 {
@@ -60,6 +60,13 @@ inline memory_ptr CLASS::get_capacity(const Link& link) const NOEXCEPT
     return files_.get_capacity(link_to_position(link));
 }
 
+TEMPLATE
+template <size_t Columns, if_equal<Columns, one>>
+inline memory_ptr CLASS::get_exclusive() const NOEXCEPT
+{
+    return files_.get_exclusive();
+}
+
 TEMPLATE
 CLASS::managers(storage& body) NOEXCEPT
   : files_(body)
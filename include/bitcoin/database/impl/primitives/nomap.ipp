@@ -127,6 +127,12 @@ bool CLASS::reserve(const Link& size) NOEXCEPT
     return manager_.reserve(size);
 }
 
+TEMPLATE
+inline Link CLASS::allocate(const Link& size) NOEXCEPT
+{
+    return manager_.allocate(size);
+}
+
 TEMPLATE
 memory_ptr CLASS::get_memory() const NOEXCEPT
 {
@@ -234,6 +240,40 @@ bool CLASS::put(const memory_ptr& ptr, const Element& element) NOEXCEPT
     return element.to_data(sink);
 }
 
+// static
+TEMPLATE
+template <typename Element, if_equal<Element::size, Size>>
+bool CLASS::put(const memory_ptr& ptr, const Link& link,
+    const Element& element) NOEXCEPT
+{
+    using namespace system;
+    if (!ptr || link.is_terminal())
+        return false;
+
+    const auto start = manager::link_to_position(link);
+    if (is_limited<ptrdiff_t>(start))
+        return false;
+
+    const auto size = ptr->size();
+    const auto position = possible_narrow_and_sign_cast<ptrdiff_t>(start);
+    if (position >= size)
+        return false;
+
+    const auto offset = ptr->offset(start);
+    if (is_null(offset))
+        return false;
+
+    iostream stream{ offset, size - position };
+    flipper sink{ stream };
+
+    if constexpr (!is_slab)
+    {
+        BC_DEBUG_ONLY(sink.set_limit(Size * element.count());)
+    }
+
+    return element.to_data(sink);
+}
+
 TEMPLATE
 template <typename Element, if_equal<Element::size, Size>>
 inline bool CLASS::put_link(Link& link, const Element& element) NOEXCEPT
@@ -50,6 +50,15 @@ TEMPLATE
 code CLASS::get_confirmed_balance(const stopper& cancel, uint64_t& out,
     const hash_digest& key, bool turbo) const NOEXCEPT
 {
+    // Summary is maintained by confirmation, so balance is constant time.
+    if (summary_enabled())
+    {
+        address_summary summary{};
+        const auto ec = get_address_summary(summary, key);
+        out = summary.balance;
+        return ec;
+    }
+
     outpoints outs{};
     if (const auto ec = get_confirmed_unspent_outpoints(cancel, outs, key,
         turbo))
@@ -21,6 +21,8 @@
 
 #include <atomic>
 #include <algorithm>
+#include <iterator>
+#include <numeric>
 #include <ranges>
 #include <utility>
 #include <bitcoin/database/define.hpp>
@@ -58,19 +60,23 @@ code CLASS::get_unconfirmed_history(const stopper& cancel, histories& out,
 }
 
 // ununsed
+// Bounded by activity since cursor when the activity table is enabled.
 TEMPLATE
 code CLASS::get_confirmed_history(const stopper& cancel, height_link& cursor,
     histories& out, const hash_digest& key, size_t limit,
     bool turbo) const NOEXCEPT
 {
+    // End is required because of the possiblity of intervening organization.
+    const auto start = cursor.is_terminal() ? zero : cursor.value;
+    const auto end = get_top_confirmed();
+
     tx_links txs{};
-    if (const auto ec = get_address_txs(cancel, txs, key, limit))
+    if (const auto ec = activity_enabled() ?
+        get_activity_txs(cancel, txs, key, start, limit) :
+        get_address_txs(cancel, txs, key, limit))
         return ec;
 
     // Cursor is still advanced in the case of (integrity) failure.
-    // End is required because of the possiblity of intervening organization.
-    const auto start = cursor.is_terminal() ? zero : cursor.value;
-    const auto end = get_top_confirmed();
     cursor = system::possible_narrow_cast<height_link::integer>(add1(end));
 
     out.clear();
@@ -113,6 +119,71 @@ code CLASS::get_history(const stopper& cancel, height_link& cursor,
         });
 }
 
+// server/electrum
+// get_history of each key (grouped by key), with each tx read once.
+TEMPLATE
+code CLASS::get_history_many(const stopper& cancel, height_link& cursor,
+    history_sets& out, const hashes& keys, size_t limit,
+    bool turbo) const NOEXCEPT
+{
+    std::vector<tx_links> sets{};
+    if (const auto ec = parallel_key_transform(cancel, turbo, sets, keys,
+        [this, &cancel, limit](const hash_digest& key, tx_links& txs) NOEXCEPT
+        {
+            return get_address_txs(cancel, txs, key, limit);
+        }))
+        return ec;
+
+    // Cursor is still advanced in the case of (integrity) failure.
+    // End is required because of the possiblity of intervening organization.
+    const auto start = cursor.is_terminal() ? zero : cursor.value;
+    const auto end = get_top_confirmed();
+    cursor = system::possible_narrow_cast<height_link::integer>(add1(end));
+
+    // Wallet addresses commonly share txs (e.g. payment and change).
+    tx_links txs{};
+    for (const auto& set: sets)
+        txs.insert(txs.end(), set.begin(), set.end());
+
+    std::sort(txs.begin(), txs.end());
+    txs.erase(std::unique(txs.begin(), txs.end()), txs.end());
+
+    stopper fail{};
+    histories states(txs.size());
+    const auto policy = poolstl::execution::par_if(turbo);
+    std::transform(policy, txs.cbegin(), txs.cend(), states.begin(),
+        [&](const tx_link& link) NOEXCEPT
+        {
+            if (cancel || fail) return history{};
+            const auto out = this->get_tx_history(link, start, end);
+            if (out.fault()) fail = true;
+            return out;
+        });
+
+    if (fail)
+        return error::integrity;
+
+    if (cancel)
+        return error::query_canceled;
+
+    out.clear();
+    out.resize(keys.size());
+    std::vector<size_t> it(keys.size());
+    std::iota(it.begin(), it.end(), zero);
+    std::for_each(policy, it.cbegin(), it.cend(), [&](size_t offset) NOEXCEPT
+    {
+        auto& set = out.at(offset);
+        set.reserve(sets.at(offset).size());
+        for (const auto& tx: sets.at(offset))
+            set.push_back(states.at(std::distance(txs.begin(),
+                std::lower_bound(txs.begin(), txs.end(), tx))));
+
+        history::filter_sort_and_dedup(set);
+    });
+
+    return error::success;
+}
+
 // get_tx_history
 // ----------------------------------------------------------------------------
 
@@ -261,6 +332,38 @@ code CLASS::get_address_txs(const stopper& cancel, tx_links& out,
     return to_touched_txs(cancel, out, links);
 }
 
+// Activity is appended upon confirmation and never popped, so any entry
+// below start that follows (newer than) a confirmed entry at or above start
+// implies its reorganization. Stale entries are filtered by history.
+TEMPLATE
+code CLASS::get_activity_txs(const stopper& cancel, tx_links& out,
+    const hash_digest& key, size_t start, size_t limit) const NOEXCEPT
+{
+    out.clear();
+    for (auto it = store_.activity.it(key); it; ++it)
+    {
+        if (cancel)
+            return error::query_canceled;
+
+        table::activity::record activity{};
+        if (!store_.activity.get(it, activity))
+            return error::integrity;
+
+        if (activity.height < start)
+            break;
+
+        if (is_zero(limit--))
+            return error::depth_limited;
+
+        out.push_back(activity.tx_fk);
+    }
+
+    // A reorganized tx may be confirmed again.
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return error::success;
+}
+
 // private/static
 TEMPLATE
 template <typename Functor>
@@ -0,0 +1,300 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_QUERY_ADDRESS_SUMMARY_IPP
+#define LIBBITCOIN_DATABASE_QUERY_ADDRESS_SUMMARY_IPP
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <utility>
+#include <vector>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// Address summary
+// ----------------------------------------------------------------------------
+// Summaries are superseded upon each confirmation that touches the address.
+// A summary is current only while its block is confirmed at its height, so
+// the latest current summary of an address is its state as of the top
+// confirmed block. Reorganization and incomplete confirmation (summaries are
+// written before the block is committed as confirmed) leave summaries that
+// are skipped upon read and superseded upon subsequent confirmation.
+
+// server/electrum
+TEMPLATE
+code CLASS::get_address_summary(address_summary& out,
+    const hash_digest& key) const NOEXCEPT
+{
+    out = {};
+    if (!summary_enabled())
+        return error::not_found;
+
+    // An address never confirmed has no summary (default).
+    return get_current_summary(out, key) ? error::success : error::integrity;
+}
+
+// server/electrum
+TEMPLATE
+code CLASS::get_address_status(const stopper& cancel, hash_digest& out,
+    const hash_digest& key, bool turbo) const NOEXCEPT
+{
+    out = {};
+    address_summary summary{};
+    if (const auto ec = get_address_summary(summary, key))
+        return ec;
+
+    // Unconfirmed history follows confirmed, in electrum sort.
+    histories unconfirmed{};
+    if (const auto ec = get_unconfirmed_history(cancel, unconfirmed, key,
+        max_size_t, turbo))
+        return ec;
+
+    // The confirmed midstate is extended by copy and then finalized.
+    auto& status = summary.status;
+    for (const auto& history: unconfirmed)
+        status.write(history.tx.hash(), history.tx.height());
+
+    out = status.finalize();
+    return error::success;
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+bool CLASS::is_current(const address_summary& summary,
+    const header_link& link) const NOEXCEPT
+{
+    table::height::record confirmed{};
+    return store_.confirmed.get(summary.height, confirmed) &&
+        (confirmed.header_fk == link);
+}
+
+TEMPLATE
+bool CLASS::get_current_summary(address_summary& out,
+    const hash_digest& key) const NOEXCEPT
+{
+    // Iterator holds remap lock, so it must be released before put.
+    for (auto it = store_.summary.it(key); it; ++it)
+    {
+        table::summary::record record{};
+        if (!store_.summary.get(it, record))
+            return false;
+
+        if (is_current(record.summary, record.header_fk))
+        {
+            out = std::move(record.summary);
+            return true;
+        }
+    }
+
+    out = {};
+    return true;
+}
+
+TEMPLATE
+bool CLASS::push_summaries(const summary_changes& changes,
+    const header_link& link, size_t height) NOEXCEPT
+{
+    using namespace system;
+    if (changes.empty())
+        return true;
+
+    // Batched summary hashmap search keeps multiple table misses in flight.
+    hashes keys(changes.size());
+    std::vector<summary_link> links(changes.size());
+    std::transform(changes.begin(), changes.end(), keys.begin(),
+        [](const auto& change) NOEXCEPT { return change.key; });
+    if (!store_.summary.first_many(keys, links))
+        return false;
+
+    for (size_t index{}; index < changes.size(); ++index)
+    {
+        const auto& change = changes.at(index);
+        table::summary::record record{};
+
+        // The latest summary is current unless superseded by reorganization
+        // or by incomplete confirmation, in which case the list is searched.
+        if (!links.at(index).is_terminal())
+        {
+            if (!store_.summary.get(links.at(index), record))
+                return false;
+
+            if (!is_current(record.summary, record.header_fk) &&
+                !get_current_summary(record.summary, change.key))
+                return false;
+        }
+
+        // Balance cannot be negative in a valid chain, so floor is benign.
+        auto& summary = record.summary;
+        summary.balance = floored_subtract(ceilinged_add(summary.balance,
+            change.received), change.sent);
+        summary.funded = ceilinged_add(summary.funded, change.funded);
+        summary.spent = ceilinged_add(summary.spent, change.spent);
+        summary.height = height;
+        record.header_fk = link;
+
+        // Electrum status preimage is extended by tx in block order.
+        for (const auto& tx: change.txs)
+            summary.status.write(tx, height);
+
+        // Allocation failure leaves summaries that are not current, since
+        // the block is not committed as confirmed until all are written.
+        if (!store_.summary.put(change.key, record))
+            return false;
+    }
+
+    return true;
+}
+
+TEMPLATE
+bool CLASS::push_activity(const summary_changes& changes,
+    size_t height) NOEXCEPT
+{
+    using namespace system;
+    using integer = table::activity::height_t::integer;
+    const auto at = possible_narrow_cast<integer>(height);
+
+    // Activity is not popped, stale entries are filtered upon read.
+    for (const auto& change: changes)
+    {
+        for (const auto& link: change.links)
+        {
+            // Clean single allocation failure (e.g. disk full).
+            const table::activity::record record{ {}, at, link };
+            if (!store_.activity.put(change.key, record))
+                return false;
+        }
+    }
+
+    return true;
+}
+
+TEMPLATE
+bool CLASS::get_summary_changes(summary_changes& out,
+    const header_link& link) const NOEXCEPT
+{
+    using namespace system;
+    constexpr auto parallel = poolstl::execution::par;
+    constexpr auto relaxed = std::memory_order_relaxed;
+
+    struct row
+    {
+        hash_digest key;
+        size_t position;
+        uint64_t value;
+        bool spend;
+    };
+
+    const auto links = to_transactions(link);
+    if (links.empty())
+        return false;
+
+    // Txs are read and populated concurrently, since prevouts are scattered
+    // across the store and would otherwise be read serially in confirmation.
+    std::vector<size_t> positions(links.size());
+    std::iota(positions.begin(), positions.end(), zero);
+    std::vector<std::vector<row>> sets(links.size());
+    hashes txs(links.size());
+    stopper fault{};
+
+    // One row for each output and each (populated) input prevout.
+    std::transform(parallel, positions.cbegin(), positions.cend(),
+        sets.begin(), [this, &links, &txs, &fault](size_t position) NOEXCEPT
+        {
+            std::vector<row> set{};
+            const auto tx = get_transaction(links.at(position), false);
+
+            // First tx is coinbase (not populated).
+            if (!tx || (!is_zero(position) && !populate_without_metadata(*tx)))
+            {
+                fault.store(true, relaxed);
+                return set;
+            }
+
+            txs.at(position) = tx->hash(false);
+            for (const auto& output: *tx->outputs_ptr())
+                set.push_back({ output->script().hash(), position,
+                    output->value(), false });
+
+            if (is_zero(position))
+                return set;
+
+            for (const auto& input: *tx->inputs_ptr())
+                set.push_back({ input->prevout->script().hash(), position,
+                    input->prevout->value(), true });
+
+            return set;
+        });
+
+    if (fault.load(relaxed))
+        return false;
+
+    // Rows are concatenated in block order.
+    std::vector<row> rows{};
+    for (auto& set: sets)
+        rows.insert(rows.end(), set.begin(), set.end());
+
+    // Stable sort retains tx order within each address.
+    std::stable_sort(rows.begin(), rows.end(),
+        [](const row& left, const row& right) NOEXCEPT
+        {
+            return left.key < right.key;
+        });
+
+    out.clear();
+    auto last = max_size_t;
+    for (const auto& row: rows)
+    {
+        if (out.empty() || out.back().key != row.key)
+        {
+            out.push_back({ row.key });
+            last = max_size_t;
+        }
+
+        auto& change = out.back();
+        if (row.spend)
+        {
+            change.sent = ceilinged_add(change.sent, row.value);
+            ++change.spent;
+        }
+        else
+        {
+            change.received = ceilinged_add(change.received, row.value);
+            ++change.funded;
+        }
+
+        // Rows of a tx are contiguous within an address.
+        if (row.position != last)
+        {
+            change.txs.push_back(txs.at(row.position));
+            change.links.push_back(links.at(row.position));
+            last = row.position;
+        }
+    }
+
+    return true;
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,125 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_QUERY_ADDRESS_TOUCHED_IPP
+#define LIBBITCOIN_DATABASE_QUERY_ADDRESS_TOUCHED_IPP
+
+#include <algorithm>
+#include <atomic>
+#include <utility>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// Touched addresses
+// ----------------------------------------------------------------------------
+// The set of address keys funded or spent by a block, so that subscription
+// notification is a single lookup per block (vs. a query per subscription).
+
+// server/electrum
+TEMPLATE
+bool CLASS::is_touched(const header_link& link) const NOEXCEPT
+{
+    return store_.touched.exists(to_touched(link));
+}
+
+// server/electrum
+TEMPLATE
+bool CLASS::get_touched(hashes& out, const header_link& link) const NOEXCEPT
+{
+    table::touched::get_keys touched{};
+    if (store_.touched.at(to_touched(link), touched))
+    {
+        out = std::move(touched.keys);
+        return true;
+    }
+
+    // Not stored (or not enabled), so compute from the archive.
+    return compute_touched(out, link);
+}
+
+// node/confirmer
+TEMPLATE
+bool CLASS::set_touched(const header_link& link) NOEXCEPT
+{
+    if (!touched_enabled())
+        return true;
+
+    hashes keys{};
+    if (!compute_touched(keys, link))
+        return false;
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // Clean single allocation failure (e.g. disk full).
+    return store_.touched.put(to_touched(link), table::touched::put_ref
+    {
+        {},
+        keys
+    });
+    // ========================================================================
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+bool CLASS::compute_touched(hashes& out,
+    const header_link& link) const NOEXCEPT
+{
+    // A block always has an output (coinbase), prevouts exclude coinbase.
+    auto outputs = to_block_prevouts(link);
+    const auto created = to_block_outputs(link);
+    if (created.empty())
+        return false;
+
+    outputs.insert(outputs.end(), created.begin(), created.end());
+
+    stopper fail{};
+    out.resize(outputs.size());
+    constexpr auto parallel = poolstl::execution::par;
+    constexpr auto relaxed = std::memory_order_relaxed;
+
+    // Hash scripts in place (terminal prevout implies missing).
+    std::transform(parallel, outputs.cbegin(), outputs.cend(), out.begin(),
+        [&](const auto& output_fk) NOEXCEPT
+        {
+            table::output::get_script_hash output{};
+            if (!fail.load(relaxed) && !store_.output.get(output_fk, output))
+                fail.store(true, relaxed);
+
+            return output.key;
+        });
+
+    if (fail.load(relaxed))
+    {
+        out.clear();
+        return false;
+    }
+
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return true;
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
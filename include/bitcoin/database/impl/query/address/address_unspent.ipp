@@ -21,6 +21,8 @@
 
 #include <atomic>
 #include <algorithm>
+#include <iterator>
+#include <numeric>
 #include <utility>
 #include <bitcoin/database/define.hpp>
 
@@ -109,6 +111,147 @@ code CLASS::get_unspent(const stopper& cancel, unspents& out,
         });
 }
 
+// server/electrum
+// get_unspent of each key (grouped by key), with each parent tx read once.
+TEMPLATE
+code CLASS::get_unspent_many(const stopper& cancel, unspent_sets& out,
+    const hashes& keys, bool turbo) const NOEXCEPT
+{
+    std::vector<output_links> sets{};
+    if (const auto ec = parallel_key_transform(cancel, turbo, sets, keys,
+        [this, &cancel](const hash_digest& key, output_links& outs) NOEXCEPT
+        {
+            return to_address_outputs(cancel, outs, key);
+        }))
+        return ec;
+
+    output_links outs{};
+    for (const auto& set: sets)
+        outs.insert(outs.end(), set.begin(), set.end());
+
+    struct parent_value
+    {
+        tx_link tx{};
+        uint64_t value{};
+    };
+
+    // Parent tx and value of each unspent output (terminal tx if spent).
+    stopper fail{};
+    std::vector<parent_value> parents(outs.size());
+    const auto policy = poolstl::execution::par_if(turbo);
+    std::transform(policy, outs.cbegin(), outs.cend(), parents.begin(),
+        [&](const output_link& link) NOEXCEPT
+        {
+            // Exclude if spent by any tx, confirmed or unconfirmed.
+            table::output::get_parent_value output{};
+            if (cancel || fail || is_spent(link))
+                return parent_value{};
+
+            if (!store_.output.get(link, output))
+            {
+                fail = true;
+                return parent_value{};
+            }
+
+            return parent_value{ output.parent_fk, output.value };
+        });
+
+    if (fail)
+        return error::integrity;
+
+    if (cancel)
+        return error::query_canceled;
+
+    // Wallet addresses commonly share txs (e.g. payment and change).
+    tx_links txs{};
+    txs.reserve(parents.size());
+    for (const auto& parent: parents)
+        if (!parent.tx.is_terminal())
+            txs.push_back(parent.tx);
+
+    std::sort(txs.begin(), txs.end());
+    txs.erase(std::unique(txs.begin(), txs.end()), txs.end());
+
+    // Hash, height and position of each tx (zero index and value).
+    unspents states(txs.size());
+    std::transform(policy, txs.cbegin(), txs.cend(), states.begin(),
+        [&](const tx_link& tx) NOEXCEPT
+        {
+            if (cancel || fail)
+                return unspent{};
+
+            auto hash = get_tx_key(tx);
+            auto height = unspent::unused_height;
+            auto position = unspent::unconfirmed_position;
+
+            const auto block = find_strong(tx);
+            const auto at = get_confirmed_height(block);
+            if ((hash == system::null_hash) || (!at.is_terminal() &&
+                !get_tx_position(position, tx, block)))
+            {
+                fail = true;
+                return unspent{};
+            }
+
+            if (!at.is_terminal())
+                height = at.value;
+
+            return unspent{ { { std::move(hash), zero }, zero }, height,
+                position };
+        });
+
+    if (fail)
+        return error::integrity;
+
+    if (cancel)
+        return error::query_canceled;
+
+    std::vector<size_t> it(outs.size());
+    std::iota(it.begin(), it.end(), zero);
+    unspents unspent_outs(outs.size());
+    std::transform(policy, it.cbegin(), it.cend(), unspent_outs.begin(),
+        [&](size_t offset) NOEXCEPT
+        {
+            // Spent outputs are filtered out.
+            const auto& parent = parents.at(offset);
+            if (cancel || fail || parent.tx.is_terminal())
+                return unspent{};
+
+            const auto index = to_output_index(parent.tx, outs.at(offset));
+            if (index == point::null_index)
+            {
+                fail = true;
+                return unspent{};
+            }
+
+            const auto& state = states.at(std::distance(txs.begin(),
+                std::lower_bound(txs.begin(), txs.end(), parent.tx)));
+
+            return unspent{ { { state.out.point().hash(), index },
+                parent.value }, state.height, state.position };
+        });
+
+    if (fail)
+        return error::integrity;
+
+    if (cancel)
+        return error::query_canceled;
+
+    // Partition by key, in the order of the flattened sets.
+    out.clear();
+    out.resize(keys.size());
+    auto begin = std::make_move_iterator(unspent_outs.begin());
+    for (size_t key{}; key < keys.size(); ++key)
+    {
+        const auto end = std::next(begin, sets.at(key).size());
+        out.at(key).assign(begin, end);
+        unspent::filter_sort_and_dedup(out.at(key));
+        begin = end;
+    }
+
+    return error::success;
+}
+
 // Unspent queries.
 // ----------------------------------------------------------------------------
 
@@ -219,6 +362,35 @@ code CLASS::parallel_unspent_transform(const stopper& cancel, bool turbo,
     return error::success;
 }
 
+TEMPLATE
+template <typename Links, typename Functor>
+code CLASS::parallel_key_transform(const stopper& cancel, bool turbo,
+    std::vector<Links>& out, const hashes& keys, Functor&& functor) NOEXCEPT
+{
+    const auto policy = poolstl::execution::par_if(turbo);
+    std::vector<code> codes(keys.size());
+    std::vector<size_t> it(keys.size());
+    std::iota(it.begin(), it.end(), zero);
+
+    out.clear();
+    out.resize(keys.size());
+    std::for_each(policy, it.cbegin(), it.cend(),
+        [&functor, &cancel, &codes, &out, &keys](size_t offset) NOEXCEPT
+        {
+            if (cancel)
+                codes.at(offset) = error::query_canceled;
+            else
+                codes.at(offset) = functor(keys.at(offset), out.at(offset));
+        });
+
+    // First failure in key order.
+    for (const auto& ec: codes)
+        if (ec)
+            return ec;
+
+    return error::success;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
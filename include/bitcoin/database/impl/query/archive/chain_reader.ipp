@@ -99,6 +99,10 @@ TEMPLATE
 typename CLASS::header::cptr CLASS::get_header(
     const header_link& link) const NOEXCEPT
 {
+    // Headers are immutable by link (links are reassigned only by restore).
+    if (const auto cached = store_.header_objects.get(link))
+        return cached;
+
     table::header::record_with_sk child{};
     if (!store_.header.get(link, child))
         return {};
@@ -121,6 +125,7 @@ typename CLASS::header::cptr CLASS::get_header(
     );
 
     ptr->set_hash(std::move(child.key));
+    store_.header_objects.put(link, ptr);
     return ptr;
 }
 
@@ -154,6 +159,12 @@ typename CLASS::transaction::cptr CLASS::get_transaction(const tx_link& link,
     bool witness) const NOEXCEPT
 {
     using namespace system;
+
+    // Only witness transactions are cached, as objects differ by witness.
+    if (witness)
+        if (const auto cached = store_.tx_objects.get(link))
+            return uncached(*cached);
+
     table::transaction::only_with_sk tx{};
     if (!store_.tx.get(link, tx))
         return {};
@@ -188,7 +199,12 @@ typename CLASS::transaction::cptr CLASS::get_transaction(const tx_link& link,
     // TODO: store caches sizes so these could be forwarded.
     // Witness hash is not retained by the store.
     ptr->set_nominal_hash(std::move(tx.key));
-    return ptr;
+    if (!witness || !store_.tx_objects.enabled())
+        return ptr;
+
+    // Cached object is never returned, as callers populate input metadata.
+    store_.tx_objects.put(link, ptr);
+    return uncached(*ptr);
 }
 
 // point_link->point
@@ -413,6 +429,56 @@ typename CLASS::point::cptr CLASS::make_point(hash_digest&& hash,
     return system::to_shared<point>(std::move(hash), index);
 }
 
+// object caches
+// ----------------------------------------------------------------------------
+
+// protected
+TEMPLATE
+void CLASS::uncache(const header_link& link) const NOEXCEPT
+{
+    store_.header_objects.erase(link);
+    if (store_.tx_objects.enabled())
+        for (const auto& tx: to_transactions(link))
+            store_.tx_objects.erase(tx);
+}
+
+// protected
+TEMPLATE
+typename CLASS::transaction::cptr CLASS::uncached(
+    const transaction& tx) const NOEXCEPT
+{
+    using namespace system;
+    const auto& ins = *tx.inputs_ptr();
+    const auto inputs = to_shared<chain::input_cptrs>();
+    inputs->reserve(ins.size());
+
+    // Scripts, witnesses and outputs are immutable and so remain shared.
+    for (const auto& in: ins)
+    {
+        const auto ptr = to_shared<input>
+        (
+            to_shared<point>(in->point()),
+            in->script_ptr(),
+            in->witness_ptr(),
+            in->sequence()
+        );
+
+        ptr->metadata.point_link = in->metadata.point_link;
+        inputs->push_back(ptr);
+    }
+
+    const auto ptr = to_shared<transaction>
+    (
+        tx.version(),
+        inputs,
+        tx.outputs_ptr(),
+        tx.locktime()
+    );
+
+    ptr->set_nominal_hash(tx.hash(false));
+    return ptr;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -20,8 +20,10 @@
 #define LIBBITCOIN_DATABASE_QUERY_ARCHIVE_CHAIN_WRITER_IPP
 
 #include <algorithm>
+#include <atomic>
 #include <ranges>
 #include <utility>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -232,8 +234,276 @@ code CLASS::set_code(const tx_link& tx_fk, const transaction& tx,
 
     // Commit tx to search (hashmap).
     // tx.get_hash() assumes cached or is not thread safe.
-    return store_.tx.commit(tx_fk, tx.get_hash(false)) ?
-        error::success : error::tx_tx_commit;
+    if (!store_.tx.commit(tx_fk, tx.get_hash(false)))
+        return error::tx_tx_commit;
+
+    // Index spends once searchable (spender and funder may be in any order).
+    return set_spends(tx_fk) ? error::success : error::tx_spend_put;
+    // ========================================================================
+}
+
+// set transactions (group commit)
+// ----------------------------------------------------------------------------
+// Equivalent to set_code(tx_fk++, tx, bypass) over txs, with identical store
+// effect, but each table is allocated once for all txs, txs are serialized
+// concurrently into precomputed offsets, and searchable (hashmap) elements
+// are committed in a final sequential pass (preserving conflict list order).
+
+TEMPLATE
+code CLASS::set_code(const tx_link& tx_fks, const transactions& txs,
+    bool bypass) NOEXCEPT
+{
+    using namespace system;
+    using ix = linkage<schema::index>;
+    constexpr auto parallel = poolstl::execution::par;
+    constexpr auto value_parent = sizeof(uint64_t) - tx_link::size;
+
+    // Offsets are relative to the first element of each table allocation.
+    struct slot
+    {
+        const transaction& tx;
+        const hash_digest key;
+        const tx_link::integer tx_fk;
+        input_link::integer in_fk{};
+        output_link::integer out_fk{};
+        ins_link::integer ins_fk{};
+        outs_link::integer outs_fk{};
+        code ec{};
+    };
+
+    // Sequentially size all tables and assign each tx its relative offsets.
+    // tx.get_hash() assumes cached or is not thread safe.
+    std::vector<slot> slots{};
+    slots.reserve(txs.size());
+    size_t input_bytes{}, output_bytes{}, inputs{}, outputs{};
+    auto fk = tx_fks;
+    for (const auto& tx: txs)
+    {
+        if (tx->is_empty())
+            return error::tx_empty;
+
+        slots.push_back(
+        {
+            *tx,
+            tx->get_hash(false),
+            fk++,
+            possible_narrow_cast<input_link::integer>(input_bytes),
+            possible_narrow_cast<output_link::integer>(output_bytes),
+            possible_narrow_cast<ins_link::integer>(inputs),
+            possible_narrow_cast<outs_link::integer>(outputs)
+        });
+
+        input_bytes += table::input::put_ref{ {}, *tx }.count();
+        output_bytes += table::output::put_ref{ {}, {}, *tx }.count();
+        inputs += tx->inputs_ptr()->size();
+        outputs += tx->outputs_ptr()->size();
+    }
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // Allocate contiguously for all txs (single allocation per table).
+    const auto in_fk = store_.input.allocate(
+        possible_narrow_cast<input_link::integer>(input_bytes));
+    if (in_fk.is_terminal())
+        return error::tx_input_put;
+
+    const auto out_fk = store_.output.allocate(
+        possible_narrow_cast<output_link::integer>(output_bytes));
+    if (out_fk.is_terminal())
+        return error::tx_output_put;
+
+    const auto ins_fk = store_.ins.allocate(
+        possible_narrow_cast<ins_link::integer>(inputs));
+    if (ins_fk.is_terminal())
+        return error::tx_ins_put;
+
+    const auto outs_fk = store_.outs.allocate(
+        possible_narrow_cast<outs_link::integer>(outputs));
+    if (outs_fk.is_terminal())
+        return error::tx_outs_put;
+
+    // Expand synchronizes keys with ins_fk, entries set into same offset.
+    if (!store_.point.expand(ins_fk + possible_narrow_cast<
+        point_link::integer>(inputs)))
+        return error::tx_point_allocate;
+
+    // Address records are one per output, so aligned with outs offsets.
+    const auto address = address_enabled();
+    address_link ad_fk{};
+    if (address)
+    {
+        ad_fk = store_.address.allocate(
+            possible_narrow_cast<address_link::integer>(outputs));
+        if (ad_fk.is_terminal())
+            return error::tx_address_allocate;
+    }
+
+    // One remap guard per table is held across the whole group.
+    auto input_ptr = store_.input.get_memory();
+    auto output_ptr = store_.output.get_memory();
+    auto ins_ptr = store_.ins.get_memory();
+    auto outs_ptr = store_.outs.get_memory();
+    auto tx_ptr = store_.tx.get_memory();
+    auto point_ptr = store_.point.get_memory();
+    auto address_ptr = address ? store_.address.get_memory() : memory_ptr{};
+    std::vector<hash_digest> scripts(address ? outputs : zero);
+
+    // Serialize txs concurrently into their preallocated regions.
+    std::for_each(parallel, slots.begin(), slots.end(), [&](slot& at) NOEXCEPT
+    {
+        const auto& tx = at.tx;
+        const input_link input_fk{ in_fk + at.in_fk };
+        output_link output_fk{ out_fk + at.out_fk };
+        point_link point_fk{ ins_fk + at.ins_fk };
+        const auto& ins = *tx.inputs_ptr();
+        const auto& ous = *tx.outputs_ptr();
+
+        if (!store_.input.put(input_ptr, input_fk,
+            table::input::put_ref{ {}, tx }))
+        {
+            at.ec = error::tx_input_put;
+            return;
+        }
+
+        if (!store_.output.put(output_ptr, output_fk,
+            table::output::put_ref{ {}, at.tx_fk, tx }))
+        {
+            at.ec = error::tx_output_put;
+            return;
+        }
+
+        if (!store_.ins.put(ins_ptr, point_fk,
+            table::ins::put_ref{ {}, input_fk, at.tx_fk, tx }))
+        {
+            at.ec = error::tx_ins_put;
+            return;
+        }
+
+        if (!store_.outs.put(outs_ptr, outs_fk + at.outs_fk,
+            table::outs::put_ref{ {}, output_fk, tx }))
+        {
+            at.ec = error::tx_outs_put;
+            return;
+        }
+
+        // Create tx record (commit is deferred to the final pass).
+        if (!store_.tx.set(tx_ptr, at.tx_fk, at.key, table::transaction::put_ref
+        {
+            {},
+            tx,
+            possible_narrow_cast<ix::integer>(ins.size()),
+            possible_narrow_cast<ix::integer>(ous.size()),
+            ins_fk + at.ins_fk,
+            outs_fk + at.outs_fk
+        }))
+        {
+            at.ec = error::tx_tx_set;
+            return;
+        }
+
+        // Set points (commit is deferred to the final pass).
+        for (const auto& in: ins)
+        {
+            if (!store_.point.set(point_ptr, point_fk++, in->point(),
+                table::point::record{}))
+            {
+                at.ec = error::tx_point_put;
+                return;
+            }
+        }
+
+        if (!address)
+            return;
+
+        // Set address records (commit is deferred to the final pass).
+        auto index = at.outs_fk;
+        for (const auto& output: ous)
+        {
+            auto& key = scripts.at(index);
+            key = output->script().hash();
+            if (!store_.address.set(address_ptr, ad_fk + index++, key,
+                table::address::record{ {}, output_fk }))
+            {
+                at.ec = error::tx_address_put;
+                return;
+            }
+
+            // See outs::put_ref.
+            output_fk.value += (variable_size(output->value()) +
+                output->serialized_size() - value_parent);
+        }
+    });
+
+    // Return the first failure in block order.
+    input_ptr.reset();
+    output_ptr.reset();
+    ins_ptr.reset();
+    outs_ptr.reset();
+    for (const auto& at: slots)
+        if (at.ec)
+            return at.ec;
+
+    // Commit points (hashmap).
+    // If dirty we must guard against duplicates (see set_code(tx)).
+    const auto guard = store_.is_dirty() || !bypass;
+    std::vector<point> twins{};
+    for (const auto& at: slots)
+    {
+        point_link point_fk{ ins_fk + at.ins_fk };
+        const auto coinbase = at.tx.is_coinbase();
+        for (const auto& in: *at.tx.inputs_ptr())
+        {
+            if (coinbase || !guard)
+            {
+                if (!store_.point.commit(point_ptr, point_fk++, in->point()))
+                    return coinbase ? error::tx_null_point_put :
+                        error::tx_point_put;
+            }
+            else
+            {
+                bool duplicate{};
+                if (!store_.point.commit(duplicate, point_ptr, point_fk++,
+                    in->point()))
+                    return error::tx_point_put;
+
+                if (duplicate)
+                    twins.push_back(in->point());
+            }
+        }
+    }
+
+    point_ptr.reset();
+
+    // As few duplicates are expected, duplicate domain is only 2^16.
+    // Return of tx_duplicate_put implies link domain has overflowed.
+    for (const auto& twin: twins)
+        if (!store_.duplicate.exists(twin))
+            if (!store_.duplicate.put(twin, table::duplicate::record{}))
+                return error::tx_duplicate_put;
+
+    // Commit address index records (hashmap).
+    for (size_t index{}; index < scripts.size(); ++index)
+        if (!store_.address.commit(address_ptr, ad_fk +
+            possible_narrow_cast<address_link::integer>(index),
+            scripts.at(index)))
+            return error::tx_address_put;
+
+    address_ptr.reset();
+
+    // Commit txs to search (hashmap).
+    for (const auto& at: slots)
+        if (!store_.tx.commit(tx_ptr, at.tx_fk, at.key))
+            return error::tx_tx_commit;
+
+    tx_ptr.reset();
+
+    // Index spends once searchable (spender and funder may be in any order).
+    for (const auto& at: slots)
+        if (!set_spends(at.tx_fk))
+            return error::tx_spend_put;
+
+    return error::success;
     // ========================================================================
 }
 
@@ -386,11 +656,9 @@ code CLASS::set_code(const block& block, const header_link& key,
     if (tx_fks.is_terminal())
         return error::tx_tx_allocate;
 
-    code ec{};
-    auto fk = tx_fks;
-    for (const auto& tx: *block.transactions_ptr())
-        if ((ec = set_code(fk++, *tx, bypass)))
-            return ec;
+    // Group commit of all txs (one allocation per table).
+    if (const auto ec = set_code(tx_fks, *block.transactions_ptr(), bypass))
+        return ec;
 
     // Optional hash, only has value on height intervals.
     auto interval = create_interval(key, height);
@@ -427,6 +695,67 @@ code CLASS::set_code(const block& block, const header_link& key,
     // ========================================================================
 }
 
+// set spends
+// ----------------------------------------------------------------------------
+// protected
+
+// Indexes the spenders of the tx's outputs and the outputs spent by the tx.
+// Called after tx commit, so the tx and its points are searchable. The fence
+// ensures that of a concurrently-archived funder and spender, at least one
+// observes the other (both may, and merge is idempotent). Each output state
+// is merged under compare-exchange, so concurrent puts never lose a spender.
+
+TEMPLATE
+bool CLASS::set_spends(const tx_link& link) NOEXCEPT
+{
+    using namespace system;
+    if (!spend_enabled())
+        return true;
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+
+    table::transaction::get_output tx{};
+    if (!store_.tx.get(link, tx))
+        return false;
+
+    // Funder: prior spenders of each output (usually none).
+    const auto key = get_tx_key(link);
+    for (uint32_t index{}; index < tx.number; ++index)
+    {
+        table::spend::record state{};
+        for (const auto& spender: to_spenders(key, index))
+            state.value = table::spend::merge(state.value, spender);
+
+        if (!store_.spend.put(tx.outs_fk + index, state))
+            return false;
+    }
+
+    // Spender: prior funders of each point (all duplicates).
+    if (is_coinbase(link))
+        return true;
+
+    for (const auto& point_fk: to_points(link))
+    {
+        const auto point = get_point_key(point_fk);
+        for (const auto& funder_fk: to_duplicates(point.hash()))
+        {
+            table::transaction::get_output funder{ {}, point.index() };
+            if (!store_.tx.get(funder_fk, funder))
+                return false;
+
+            // Output index out of range, unindexable (and unspendable).
+            if (funder.outs_fk == table::transaction::outs::terminal)
+                continue;
+
+            if (!store_.spend.put(funder.outs_fk,
+                table::spend::record{ point_fk }))
+                return false;
+        }
+    }
+
+    return true;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -21,6 +21,7 @@
 
 #include <algorithm>
 #include <utility>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -145,6 +146,194 @@ bool CLASS::get_wire_block(bytewriter& sink, const header_link& link,
     return true;
 }
 
+// Scatter-gather reader from store to wire-encoded segments (store to network).
+// ----------------------------------------------------------------------------
+// Scripts and witnesses are stored in wire format and are referenced in place
+// within the pinned input and output maps. All other fields are synthesized to
+// the side buffer. Input and witness segments are obtained in one navigation.
+
+TEMPLATE
+bool CLASS::get_wire_output(wire_iov& sink, const memory_ptr& outputs,
+    const output_link& link) const NOEXCEPT
+{
+    table::output::wire_segment out{};
+    if (!store_.output.get(outputs, link, out) ||
+        !sink.synthesize(sizeof(uint64_t), [&](bytewriter& side) NOEXCEPT
+        {
+            side.write_8_bytes_little_endian(out.value);
+            return true;
+        }))
+        return false;
+
+    // Slab links are byte offsets.
+    const auto position = system::possible_narrow_cast<size_t>(link.value);
+    return sink.append(outputs, position + out.script_position,
+        out.script_size);
+}
+
+TEMPLATE
+bool CLASS::get_wire_tx(wire_iov& sink, const memory_ptr& inputs,
+    const memory_ptr& outputs, const tx_link& link,
+    bool witness) const NOEXCEPT
+{
+    using namespace system;
+    using segment = std::pair<size_t, size_t>;
+    constexpr auto point_size = hash_size + sizeof(uint32_t);
+
+    table::transaction::record tx{};
+    if (!store_.tx.get(link, tx))
+        return false;
+
+    table::outs::record outs{};
+    outs.out_fks.resize(tx.outs_count);
+    if (!store_.outs.get(tx.outs_fk, outs))
+        return false;
+
+    // Point links are contiguous (computed).
+    const auto ins_begin = tx.point_fk;
+    const auto ins_count = tx.ins_count;
+    const auto ins_final = ins_begin + ins_count;
+    const auto witnessed = witness && (tx.heavy != tx.light);
+
+    if (!sink.synthesize(sizeof(uint32_t) + two + variable_size(ins_count),
+        [&](bytewriter& side) NOEXCEPT
+        {
+            side.write_4_bytes_little_endian(tx.version);
+            if (witnessed)
+            {
+                side.write_byte(chain::witness_marker);
+                side.write_byte(chain::witness_enabled);
+            }
+
+            side.write_variable(ins_count);
+            return true;
+        }))
+        return false;
+
+    std::vector<segment> witnesses{};
+    if (witnessed)
+        witnesses.reserve(ins_count);
+
+    for (auto fk = ins_begin; fk < ins_final; ++fk)
+    {
+        table::ins::get_input ins{};
+        table::input::wire_segments in{};
+        if (!store_.ins.get(fk, ins) ||
+            !store_.input.get(inputs, ins.input_fk, in))
+            return false;
+
+        if (!sink.synthesize(point_size, [&](bytewriter& side) NOEXCEPT
+            {
+                table::point::wire_point point{ {}, side };
+                return store_.point.get(fk, point);
+            }))
+            return false;
+
+        // Slab links are byte offsets.
+        const auto position = possible_narrow_cast<size_t>(ins.input_fk);
+        if (!sink.append(inputs, position, in.script_size))
+            return false;
+
+        if (!sink.synthesize(sizeof(uint32_t), [&](bytewriter& side) NOEXCEPT
+            {
+                side.write_4_bytes_little_endian(ins.sequence);
+                return true;
+            }))
+            return false;
+
+        if (witnessed)
+            witnesses.emplace_back(position + in.script_size, in.witness_size);
+    }
+
+    if (!sink.synthesize(variable_size(outs.out_fks.size()),
+        [&](bytewriter& side) NOEXCEPT
+        {
+            side.write_variable(outs.out_fks.size());
+            return true;
+        }))
+        return false;
+
+    for (const auto& fk: outs.out_fks)
+        if (!get_wire_output(sink, outputs, fk))
+            return false;
+
+    for (const auto& segment: witnesses)
+        if (!sink.append(inputs, segment.first, segment.second))
+            return false;
+
+    return sink.synthesize(sizeof(uint32_t), [&](bytewriter& side) NOEXCEPT
+    {
+        side.write_4_bytes_little_endian(tx.locktime);
+        return true;
+    });
+}
+
+TEMPLATE
+bool CLASS::get_wire_block(wire_iov& sink, const memory_ptr& inputs,
+    const memory_ptr& outputs, const header_link& link,
+    bool witness) const NOEXCEPT
+{
+    using namespace system;
+    const auto txs = to_transactions(link);
+    if (txs.empty())
+        return false;
+
+    if (!sink.synthesize(chain::header::serialized_size() +
+        variable_size(txs.size()), [&](bytewriter& side) NOEXCEPT
+        {
+            if (!get_wire_header(side, link))
+                return false;
+
+            side.write_variable(txs.size());
+            return true;
+        }))
+        return false;
+
+    for (const auto& tx_link: txs)
+        if (!get_wire_tx(sink, inputs, outputs, tx_link, witness))
+            return false;
+
+    return true;
+}
+
+TEMPLATE
+wire_iov CLASS::get_wire_tx_iov(const tx_link& link,
+    bool witness) const NOEXCEPT
+{
+    wire_iov out{};
+    const auto inputs = store_.input.get_memory();
+    const auto outputs = store_.output.get_memory();
+    out.pin(inputs);
+    out.pin(outputs);
+    if (!get_wire_tx(out, inputs, outputs, link, witness))
+    {
+        out.clear();
+        return out;
+    }
+
+    out.finalize();
+    return out;
+}
+
+TEMPLATE
+wire_iov CLASS::get_wire_block_iov(const header_link& link,
+    bool witness) const NOEXCEPT
+{
+    wire_iov out{};
+    const auto inputs = store_.input.get_memory();
+    const auto outputs = store_.output.get_memory();
+    out.pin(inputs);
+    out.pin(outputs);
+    if (!get_wire_block(out, inputs, outputs, link, witness))
+    {
+        out.clear();
+        return out;
+    }
+
+    out.finalize();
+    return out;
+}
+
 // These convenience wrappers are made practical by size caching for block and
 // tx for both nominal and witness wire encodings (and fixed size headers).
 // Intermediate objects (input, output, witness) have a size prefix 
@@ -203,8 +203,11 @@ code CLASS::set_code(const tx_link& tx_fk, const transaction_view& tx,
     }
 
     // Commit tx to search (hashmap).
-    return store_.tx.commit(tx_fk, tx.hash(false)) ?
-        error::success : error::tx_tx_commit;
+    if (!store_.tx.commit(tx_fk, tx.hash(false)))
+        return error::tx_tx_commit;
+
+    // Index spends once searchable (spender and funder may be in any order).
+    return set_spends(tx_fk) ? error::success : error::tx_spend_put;
     // ========================================================================
 }
 
@@ -168,6 +168,10 @@ bool CLASS::is_spent(const output_link& link) const NOEXCEPT
 {
     // *Any* tx spends the output. Note that this could even be a tx that is in
     // conflict with another long-confirmed tx, or a valid tx in invalid block.
+    point_link spender{};
+    if (get_spender(spender, link))
+        return !spender.is_terminal();
+
     return store_.point.exists(get_outpoint(link).point());
 }
 
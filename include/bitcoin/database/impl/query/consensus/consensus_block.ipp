@@ -114,9 +114,23 @@ system::error::transaction_error_t CLASS::spendable(
     const point_set::point& point, uint32_t version,
     const context& ctx) const NOEXCEPT
 {
-    const auto link = find_strong(point.tx);
-    if (link.is_terminal())
-        return system::error::unconfirmed_spend;
+    // Strong cache hit provides strength and prevout context in one lookup.
+    context prevout{};
+    header_link link{};
+    uint32_t height{};
+    const auto cached = store_.strong_contexts.get(height, prevout.mtp,
+        point.tx);
+
+    if (cached)
+    {
+        prevout.height = height;
+    }
+    else
+    {
+        link = find_strong(point.tx);
+        if (link.is_terminal())
+            return system::error::unconfirmed_spend;
+    }
 
     // Avoids get_context call when relative locktime is not applicable.
     const auto bip68 = ctx.is_enabled(system::chain::flags::bip68_rule);
@@ -125,8 +139,7 @@ system::error::transaction_error_t CLASS::spendable(
 
     if (relative || point.coinbase)
     {
-        context prevout{};
-        if (!get_context(prevout, link))
+        if (!cached && !get_context(prevout, link))
             return system::error::previous_output_null;
 
         if (relative &&
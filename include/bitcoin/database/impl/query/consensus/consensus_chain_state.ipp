@@ -19,8 +19,10 @@
 #ifndef LIBBITCOIN_DATABASE_CONSENSUS_CHAIN_STATE_IPP
 #define LIBBITCOIN_DATABASE_CONSENSUS_CHAIN_STATE_IPP
 
-#include <ranges>
+#include <algorithm>
+#include <iterator>
 #include <memory>
+#include <numeric>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -36,10 +38,19 @@ bool CLASS::populate_bits(chain_state::data& data,
     if (!get_bits(data.bits.self, link))
         return false;
 
-    data.bits.ordered.resize(map.bits.count);
-    for (auto& bit: std::views::reverse(data.bits.ordered))
+    // Parents are read until the remainder is cached candidate ancestry.
+    auto& ordered = data.bits.ordered;
+    ordered.resize(map.bits.count);
+    auto height = data.height;
+    for (auto count = ordered.size(); !is_zero(count); --count, --height)
     {
-        if (!get_bits(bit, link)) return false;
+        if (store_.candidate_fields.get_bits(ordered.begin(), count,
+            height, link))
+            return true;
+
+        if (!get_bits(*std::next(ordered.begin(), sub1(count)), link))
+            return false;
+
         link = to_parent(link);
     }
 
@@ -53,10 +64,19 @@ bool CLASS::populate_versions(chain_state::data& data,
     if (!get_version(data.version.self, link))
         return false;
 
-    data.version.ordered.resize(map.version.count);
-    for (auto& version: std::views::reverse(data.version.ordered))
+    // Parents are read until the remainder is cached candidate ancestry.
+    auto& ordered = data.version.ordered;
+    ordered.resize(map.version.count);
+    auto height = data.height;
+    for (auto count = ordered.size(); !is_zero(count); --count, --height)
     {
-        if (!get_version(version, link)) return false;
+        if (store_.candidate_fields.get_versions(ordered.begin(), count,
+            height, link))
+            return true;
+
+        if (!get_version(*std::next(ordered.begin(), sub1(count)), link))
+            return false;
+
         link = to_parent(link);
     }
 
@@ -70,10 +90,19 @@ bool CLASS::populate_timestamps(chain_state::data& data,
     if (!get_timestamp(data.timestamp.self, link))
         return false;
 
-    data.timestamp.ordered.resize(map.timestamp.count);
-    for (auto& timestamp: std::views::reverse(data.timestamp.ordered))
+    // Parents are read until the remainder is cached candidate ancestry.
+    auto& ordered = data.timestamp.ordered;
+    ordered.resize(map.timestamp.count);
+    auto height = data.height;
+    for (auto count = ordered.size(); !is_zero(count); --count, --height)
     {
-        if (!get_timestamp(timestamp, link)) return false;
+        if (store_.candidate_fields.get_timestamps(ordered.begin(), count,
+            height, link))
+            return true;
+
+        if (!get_timestamp(*std::next(ordered.begin(), sub1(count)), link))
+            return false;
+
         link = to_parent(link);
     }
 
@@ -93,8 +122,15 @@ bool CLASS::populate_retarget(chain_state::data& data,
     if (map.timestamp_retarget > data.height)
         return false;
 
-    for (auto it = map.timestamp_retarget; it < data.height; ++it)
+    // Parents are read until the remainder is cached candidate ancestry.
+    for (auto it = data.height; it > map.timestamp_retarget; --it)
+    {
+        if (store_.candidate_fields.get_timestamp(data.timestamp.retarget,
+            map.timestamp_retarget, it, link))
+            return true;
+
         link = to_parent(link);
+    }
 
     return get_timestamp(data.timestamp.retarget, link);
 }
@@ -191,12 +227,16 @@ TEMPLATE
 bool CLASS::populate_candidate_bits(chain_state::data& data,
     const chain_state::map& map, const header& header) const NOEXCEPT
 {
-    data.bits.ordered.resize(map.bits.count);
-    auto height = map.bits.high - map.bits.count;
-
-    for (auto& bit: data.bits.ordered)
-        if (!get_bits(bit, to_candidate(++height)))
-            return false;
+    auto& ordered = data.bits.ordered;
+    ordered.resize(map.bits.count);
+    if (!store_.candidate_fields.get_bits(ordered.begin(), ordered.size(),
+        map.bits.high))
+    {
+        auto height = map.bits.high - map.bits.count;
+        for (auto& bit: ordered)
+            if (!get_bits(bit, to_candidate(++height)))
+                return false;
+    }
 
     data.bits.self = header.bits();
     return true;
@@ -206,12 +246,16 @@ TEMPLATE
 bool CLASS::populate_candidate_versions(chain_state::data& data,
     const chain_state::map& map, const header& header) const NOEXCEPT
 {
-    data.version.ordered.resize(map.version.count);
-    auto height = map.version.high - map.version.count;
-
-    for (auto& version: data.version.ordered)
-        if (!get_version(version, to_candidate(++height)))
-            return false;
+    auto& ordered = data.version.ordered;
+    ordered.resize(map.version.count);
+    if (!store_.candidate_fields.get_versions(ordered.begin(), ordered.size(),
+        map.version.high))
+    {
+        auto height = map.version.high - map.version.count;
+        for (auto& version: ordered)
+            if (!get_version(version, to_candidate(++height)))
+                return false;
+    }
 
     data.version.self = header.version();
     return true;
@@ -221,12 +265,16 @@ TEMPLATE
 bool CLASS::populate_candidate_timestamps(chain_state::data& data,
     const chain_state::map& map, const header& header) const NOEXCEPT
 {
-    data.timestamp.ordered.resize(map.timestamp.count);
-    auto height = map.timestamp.high - map.timestamp.count;
-
-    for (auto& timestamp: data.timestamp.ordered)
-        if (!get_timestamp(timestamp, to_candidate(++height)))
-            return false;
+    auto& ordered = data.timestamp.ordered;
+    ordered.resize(map.timestamp.count);
+    if (!store_.candidate_fields.get_timestamps(ordered.begin(), ordered.size(),
+        map.timestamp.high))
+    {
+        auto height = map.timestamp.high - map.timestamp.count;
+        for (auto& timestamp: ordered)
+            if (!get_timestamp(timestamp, to_candidate(++height)))
+                return false;
+    }
 
     data.timestamp.self = header.timestamp();
     return true;
@@ -248,8 +296,9 @@ bool CLASS::populate_candidate_retarget(chain_state::data& data,
         return true;
     }
 
-    return get_timestamp(data.timestamp.retarget,
-        to_candidate(map.timestamp_retarget));
+    const auto at = map.timestamp_retarget;
+    return store_.candidate_fields.get_timestamp(data.timestamp.retarget, at,
+        at) || get_timestamp(data.timestamp.retarget, to_candidate(at));
 }
 
 TEMPLATE
@@ -325,6 +374,56 @@ typename CLASS::chain_state_cptr CLASS::get_candidate_chain_state(
     return std::make_shared<chain_state>(std::move(data), settings);
 }
 
+// fields cache
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+bool CLASS::initialize_fields_cache() NOEXCEPT
+{
+    constexpr auto parallel = poolstl::execution::par;
+    if (!store_.candidate_fields.enabled())
+        return true;
+
+    store_.candidate_fields.clear();
+
+    const auto count = add1(get_top_candidate());
+    std::vector<header_link> links(count);
+    std::vector<table::header::get_fields> headers(count);
+    std::vector<size_t> heights(count);
+    std::iota(heights.begin(), heights.end(), zero);
+    if (!std::all_of(parallel, heights.begin(), heights.end(),
+        [&](size_t height) NOEXCEPT
+        {
+            links.at(height) = to_candidate(height);
+            return store_.header.get(links.at(height), headers.at(height));
+        }))
+        return false;
+
+    // Pushed in height order, as the cache is a prefix of the index.
+    for (const auto height: heights)
+    {
+        const auto& header = headers.at(height);
+        store_.candidate_fields.push(links.at(height), height,
+            { header.version, header.timestamp, header.bits, header.mtp });
+    }
+
+    return true;
+}
+
+// protected
+TEMPLATE
+void CLASS::cache_fields(const header_link& link, size_t height) NOEXCEPT
+{
+    if (!store_.candidate_fields.enabled())
+        return;
+
+    // A miss leaves the cache short of the index (until reinitialized).
+    table::header::get_fields header{};
+    if (store_.header.get(link, header))
+        store_.candidate_fields.push(link, height,
+            { header.version, header.timestamp, header.bits, header.mtp });
+}
+
 } // namespace database
 } // namespace libbitcoin
 
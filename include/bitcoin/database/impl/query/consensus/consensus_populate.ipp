@@ -42,11 +42,36 @@ bool CLASS::populate_with_metadata(const block& block,
     if (txs->empty())
         return false;
 
-    return std::all_of(std::next(txs->begin()), txs->end(),
-        [this, chain](const auto& tx) NOEXCEPT
+    // Gather unpopulated inputs so that prevout tx lookups can be batched.
+    hashes keys{};
+    std::vector<const input*> ins{};
+    std::for_each(std::next(txs->begin()), txs->end(),
+        [&](const auto& tx) NOEXCEPT
         {
-            return this->populate_with_metadata(*tx, chain);
+            // Invalid block may have a non-first coinbase (null point).
+            if (tx->is_coinbase())
+                return;
+
+            for (const auto& in: *tx->inputs_ptr())
+            {
+                if (!in->prevout)
+                {
+                    keys.push_back(in->point().hash());
+                    ins.push_back(in.get());
+                }
+            }
         });
+
+    // Batched tx hashmap search keeps multiple table misses in flight.
+    std::vector<tx_link> links(keys.size());
+    if (!store_.tx.first_many(keys, links))
+        return false;
+
+    for (size_t index{}; index < ins.size(); ++index)
+        if (!populate_with_metadata(*ins[index], links[index], chain))
+            return false;
+
+    return true;
 }
 
 TEMPLATE
@@ -87,7 +112,16 @@ bool CLASS::populate_with_metadata(const input& input,
     if (input.prevout)
         return true;
 
-    const auto tx = to_tx(input.point().hash());
+    return populate_with_metadata(input, to_tx(input.point().hash()), chain);
+}
+
+// protected
+TEMPLATE
+bool CLASS::populate_with_metadata(const input& input, const tx_link& tx,
+    bool chain) const NOEXCEPT
+{
+    // Null point would return nullptr and be interpreted as missing.
+    BC_ASSERT(!input.point().is_null());
     const auto index = input.point().index();
 
     // Node and chain confirmation.
@@ -105,9 +105,12 @@ bool CLASS::set_prevouts(const header_link& link, const block& block) NOEXCEPT
 TEMPLATE
 bool CLASS::get_doubles(tx_links& out, const point& point) const NOEXCEPT
 {
-    if (!store_.duplicate.exists(point))
-        return true;
+    return !store_.duplicate.exists(point) || get_doubles_(out, point);
+}
 
+TEMPLATE
+bool CLASS::get_doubles_(tx_links& out, const point& point) const NOEXCEPT
+{
     // Get the [tx.hash:index] of each spender of the point (index unused).
     const auto spenders = get_spenders(point);
     bool found{};
@@ -134,10 +137,19 @@ bool CLASS::get_doubles(tx_links& out, const block& block) const NOEXCEPT
     if (txs.size() <= one)
         return true;
 
+    // Batch the duplicate table search for all points of the block.
+    std::vector<point> points{};
     for (auto tx = std::next(txs.cbegin()); tx != txs.cend(); ++tx)
         for (const auto& in: *(*tx)->inputs_ptr())
-            if (!get_doubles(out, in->point()))
-                return false;
+            points.push_back(in->point());
+
+    std::vector<table::duplicate::link> links(points.size());
+    if (!store_.duplicate.first_many(points, links))
+        return false;
+
+    for (size_t index{}; index < points.size(); ++index)
+        if (!links[index].is_terminal() && !get_doubles_(out, points[index]))
+            return false;
 
     return true;
 }
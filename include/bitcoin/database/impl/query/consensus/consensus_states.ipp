@@ -279,7 +279,19 @@ TEMPLATE
 bool CLASS::set_tx_connected(const tx_link& link, const context& ctx,
     uint64_t fee, size_t sigops) NOEXCEPT
 {
-    return set_tx_state(link, ctx, fee, sigops, tx_state::connected);
+    if (!set_tx_state(link, ctx, fee, sigops, tx_state::connected))
+        return false;
+
+    // Persist fee rate for estimation (coinbase has no fee rate).
+    if (!fee_enabled() || is_coinbase(link))
+        return true;
+
+    // Failure to persist does not invalidate the connection (recomputed).
+    size_t bytes{};
+    if (get_tx_virtual_size(bytes, link))
+        std::ignore = set_tx_fees(link, { bytes, fee });
+
+    return true;
 }
 
 // private
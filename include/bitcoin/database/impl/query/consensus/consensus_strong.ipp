@@ -19,6 +19,9 @@
 #ifndef LIBBITCOIN_DATABASE_QUERY_CONSENSUS_STRONG_IPP
 #define LIBBITCOIN_DATABASE_QUERY_CONSENSUS_STRONG_IPP
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -109,23 +112,29 @@ TEMPLATE
 bool CLASS::set_strong(const header_link& link, size_t count,
     const tx_link& first_fk, bool positive) NOEXCEPT
 {
-    using namespace system;
-    using link_t = table::strong_tx::link;
     using element_t = table::strong_tx::record;
-
-    // Preallocate all strong_tx records for the block and reuse memory ptr.
-    const auto records = possible_narrow_cast<link_t::integer>(count);
-    auto record = store_.strong_tx.allocate(records);
-    const auto ptr = store_.strong_tx.get_memory();
+    const element_t element{ table::strong_tx::merge(positive, link) };
     const auto end = first_fk + count;
 
-    // Contiguous tx links.
+    // Contiguous tx links, each a word write into the dense array.
     for (auto fk = first_fk; fk < end; ++fk)
-        if (!store_.strong_tx.put(ptr, record++, fk, element_t
-            {
-                {},
-                table::strong_tx::merge(positive, link)
-            })) return false;
+        if (!store_.strong_tx.put(fk, element))
+            return false;
+
+    // Cache reflects store (cache block context before its txs are released).
+    if (store_.strong_contexts.enabled())
+    {
+        context ctx{};
+        if (positive)
+        {
+            if (!get_context(ctx, link))
+                return false;
+
+            store_.strong_contexts.set_block(link, ctx.height, ctx.mtp);
+        }
+
+        store_.strong_contexts.set(first_fk, count, link, positive);
+    }
 
     return true;
 }
@@ -158,6 +167,9 @@ bool CLASS::set_unstrong(const header_link& link) NOEXCEPT
     // This should be caught by get_coinbase_and_count return.
     BC_ASSERT(!is_zero(txs.number) && txs.coinbase_fk != tx_link::terminal);
 
+    // Reorganized block objects are not retained.
+    uncache(link);
+
     // ========================================================================
     const auto scope = store_.get_transactor();
 
@@ -166,6 +178,79 @@ bool CLASS::set_unstrong(const header_link& link) NOEXCEPT
     // ========================================================================
 }
 
+// strong index
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+bool CLASS::initialize_strong() NOEXCEPT
+{
+    constexpr auto parallel = poolstl::execution::par;
+
+    // The prior index is nullified, after which each confirmed block's
+    // contiguous tx links are set strong. Unconfirmed strong blocks (pending
+    // confirmation) are not recovered, as with a restart. Body records of a
+    // prior layout are dropped only once rebuilt, so an interrupted migration
+    // is again pending upon open.
+    auto& strong = store_.strong_tx;
+    const auto obsolete = strong.obsolete();
+    if (!(obsolete ? strong.reset_obsolete() : strong.clear()))
+        return false;
+
+    std::vector<size_t> heights(store_.confirmed.count());
+    std::iota(heights.begin(), heights.end(), zero);
+    return std::all_of(parallel, heights.begin(), heights.end(),
+        [this](size_t height) NOEXCEPT
+        {
+            const auto link = to_confirmed(height);
+            table::txs::get_coinbase_and_count txs{};
+            if (!store_.txs.at(to_txs(link), txs))
+                return false;
+
+            return set_strong(link, txs.number, txs.coinbase_fk, true);
+        }) && (!obsolete || strong.drop_obsolete());
+}
+
+TEMPLATE
+bool CLASS::migrate_strong() NOEXCEPT
+{
+    return !store_.strong_tx.obsolete() || initialize_strong();
+}
+
+// strong cache
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+bool CLASS::initialize_strong_cache() NOEXCEPT
+{
+    constexpr auto parallel = poolstl::execution::par;
+    if (!store_.strong_contexts.enabled())
+        return true;
+
+    store_.strong_contexts.clear();
+    store_.strong_contexts.reserve(store_.tx.count(), store_.header.count());
+
+    std::vector<size_t> heights(store_.confirmed.count());
+    std::iota(heights.begin(), heights.end(), zero);
+    return std::all_of(parallel, heights.begin(), heights.end(),
+        [this](size_t height) NOEXCEPT
+        {
+            const auto link = to_confirmed(height);
+            table::txs::get_coinbase_and_count txs{};
+            context ctx{};
+            if (!store_.txs.at(to_txs(link), txs) || !get_context(ctx, link))
+                return false;
+
+            // A bip30 reorganization may leave a confirmed block's coinbase
+            // unstrong, in which case the block is not cached (see notes).
+            if (to_block(txs.coinbase_fk) != link)
+                return true;
+
+            store_.strong_contexts.set_block(link, ctx.height, ctx.mtp);
+            store_.strong_contexts.set(txs.coinbase_fk, txs.number, link, true);
+            return true;
+        });
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -80,6 +80,7 @@ size_t CLASS::archive_body_size() const NOEXCEPT
         + point_body_size()
         + ins_body_size()
         + outs_body_size()
+        + spend_body_size()
         + txs_body_size()
         + tx_body_size();
 }
@@ -99,9 +100,14 @@ size_t CLASS::store_body_size() const NOEXCEPT
         + prevout_body_size()
         + validated_bk_body_size()
         + validated_tx_body_size()
+        + fee_tx_body_size()
         + address_body_size()
         + filter_bk_body_size()
-        + filter_tx_body_size();
+        + filter_tx_body_size()
+        + fee_bk_body_size()
+        + summary_body_size()
+        + touched_body_size()
+        + activity_body_size();
 }
 
 TEMPLATE
@@ -113,6 +119,7 @@ size_t CLASS::archive_head_size() const NOEXCEPT
         + point_head_size()
         + ins_head_size()
         + outs_head_size()
+        + spend_head_size()
         + txs_head_size()
         + tx_head_size();
 }
@@ -132,9 +139,14 @@ size_t CLASS::store_head_size() const NOEXCEPT
         + prevout_head_size()
         + validated_bk_head_size()
         + validated_tx_head_size()
+        + fee_tx_head_size()
         + address_head_size()
         + filter_bk_head_size()
-        + filter_tx_head_size();
+        + filter_tx_head_size()
+        + fee_bk_head_size()
+        + summary_head_size()
+        + touched_head_size()
+        + activity_head_size();
 }
 
 // Sizes.
@@ -146,6 +158,7 @@ DEFINE_SIZES(input)
 DEFINE_SIZES(point)
 DEFINE_SIZES(ins)
 DEFINE_SIZES(outs)
+DEFINE_SIZES(spend)
 DEFINE_SIZES(txs)
 DEFINE_SIZES(tx)
 
@@ -160,8 +173,13 @@ DEFINE_SIZES(prevalid)
 DEFINE_SIZES(prevout)
 DEFINE_SIZES(validated_bk)
 DEFINE_SIZES(validated_tx)
+DEFINE_SIZES(fee_tx)
 DEFINE_SIZES(filter_bk)
 DEFINE_SIZES(filter_tx)
+DEFINE_SIZES(fee_bk)
+DEFINE_SIZES(summary)
+DEFINE_SIZES(touched)
+DEFINE_SIZES(activity)
 DEFINE_SIZES(address)
 
 // Buckets (hashmap + arraymap).
@@ -169,6 +187,7 @@ DEFINE_SIZES(address)
 
 DEFINE_BUCKETS(header)
 DEFINE_BUCKETS(point)
+DEFINE_BUCKETS(spend)
 DEFINE_BUCKETS(txs)
 DEFINE_BUCKETS(tx)
 
@@ -177,8 +196,13 @@ DEFINE_BUCKETS(duplicate)
 DEFINE_BUCKETS(prevout)
 DEFINE_BUCKETS(validated_bk)
 DEFINE_BUCKETS(validated_tx)
+DEFINE_BUCKETS(fee_tx)
 DEFINE_BUCKETS(filter_bk)
 DEFINE_BUCKETS(filter_tx)
+DEFINE_BUCKETS(fee_bk)
+DEFINE_BUCKETS(summary)
+DEFINE_BUCKETS(touched)
+DEFINE_BUCKETS(activity)
 DEFINE_BUCKETS(address)
 
 // Records (arrays).
@@ -192,7 +216,6 @@ DEFINE_RECORDS(tx)
 
 DEFINE_RECORDS(candidate)
 DEFINE_RECORDS(confirmed)
-DEFINE_RECORDS(strong_tx)
 DEFINE_RECORDS(ecdsa)
 DEFINE_RECORDS(schnorr)
 DEFINE_RECORDS(silent)
@@ -200,6 +223,8 @@ DEFINE_RECORDS(duplicate)
 DEFINE_RECORDS(prevalid)
 DEFINE_RECORDS(filter_bk)
 DEFINE_RECORDS(address)
+DEFINE_RECORDS(summary)
+DEFINE_RECORDS(activity)
 
 // Counters (archive slabs).
 // ----------------------------------------------------------------------------
@@ -259,6 +284,18 @@ counts CLASS::put_counts(const tx_links& txs) const NOEXCEPT
     return { input_count(txs), output_count(txs) };
 }
 
+TEMPLATE
+bool CLASS::spend_enabled() const NOEXCEPT
+{
+    return store_.spend.enabled();
+}
+
+TEMPLATE
+bool CLASS::fee_enabled() const NOEXCEPT
+{
+    return store_.fee_tx.enabled();
+}
+
 TEMPLATE
 bool CLASS::address_enabled() const NOEXCEPT
 {
@@ -271,6 +308,57 @@ bool CLASS::filter_enabled() const NOEXCEPT
     return store_.filter_bk.enabled() && store_.filter_tx.enabled();
 }
 
+TEMPLATE
+bool CLASS::histogram_enabled() const NOEXCEPT
+{
+    return store_.fee_bk.enabled();
+}
+
+TEMPLATE
+bool CLASS::summary_enabled() const NOEXCEPT
+{
+    return store_.summary.enabled();
+}
+
+TEMPLATE
+bool CLASS::touched_enabled() const NOEXCEPT
+{
+    return store_.touched.enabled();
+}
+
+TEMPLATE
+bool CLASS::activity_enabled() const NOEXCEPT
+{
+    return store_.activity.enabled();
+}
+
+TEMPLATE
+bool CLASS::get_statistics(hash_statistics& out, table_t table,
+    size_t samples) const NOEXCEPT
+{
+    switch (table)
+    {
+        case table_t::header_table:
+            return store_.header.get_statistics(out, samples);
+        case table_t::point_table:
+            return store_.point.get_statistics(out, samples);
+        case table_t::tx_table:
+            return store_.tx.get_statistics(out, samples);
+        case table_t::duplicate_table:
+            return store_.duplicate.get_statistics(out, samples);
+        case table_t::validated_tx_table:
+            return store_.validated_tx.get_statistics(out, samples);
+        case table_t::address_table:
+            return store_.address.get_statistics(out, samples);
+        case table_t::summary_table:
+            return store_.summary.get_statistics(out, samples);
+        case table_t::activity_table:
+            return store_.activity.get_statistics(out, samples);
+        default:
+            return false;
+    }
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -22,6 +22,7 @@
 #include <atomic>
 #include <algorithm>
 #include <iterator>
+#include <mutex>
 #include <utility>
 #include <bitcoin/database/define.hpp>
 
@@ -35,6 +36,15 @@ namespace database {
 TEMPLATE
 bool CLASS::get_tx_fees(fee_rate& out, const tx_link& link) const NOEXCEPT
 {
+    // Persisted upon connection or backfill (writers), otherwise computed.
+    table::fee_tx::record fees{};
+    if (store_.fee_tx.at(to_fee_tx(link), fees))
+    {
+        out.bytes = fees.virtual_size;
+        out.fee = fees.fee;
+        return true;
+    }
+
     // This is somehow ~15-20% less efficient.
     ////return get_tx_virtual_size(out.bytes, link) && get_tx_fee(out.fee, link);
     const auto tx = get_transaction(link, false);
@@ -102,6 +112,198 @@ bool CLASS::get_branch_fees(const stopper& cancel, fee_rate_sets& out,
     return !failed;
 }
 
+TEMPLATE
+bool CLASS::set_block_fees(const header_link& link) NOEXCEPT
+{
+    if (!fee_enabled())
+        return true;
+
+    table::txs::get_txs txs{};
+    if (!store_.txs.at(to_txs(link), txs) || (txs.tx_fks.size() < one))
+        return false;
+
+    // Skip coinbase, and fee rates persisted upon connection (or backfill).
+    const auto end = txs.tx_fks.cend();
+    for (auto tx = std::next(txs.tx_fks.cbegin()); tx != end; ++tx)
+    {
+        if (store_.fee_tx.exists(to_fee_tx(*tx)))
+            continue;
+
+        fee_rate rate{};
+        if (!get_tx_fees(rate, *tx) || !set_tx_fees(*tx, rate))
+            return false;
+    }
+
+    return true;
+}
+
+TEMPLATE
+bool CLASS::set_branch_fees(const stopper& cancel, size_t start,
+    size_t count) NOEXCEPT
+{
+    if (is_zero(count) || !fee_enabled())
+        return true;
+
+    if (system::is_add_overflow(start, sub1(count)) ||
+        (start + sub1(count) > get_top_confirmed()))
+        return false;
+
+    stopper fail{};
+    std::vector<size_t> it(count);
+    std::iota(it.begin(), it.end(), zero);
+    constexpr auto parallel = poolstl::execution::par;
+    constexpr auto relaxed = std::memory_order_relaxed;
+
+    // Blocks are independent, so backfill is parallel (as with histograms).
+    std::for_each(parallel, it.cbegin(), it.cend(), [&](size_t offset) NOEXCEPT
+    {
+        if (fail.load(relaxed))
+            return;
+
+        if (cancel.load(relaxed) || !set_block_fees(
+            to_confirmed(start + offset)))
+            fail.store(true, relaxed);
+    });
+
+    return !fail.load(relaxed);
+}
+
+// block/branch fee histograms
+// ----------------------------------------------------------------------------
+// server estimator (optional, histograms are block-invariant)
+
+TEMPLATE
+bool CLASS::get_fee_histogram(fee_histogram& out,
+    const header_link& link) const NOEXCEPT
+{
+    table::fee_bk::record record{};
+    if (!store_.fee_bk.at(to_fee_bk(link), record))
+        return false;
+
+    out = std::move(record.histogram);
+    return true;
+}
+
+TEMPLATE
+bool CLASS::get_fee_histograms(fee_histograms& out, size_t start,
+    size_t count) const NOEXCEPT
+{
+    out.clear();
+    if (is_zero(count))
+        return true;
+
+    if (system::is_add_overflow(start, sub1(count)) ||
+        (start + sub1(count) > get_top_confirmed()))
+        return false;
+
+    out.resize(count);
+    for (size_t offset{}; offset < count; ++offset)
+    {
+        if (!get_fee_histogram(out.at(offset), to_confirmed(start + offset)))
+        {
+            out.clear();
+            return false;
+        }
+    }
+
+    return true;
+}
+
+TEMPLATE
+bool CLASS::set_fee_histogram(const header_link& link) NOEXCEPT
+{
+    if (!histogram_enabled())
+        return true;
+
+    // Histogram is block-invariant, so never rewritten (unlocked precheck).
+    if (store_.fee_bk.exists(to_fee_bk(link)))
+        return true;
+
+    fee_rates rates{};
+    if (!get_block_fees(rates, link))
+        return false;
+
+    // Repeated under lock, as a concurrent call may have computed the same.
+    std::unique_lock lock{ fee_mutex_ };
+    if (store_.fee_bk.exists(to_fee_bk(link)))
+        return true;
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // Clean single allocation failure (e.g. disk full).
+    return store_.fee_bk.put(to_fee_bk(link), table::fee_bk::record
+    {
+        {},
+        fee_histogram::from_rates(rates)
+    });
+    // ========================================================================
+}
+
+TEMPLATE
+bool CLASS::set_fee_histograms(const stopper& cancel, size_t start,
+    size_t count) NOEXCEPT
+{
+    if (is_zero(count) || !histogram_enabled())
+        return true;
+
+    if (system::is_add_overflow(start, sub1(count)) ||
+        (start + sub1(count) > get_top_confirmed()))
+        return false;
+
+    stopper fail{};
+    std::vector<size_t> it(count);
+    std::iota(it.begin(), it.end(), zero);
+    constexpr auto parallel = poolstl::execution::par;
+    constexpr auto relaxed = std::memory_order_relaxed;
+
+    // Blocks are independent, so backfill is parallel (as with fees).
+    std::for_each(parallel, it.cbegin(), it.cend(), [&](size_t offset) NOEXCEPT
+    {
+        if (fail.load(relaxed))
+            return;
+
+        if (cancel.load(relaxed) || !set_fee_histogram(
+            to_confirmed(start + offset)))
+            fail.store(true, relaxed);
+    });
+
+    return !fail.load(relaxed);
+}
+
+// protected
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+bool CLASS::set_tx_fees(const tx_link& link,
+    const fee_rate& rate) NOEXCEPT
+{
+    using namespace system;
+    using bytes = table::fee_tx::bytes;
+    if (!fee_enabled())
+        return true;
+
+    if (rate.bytes > bytes::terminal)
+        return false;
+
+    // Fee rate is invariant, so an existing record is not rewritten.
+    std::unique_lock lock{ fee_mutex_ };
+    if (store_.fee_tx.exists(to_fee_tx(link)))
+        return true;
+
+    // ========================================================================
+    const auto scope = store_.get_transactor();
+
+    // Clean single allocation failure (e.g. disk full).
+    return store_.fee_tx.put(to_fee_tx(link), table::fee_tx::record
+    {
+        {},
+        rate.fee,
+        possible_narrow_cast<bytes::integer>(rate.bytes)
+    });
+    // ========================================================================
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -35,6 +35,9 @@ bool CLASS::push_candidate(const header_link& link) NOEXCEPT
     if (link.is_terminal())
         return false;
 
+    // Height of the block being pushed (count prior to commit).
+    const auto height = store_.candidate.count().value;
+
     // Reserve-commit to ensure disk full safety and deferred access.
     if (!store_.candidate.reserve(one))
         return false;
@@ -44,7 +47,11 @@ bool CLASS::push_candidate(const header_link& link) NOEXCEPT
 
     // Clean single allocation failure (e.g. disk full).
     const table::height::record candidate{ {}, link };
-    return store_.candidate.put(candidate);
+    if (!store_.candidate.put(candidate))
+        return false;
+
+    cache_fields(link, height);
+    return true;
     // ========================================================================
 }
 
@@ -65,6 +72,7 @@ bool CLASS::pop_candidate() NOEXCEPT
 
     ///////////////////////////////////////////////////////////////////////////
     std::unique_lock interlock{ candidate_reorganization_mutex_ };
+    store_.candidate_fields.pop(top);
     return store_.candidate.truncate(top);
     ///////////////////////////////////////////////////////////////////////////
     // ========================================================================
@@ -77,6 +85,15 @@ bool CLASS::push_confirmed(const header_link& link, bool strong) NOEXCEPT
     if (strong && !store_.txs.at(to_txs(link), txs))
         return false;
 
+    // Height of the block being confirmed (count prior to commit).
+    const auto height = store_.confirmed.count().value;
+
+    // Address changes are read from the block before writing.
+    summary_changes changes{};
+    if ((summary_enabled() || activity_enabled()) &&
+        !get_summary_changes(changes, link))
+        return false;
+
     // Reserve-commit to ensure disk full safety and deferred access.
     if (!store_.confirmed.reserve(one))
         return false;
@@ -88,6 +105,14 @@ bool CLASS::push_confirmed(const header_link& link, bool strong) NOEXCEPT
     if (strong && !set_strong(link, txs.number, txs.coinbase_fk, true))
         return false;
 
+    // Summaries are not current until the block is committed (recoverable).
+    if (summary_enabled() && !push_summaries(changes, link, height))
+        return false;
+
+    // Unsafe for allocation failure (activity of other addresses remains).
+    if (activity_enabled() && !push_activity(changes, height))
+        return false;
+
     const table::height::record confirmed{ {}, link };
     return store_.confirmed.commit(confirmed);
     // ========================================================================
@@ -113,6 +138,10 @@ bool CLASS::pop_confirmed() NOEXCEPT
     if (!set_strong(link, txs.number, txs.coinbase_fk, false))
         return false;
 
+    // Reorganized block objects are not retained.
+    uncache(link);
+
+    // Truncation leaves summaries of the block not current (none written).
     ///////////////////////////////////////////////////////////////////////////
     std::unique_lock interlock{ confirmed_reorganization_mutex_ };
     return store_.confirmed.truncate(top);
@@ -48,6 +48,20 @@ constexpr size_t CLASS::to_filter_tx(const header_link& link) const NOEXCEPT
     return link.is_terminal() ? table::filter_tx::link::terminal : link.value;
 }
 
+TEMPLATE
+constexpr size_t CLASS::to_fee_bk(const header_link& link) const NOEXCEPT
+{
+    static_assert(header_link::terminal <= table::fee_bk::link::terminal);
+    return link.is_terminal() ? table::fee_bk::link::terminal : link.value;
+}
+
+TEMPLATE
+constexpr size_t CLASS::to_touched(const header_link& link) const NOEXCEPT
+{
+    static_assert(header_link::terminal <= table::touched::link::terminal);
+    return link.is_terminal() ? table::touched::link::terminal : link.value;
+}
+
 TEMPLATE
 constexpr size_t CLASS::to_prevout(const header_link& link) const NOEXCEPT
 {
@@ -62,6 +76,16 @@ constexpr size_t CLASS::to_txs(const header_link& link) const NOEXCEPT
     return link.is_terminal() ? table::txs::link::terminal : link.value;
 }
 
+// tx to arraymap tables (guard domain transitions)
+// ----------------------------------------------------------------------------
+
+TEMPLATE
+constexpr size_t CLASS::to_fee_tx(const tx_link& link) const NOEXCEPT
+{
+    static_assert(tx_link::terminal <= table::fee_tx::link::terminal);
+    return link.is_terminal() ? table::fee_tx::link::terminal : link.value;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
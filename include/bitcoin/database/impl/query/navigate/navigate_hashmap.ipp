@@ -27,6 +27,24 @@ namespace database {
 // hashmap enumeration
 // ----------------------------------------------------------------------------
 
+TEMPLATE
+size_t CLASS::header_span() const NOEXCEPT
+{
+    return store_.header.span();
+}
+
+TEMPLATE
+size_t CLASS::point_span() const NOEXCEPT
+{
+    return store_.point.span();
+}
+
+TEMPLATE
+size_t CLASS::tx_span() const NOEXCEPT
+{
+    return store_.tx.span();
+}
+
 TEMPLATE
 header_link CLASS::top_header(size_t bucket) const NOEXCEPT
 {
@@ -169,6 +169,12 @@ tx_link CLASS::to_prevout_tx(const point_link& link) const NOEXCEPT
 TEMPLATE
 point_links CLASS::to_spenders(const output_link& link) const NOEXCEPT
 {
+    // Zero or one spender is resolved by the spend index (no point search).
+    point_link spender{};
+    if (get_spender(spender, link))
+        return spender.is_terminal() ? point_links{} :
+            point_links{ spender.value };
+
     table::output::get_parent out{};
     if (!store_.output.get(link, out))
         return {};
@@ -181,6 +187,12 @@ TEMPLATE
 point_links CLASS::to_spenders(const tx_link& output_tx,
     uint32_t output_index) const NOEXCEPT
 {
+    // Zero or one spender is resolved by the spend index (no point search).
+    point_link spender{};
+    if (get_spender(spender, output_tx, output_index))
+        return spender.is_terminal() ? point_links{} :
+            point_links{ spender.value };
+
     return to_spenders(get_tx_key(output_tx), output_index);
 }
 
@@ -237,6 +249,82 @@ header_link CLASS::to_block(const tx_link& link) const NOEXCEPT
     return strong.header_fk();
 }
 
+// output->spender (spend index)
+// ----------------------------------------------------------------------------
+// protected
+
+// The spend index is keyed by output position (outs link), which is the offset
+// of the output within its parent's contiguous outs. An unspent output is
+// resolved without a point search, as is a single spender. Multiple spenders,
+// unindexed outputs and a disabled index are not resolved (false).
+
+TEMPLATE
+bool CLASS::get_spender(point_link& out, const output_link& link) const NOEXCEPT
+{
+    if (!spend_enabled())
+        return false;
+
+    table::output::get_parent output{};
+    if (!store_.output.get(link, output))
+        return false;
+
+    table::transaction::get_output tx{};
+    if (!store_.tx.get(output.parent_fk, tx))
+        return false;
+
+    // Output links ascend within a tx, so its position is found by bisection
+    // of single outs cells (the output record does not carry its index).
+    auto first = tx.outs_fk;
+    auto last = tx.outs_fk + tx.number;
+    while (first < last)
+    {
+        const auto middle = first + (last - first) / 2u;
+        table::outs::get_output cell{};
+        if (!store_.outs.get(middle, cell))
+            return false;
+
+        if (cell.out_fk == link.value)
+            return get_spend(out, middle);
+
+        if (cell.out_fk < link.value)
+            first = system::add1(middle);
+        else
+            last = middle;
+    }
+
+    return false;
+}
+
+TEMPLATE
+bool CLASS::get_spender(point_link& out, const tx_link& link,
+    uint32_t output_index) const NOEXCEPT
+{
+    if (!spend_enabled())
+        return false;
+
+    table::transaction::get_output tx{ {}, output_index };
+    if (!store_.tx.get(link, tx))
+        return false;
+
+    // Output index out of range, unindexable (and unspendable).
+    if (tx.outs_fk == table::transaction::outs::terminal)
+        return false;
+
+    return get_spend(out, tx.outs_fk);
+}
+
+TEMPLATE
+bool CLASS::get_spend(point_link& out,
+    const outs_link& position) const NOEXCEPT
+{
+    table::spend::record spend{};
+    if (!store_.spend.find(position, spend) || spend.multiple())
+        return false;
+
+    out = spend.point_fk();
+    return true;
+}
+
 // utilities
 // ----------------------------------------------------------------------------
 // protected (presumed to not be externally useful)
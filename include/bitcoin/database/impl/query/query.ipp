@@ -170,6 +170,30 @@ size_t CLASS::negative_search_count() const NOEXCEPT
     return store_.point.negative_search_count();
 }
 
+TEMPLATE
+size_t CLASS::header_cache_hits() const NOEXCEPT
+{
+    return store_.header_objects.hits();
+}
+
+TEMPLATE
+size_t CLASS::header_cache_misses() const NOEXCEPT
+{
+    return store_.header_objects.misses();
+}
+
+TEMPLATE
+size_t CLASS::tx_cache_hits() const NOEXCEPT
+{
+    return store_.tx_objects.hits();
+}
+
+TEMPLATE
+size_t CLASS::tx_cache_misses() const NOEXCEPT
+{
+    return store_.tx_objects.misses();
+}
+
 } // namespace database
 } // namespace libbitcoin
 
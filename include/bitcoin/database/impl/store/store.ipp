@@ -19,6 +19,10 @@
 #ifndef LIBBITCOIN_DATABASE_STORE_IPP
 #define LIBBITCOIN_DATABASE_STORE_IPP
 
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <numeric>
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -35,21 +39,23 @@ CLASS::store(const settings& config) NOEXCEPT
     header_body_(body(config.path, schema::archive::header), config.header_size, config.header_rate, sequential),
 
     input_head_(head(config.path / schema::dir::heads, schema::archive::input), 1, 0, random),
-    input_body_(body(config.path, schema::archive::input), config.input_size, config.input_rate, sequential),
+    input_body_(body(config.path, schema::archive::input), config.input_size, config.input_rate, sequential, { .reserve = config.input_reserve, .resident = config.input_resident }),
 
     output_head_(head(config.path / schema::dir::heads, schema::archive::output), 1, 0, random),
-    output_body_(body(config.path, schema::archive::output), config.output_size, config.output_rate, sequential),
+    output_body_(body(config.path, schema::archive::output), config.output_size, config.output_rate, sequential, { .reserve = config.output_reserve, .resident = config.output_resident }),
 
-    point_head_(head(config.path / schema::dir::heads, schema::archive::point), 1, 0, random),
-    point_body_(body(config.path, schema::archive::point), config.point_size, config.point_rate, sequential),
+    point_head_(head(config.path / schema::dir::heads, schema::archive::point), 1, 0, random, { config.point_head_huge, config.point_head_populate, config.point_head_lock }),
+    point_body_(body(config.path, schema::archive::point), config.point_size, config.point_rate, sequential, { .reserve = config.point_reserve, .resident = config.point_resident }),
 
     ins_head_(head(config.path / schema::dir::heads, schema::archive::ins), 1, 0, random),
     ins_body_(body(config.path, schema::archive::ins), config.ins_size, config.ins_rate, sequential),
 
     outs_head_(head(config.path / schema::dir::heads, schema::archive::outs), 1, 0, random),
     outs_body_(body(config.path, schema::archive::outs), config.outs_size, config.outs_rate, sequential),
+    spend_head_(head(config.path / schema::dir::heads, schema::archive::spend), 1, 0, random),
+    spend_body_(body(config.path, schema::archive::spend), config.spend_size, config.spend_rate, sequential),
 
-    tx_head_(head(config.path / schema::dir::heads, schema::archive::tx), 1, 0, random),
+    tx_head_(head(config.path / schema::dir::heads, schema::archive::tx), 1, 0, random, { config.tx_head_huge, config.tx_head_populate, config.tx_head_lock }),
     tx_body_(body(config.path, schema::archive::tx), config.tx_size, config.tx_rate, sequential),
 
     txs_head_(head(config.path / schema::dir::heads, schema::archive::txs), 1, 0, random),
@@ -94,10 +100,13 @@ CLASS::store(const settings& config) NOEXCEPT
     validated_tx_head_(head(config.path / schema::dir::heads, schema::caches::validated_tx), 1, 0, random),
     validated_tx_body_(body(config.path, schema::caches::validated_tx), config.validated_tx_size, config.validated_tx_rate, sequential),
 
+    fee_tx_head_(head(config.path / schema::dir::heads, schema::caches::fee_tx), 1, 0, random),
+    fee_tx_body_(body(config.path, schema::caches::fee_tx), config.fee_tx_size, config.fee_tx_rate, sequential),
+
     // Optionals.
     // ------------------------------------------------------------------------
 
-    address_head_(head(config.path / schema::dir::heads, schema::optionals::address), 1, 0, random),
+    address_head_(head(config.path / schema::dir::heads, schema::optionals::address), 1, 0, random, { config.address_head_huge, config.address_head_populate, config.address_head_lock }),
     address_body_(body(config.path, schema::optionals::address), config.address_size, config.address_rate, sequential),
 
     filter_bk_head_(head(config.path / schema::dir::heads, schema::optionals::filter_bk), 1, 0, random),
@@ -106,6 +115,23 @@ CLASS::store(const settings& config) NOEXCEPT
     filter_tx_head_(head(config.path / schema::dir::heads, schema::optionals::filter_tx), 1, 0, random),
     filter_tx_body_(body(config.path, schema::optionals::filter_tx), config.filter_tx_size, config.filter_tx_rate, sequential),
 
+    fee_bk_head_(head(config.path / schema::dir::heads, schema::optionals::fee_bk), 1, 0, random),
+    fee_bk_body_(body(config.path, schema::optionals::fee_bk), config.fee_bk_size, config.fee_bk_rate, sequential),
+
+    summary_head_(head(config.path / schema::dir::heads, schema::optionals::summary), 1, 0, random),
+    summary_body_(body(config.path, schema::optionals::summary), config.summary_size, config.summary_rate, sequential),
+
+    touched_head_(head(config.path / schema::dir::heads, schema::optionals::touched), 1, 0, random),
+    touched_body_(body(config.path, schema::optionals::touched), config.touched_size, config.touched_rate, sequential),
+
+    activity_head_(head(config.path / schema::dir::heads, schema::optionals::activity), 1, 0, random),
+    activity_body_(body(config.path, schema::optionals::activity), config.activity_size, config.activity_rate, sequential),
+
+    // Rehash.
+    // ------------------------------------------------------------------------
+
+    shadow_head_(config.path / schema::dir::heads / (std::string{ "shadow" } + schema::ext::rehash), 1, 0, random),
+
     // Locks.
     // ------------------------------------------------------------------------
 
@@ -121,6 +147,7 @@ CLASS::store(const settings& config) NOEXCEPT
     point(point_head_, point_body_, config.point_buckets),
     ins(ins_head_, ins_body_),
     outs(outs_head_, outs_body_),
+    spend(spend_head_, spend_body_, config.spend_buckets),
     tx(tx_head_, tx_body_, config.tx_buckets),
     txs(txs_head_, txs_body_, config.txs_buckets),
 
@@ -136,10 +163,23 @@ CLASS::store(const settings& config) NOEXCEPT
     prevout(prevout_head_, prevout_body_, config.prevout_buckets),
     validated_bk(validated_bk_head_, validated_bk_body_, config.validated_bk_buckets),
     validated_tx(validated_tx_head_, validated_tx_body_, config.validated_tx_buckets),
+    fee_tx(fee_tx_head_, fee_tx_body_, config.fee_tx_buckets),
 
     address(address_head_, address_body_, config.address_buckets),
     filter_bk(filter_bk_head_, filter_bk_body_, config.filter_bk_buckets),
-    filter_tx(filter_tx_head_, filter_tx_body_, config.filter_tx_buckets)
+    filter_tx(filter_tx_head_, filter_tx_body_, config.filter_tx_buckets),
+    fee_bk(fee_bk_head_, fee_bk_body_, config.fee_bk_buckets),
+    summary(summary_head_, summary_body_, config.summary_buckets),
+    touched(touched_head_, touched_body_, config.touched_buckets),
+    activity(activity_head_, activity_body_, config.activity_buckets),
+
+    // Objects.
+    // ------------------------------------------------------------------------
+
+    header_objects(config.header_cache),
+    tx_objects(config.tx_cache),
+    strong_contexts(config.strong_cache),
+    candidate_fields(config.fields_cache)
 {
 }
 
@@ -181,6 +221,64 @@ const typename CLASS::transactor CLASS::get_transactor() NOEXCEPT
     return transactor{ transactor_mutex_ };
 }
 
+// protected
+TEMPLATE
+code CLASS::execute(const tasks& work, event_t event,
+    const event_handler& handler, bool timed) NOEXCEPT
+{
+    using clock = std::chrono::steady_clock;
+    constexpr auto relaxed = std::memory_order_relaxed;
+    const auto policy = poolstl::execution::par_if(
+        configuration_.concurrent_files);
+
+    stopper fail{};
+    std::mutex handler_mutex{};
+    std::vector<code> codes(work.size(), error::success);
+    std::vector<size_t> it(work.size());
+    std::iota(it.begin(), it.end(), zero);
+
+    // Remaining operations are skipped once any operation fails.
+    std::for_each(policy, it.cbegin(), it.cend(), [&](size_t index) NOEXCEPT
+    {
+        if (fail.load(relaxed))
+            return;
+
+        const auto& task = work.at(index);
+        {
+            std::unique_lock lock{ handler_mutex };
+            handler(event, task.table);
+        }
+
+        const auto start = clock::now();
+        auto& ec = codes.at(index);
+        ec = task.run();
+        const auto elapsed = std::chrono::duration_cast<duration>(
+            clock::now() - start);
+
+        if (timed)
+        {
+            std::unique_lock lock{ timing_mutex_ };
+            timing_[task.table] += elapsed;
+        }
+
+        if (ec) fail.store(true, relaxed);
+    });
+
+    // The first error in table order is returned, as if sequential.
+    const auto first = std::find_if(codes.cbegin(), codes.cend(),
+        [](const code& value) NOEXCEPT { return !!value; });
+
+    return first == codes.cend() ? error::success : *first;
+}
+
+// protected
+TEMPLATE
+void CLASS::clear_timing() NOEXCEPT
+{
+    std::unique_lock lock{ timing_mutex_ };
+    timing_.clear();
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -29,6 +29,18 @@ namespace database {
 // public
 TEMPLATE
 code CLASS::backup(const event_handler& handler, bool prune) NOEXCEPT
+{
+    head_images images{};
+    if (const auto ec = capture(images, handler, prune))
+        return ec;
+
+    return persist(images, handler);
+}
+
+// Set body counts and copy heads, requires writes suspended (fast).
+TEMPLATE
+code CLASS::capture(head_images& images, const event_handler& handler,
+    bool prune) NOEXCEPT
 {
     code ec{ error::success };
     const auto backup = [&handler](code& ec, auto& logical,
@@ -48,6 +60,7 @@ code CLASS::backup(const event_handler& handler, bool prune) NOEXCEPT
     backup(ec, point, table_t::point_table);
     backup(ec, ins, table_t::ins_table);
     backup(ec, outs, table_t::outs_table);
+    backup(ec, spend, table_t::spend_table);
     backup(ec, tx, table_t::tx_table);
     backup(ec, txs, table_t::txs_table);
 
@@ -63,35 +76,79 @@ code CLASS::backup(const event_handler& handler, bool prune) NOEXCEPT
     backup(ec, prevout, table_t::prevout_table, prune);
     backup(ec, validated_bk, table_t::validated_bk_table);
     backup(ec, validated_tx, table_t::validated_tx_table);
+    backup(ec, fee_tx, table_t::fee_tx_table);
 
     backup(ec, address, table_t::address_table);
     backup(ec, filter_bk, table_t::filter_bk_table);
     backup(ec, filter_tx, table_t::filter_tx_table);
+    backup(ec, fee_bk, table_t::fee_bk_table);
+    backup(ec, summary, table_t::summary_table);
+    backup(ec, touched, table_t::touched_table);
+    backup(ec, activity, table_t::activity_table);
 
     if (ec) return ec;
 
+    static const auto primary = configuration_.path / schema::dir::primary;
+    static const auto secondary = configuration_.path / schema::dir::secondary;
+
+    // An incremental snapshot patches /secondary, of known head generation.
+    // Directories are changed only under snapshot_mutex_, so this holds.
+    images.generation = header_head_.generation();
+    images.since = configuration_.incremental_snapshot &&
+        file::is_directory(primary) && file::is_directory(secondary) ?
+        secondary_generation_ : zero;
+
+    return copy(images, secondary);
+}
+
+// Archive captured heads, writes may proceed (bodies must be flushed).
+TEMPLATE
+code CLASS::persist(const head_images& images,
+    const event_handler& handler) NOEXCEPT
+{
     static const auto primary = configuration_.path / schema::dir::primary;
     static const auto secondary = configuration_.path / schema::dir::secondary;
     static const auto temporary = configuration_.path / schema::dir::temporary;
 
     handler(event_t::archive_snapshot, table_t::store);
 
-    // Ensure existing and empty /temporary.
-    if ((ec = file::clear_directory_ex(temporary))) return ec;
+    code ec{ error::success };
+    const auto rotate = file::is_directory(primary);
+    const auto prior = rotate ? primary_generation_ : zero;
+
+    // Generations are unknown until success.
+    primary_generation_ = zero;
+    secondary_generation_ = zero;
 
-    // Ensure no /primary.
-    if (file::is_directory(primary))
+    if (is_nonzero(images.since))
     {
-        // Delete /secondary.
-        if ((ec = file::clear_directory_ex(secondary))) return ec;
-        if ((ec = file::remove_ex(secondary))) return ec;
+        // Ensure no /temporary.
+        if ((ec = file::clear_directory_ex(temporary))) return ec;
+        if ((ec = file::remove_ex(temporary))) return ec;
 
-        // Rename /primary to /secondary (atomic).
+        // Rename /secondary to /temporary and /primary to /secondary (atomic).
+        if ((ec = file::rename_ex(secondary, temporary))) return ec;
         if ((ec = file::rename_ex(primary, secondary))) return ec;
     }
+    else
+    {
+        // Ensure existing and empty /temporary.
+        if ((ec = file::clear_directory_ex(temporary))) return ec;
+
+        // Ensure no /primary.
+        if (rotate)
+        {
+            // Delete /secondary.
+            if ((ec = file::clear_directory_ex(secondary))) return ec;
+            if ((ec = file::remove_ex(secondary))) return ec;
+
+            // Rename /primary to /secondary (atomic).
+            if ((ec = file::rename_ex(primary, secondary))) return ec;
+        }
+    }
 
-    // Dump /heads memory maps to /temporary.
-    if ((ec = dump(temporary, handler)))
+    // Write (or patch) captured /heads images to /temporary.
+    if ((ec = write(images, temporary, handler)))
     {
         // Failed dump, clear temporary and rename secondary to primary.
         if (file::clear_directory(temporary) && file::remove(temporary))
@@ -102,7 +159,12 @@ code CLASS::backup(const event_handler& handler, bool prune) NOEXCEPT
     }
 
     // Rename /temporary to /primary (atomic).
-    return file::rename_ex(temporary, primary);
+    if ((ec = file::rename_ex(temporary, primary)))
+        return ec;
+
+    primary_generation_ = images.generation;
+    secondary_generation_ = prior;
+    return ec;
 }
 
 } // namespace database
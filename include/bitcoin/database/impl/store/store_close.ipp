@@ -29,12 +29,26 @@ namespace database {
 TEMPLATE
 code CLASS::close(const event_handler& handler) NOEXCEPT
 {
+    // A snapshot in progress must complete before close.
+    while (!snapshot_mutex_.try_lock_for(std::chrono::seconds(1)))
+    {
+        handler(event_t::wait_lock, table_t::store);
+    }
+
     // Transactor may be held outside of the node, such as for backup. 
     while (!transactor_mutex_.try_lock_for(std::chrono::seconds(1)))
     {
         handler(event_t::wait_lock, table_t::store);
     }
 
+    // A rehash in progress must complete (or abort) before close.
+    if (rehashing_)
+    {
+        transactor_mutex_.unlock();
+        snapshot_mutex_.unlock();
+        return error::rehash_active;
+    }
+
     code ec{ error::success };
     const auto close = [&handler](code& ec, auto& logical, table_t table) NOEXCEPT
     {
@@ -52,6 +66,7 @@ code CLASS::close(const event_handler& handler) NOEXCEPT
     close(ec, point, table_t::point_table);
     close(ec, ins, table_t::ins_table);
     close(ec, outs, table_t::outs_table);
+    close(ec, spend, table_t::spend_table);
     close(ec, tx, table_t::tx_table);
     close(ec, txs, table_t::txs_table);
 
@@ -67,24 +82,41 @@ code CLASS::close(const event_handler& handler) NOEXCEPT
     close(ec, prevout, table_t::prevout_table);
     close(ec, validated_bk, table_t::validated_bk_table);
     close(ec, validated_tx, table_t::validated_tx_table);
+    close(ec, fee_tx, table_t::fee_tx_table);
 
     close(ec, address, table_t::address_table);
     close(ec, filter_bk, table_t::filter_bk_table);
     close(ec, filter_tx, table_t::filter_tx_table);
+    close(ec, fee_bk, table_t::fee_bk_table);
+    close(ec, summary, table_t::summary_table);
+    close(ec, touched, table_t::touched_table);
+    close(ec, activity, table_t::activity_table);
 
+    header_objects.clear();
+    tx_objects.clear();
+    strong_contexts.clear();
+    candidate_fields.clear();
     if (!ec) ec = unload_close(handler);
 
+    // Shadow head is retained by failure to abort a failed rehash.
+    if (rehash_fault_)
+    {
+        /* code */ shadow_head_.unload();
+        /* code */ shadow_head_.close();
+    }
+
     // unlock errors override ec.
     if (!process_lock_.try_unlock())
         ec = error::process_unlock;
 
     // fault overrides unlock errors and leaves behind flush_lock.
-    if (get_fault())
+    if (get_fault() || rehash_fault_)
         ec = error::integrity;
     else if (!flush_lock_.try_unlock())
         ec = error::flush_unlock;
 
     transactor_mutex_.unlock();
+    snapshot_mutex_.unlock();
     return ec;
 }
 
@@ -69,6 +69,8 @@ code CLASS::create(const event_handler& handler) NOEXCEPT
     create(ec, ins_body_, table_t::ins_body);
     create(ec, outs_head_, table_t::outs_head);
     create(ec, outs_body_, table_t::outs_body);
+    create(ec, spend_head_, table_t::spend_head);
+    create(ec, spend_body_, table_t::spend_body);
     create(ec, tx_head_, table_t::tx_head);
     create(ec, tx_body_, table_t::tx_body);
     create(ec, txs_head_, table_t::txs_head);
@@ -97,6 +99,8 @@ code CLASS::create(const event_handler& handler) NOEXCEPT
     create(ec, validated_bk_body_, table_t::validated_bk_body);
     create(ec, validated_tx_head_, table_t::validated_tx_head);
     create(ec, validated_tx_body_, table_t::validated_tx_body);
+    create(ec, fee_tx_head_, table_t::fee_tx_head);
+    create(ec, fee_tx_body_, table_t::fee_tx_body);
 
     create(ec, address_head_, table_t::address_head);
     create(ec, address_body_, table_t::address_body);
@@ -104,6 +108,14 @@ code CLASS::create(const event_handler& handler) NOEXCEPT
     create(ec, filter_bk_body_, table_t::filter_bk_body);
     create(ec, filter_tx_head_, table_t::filter_tx_head);
     create(ec, filter_tx_body_, table_t::filter_tx_body);
+    create(ec, fee_bk_head_, table_t::fee_bk_head);
+    create(ec, fee_bk_body_, table_t::fee_bk_body);
+    create(ec, summary_head_, table_t::summary_head);
+    create(ec, summary_body_, table_t::summary_body);
+    create(ec, touched_head_, table_t::touched_head);
+    create(ec, touched_body_, table_t::touched_body);
+    create(ec, activity_head_, table_t::activity_head);
+    create(ec, activity_body_, table_t::activity_body);
 
     const auto populate = [&handler](code& ec, auto& logical,
         table_t table) NOEXCEPT
@@ -125,6 +137,7 @@ code CLASS::create(const event_handler& handler) NOEXCEPT
     populate(ec, point, table_t::point_table);
     populate(ec, ins, table_t::ins_table);
     populate(ec, outs, table_t::outs_table);
+    populate(ec, spend, table_t::spend_table);
     populate(ec, tx, table_t::tx_table);
     populate(ec, txs, table_t::txs_table);
 
@@ -140,10 +153,15 @@ code CLASS::create(const event_handler& handler) NOEXCEPT
     populate(ec, prevout, table_t::prevout_table);
     populate(ec, validated_bk, table_t::validated_bk_table);
     populate(ec, validated_tx, table_t::validated_tx_table);
+    populate(ec, fee_tx, table_t::fee_tx_table);
 
     populate(ec, address, table_t::address_table);
     populate(ec, filter_bk, table_t::filter_bk_table);
     populate(ec, filter_tx, table_t::filter_tx_table);
+    populate(ec, fee_bk, table_t::fee_bk_table);
+    populate(ec, summary, table_t::summary_table);
+    populate(ec, touched, table_t::touched_table);
+    populate(ec, activity, table_t::activity_table);
 
     if (ec)
     {
@@ -27,50 +27,98 @@ namespace database {
 // public
 // Dump memory maps of /heads to new files in /temporary.
 // Heads are copied from RAM, not flushed to disk and copied as files.
+// If since is nonzero, existing head files of that generation are patched.
+// Head generations are advanced together, whether or not the dump succeeds.
 TEMPLATE
-code CLASS::dump(const path& folder,
-    const event_handler& handler) NOEXCEPT
+code CLASS::dump(const path& folder, const event_handler& handler,
+    size_t since) NOEXCEPT
+{
+    head_images images{ .since = since };
+    if (const auto ec = copy(images, folder))
+        return ec;
+
+    return write(images, folder, handler);
+}
+
+// Copy /heads memory maps, as patches of existing head files in folder of
+// generation images.since if nonzero, requires writes suspended.
+// Head generations are advanced together, whether or not the copy succeeds.
+TEMPLATE
+code CLASS::copy(head_images& images, const path& folder) NOEXCEPT
 {
+    using namespace system;
+    static const auto heads = configuration_.path / schema::dir::heads;
+
+    // Heads beyond the memory budget are staged to file (under lock).
     code ec{ error::success };
-    const auto dump = [&handler, &folder](code& ec, const auto& file,
+    auto budget = possible_narrow_cast<size_t>(configuration_.snapshot_bytes);
+    const auto copy = [&images, &folder, &budget](code& ec, auto& file,
         const auto& name, table_t table) NOEXCEPT
     {
         if (!ec)
         {
-            handler(event_t::copy_header, table);
-            ec = file.dump(head(folder, name));
+            images.heads.push_back({ table, name, {} });
+            auto& image = images.heads.back().copy;
+            ec = file.capture(image, head(folder, name), images.since, budget,
+                heads / (name + schema::ext::staged));
+            budget = floored_subtract(budget, image.data.size());
         }
+
+        file.advance();
     };
 
-    dump(ec, header_head_, schema::archive::header, table_t::header_head);
-    dump(ec, input_head_, schema::archive::input, table_t::input_head);
-    dump(ec, output_head_, schema::archive::output, table_t::output_head);
-    dump(ec, point_head_, schema::archive::point, table_t::point_head);
-    dump(ec, ins_head_, schema::archive::ins, table_t::ins_head);
-    dump(ec, outs_head_, schema::archive::outs, table_t::outs_head);
-    dump(ec, tx_head_, schema::archive::tx, table_t::tx_head);
-    dump(ec, txs_head_, schema::archive::txs, table_t::txs_head);
-
-    dump(ec, candidate_head_, schema::indexes::candidate, table_t::candidate_head);
-    dump(ec, confirmed_head_, schema::indexes::confirmed, table_t::confirmed_head);
-    dump(ec, strong_tx_head_, schema::indexes::strong_tx, table_t::strong_tx_head);
-
-    dump(ec, ecdsa_head_, schema::caches::ecdsa, table_t::ecdsa_head);
-    dump(ec, schnorr_head_, schema::caches::schnorr, table_t::schnorr_head);
-    dump(ec, silent_head_, schema::caches::silent, table_t::silent_head);
-    dump(ec, duplicate_head_, schema::caches::duplicate, table_t::duplicate_head);
-    dump(ec, prevalid_head_, schema::caches::prevalid, table_t::prevalid_head);
-    dump(ec, prevout_head_, schema::caches::prevout, table_t::prevout_head);
-    dump(ec, validated_bk_head_, schema::caches::validated_bk, table_t::validated_bk_head);
-    dump(ec, validated_tx_head_, schema::caches::validated_tx, table_t::validated_tx_head);
-
-    dump(ec, address_head_, schema::optionals::address, table_t::address_head);
-    dump(ec, filter_bk_head_, schema::optionals::filter_bk, table_t::filter_bk_head);
-    dump(ec, filter_tx_head_, schema::optionals::filter_tx, table_t::filter_tx_head);
+    images.heads.clear();
+
+    copy(ec, header_head_, schema::archive::header, table_t::header_head);
+    copy(ec, input_head_, schema::archive::input, table_t::input_head);
+    copy(ec, output_head_, schema::archive::output, table_t::output_head);
+    copy(ec, point_head_, schema::archive::point, table_t::point_head);
+    copy(ec, ins_head_, schema::archive::ins, table_t::ins_head);
+    copy(ec, outs_head_, schema::archive::outs, table_t::outs_head);
+    copy(ec, spend_head_, schema::archive::spend, table_t::spend_head);
+    copy(ec, tx_head_, schema::archive::tx, table_t::tx_head);
+    copy(ec, txs_head_, schema::archive::txs, table_t::txs_head);
+
+    copy(ec, candidate_head_, schema::indexes::candidate, table_t::candidate_head);
+    copy(ec, confirmed_head_, schema::indexes::confirmed, table_t::confirmed_head);
+    copy(ec, strong_tx_head_, schema::indexes::strong_tx, table_t::strong_tx_head);
+
+    copy(ec, ecdsa_head_, schema::caches::ecdsa, table_t::ecdsa_head);
+    copy(ec, schnorr_head_, schema::caches::schnorr, table_t::schnorr_head);
+    copy(ec, silent_head_, schema::caches::silent, table_t::silent_head);
+    copy(ec, duplicate_head_, schema::caches::duplicate, table_t::duplicate_head);
+    copy(ec, prevalid_head_, schema::caches::prevalid, table_t::prevalid_head);
+    copy(ec, prevout_head_, schema::caches::prevout, table_t::prevout_head);
+    copy(ec, validated_bk_head_, schema::caches::validated_bk, table_t::validated_bk_head);
+    copy(ec, validated_tx_head_, schema::caches::validated_tx, table_t::validated_tx_head);
+    copy(ec, fee_tx_head_, schema::caches::fee_tx, table_t::fee_tx_head);
+
+    copy(ec, address_head_, schema::optionals::address, table_t::address_head);
+    copy(ec, filter_bk_head_, schema::optionals::filter_bk, table_t::filter_bk_head);
+    copy(ec, filter_tx_head_, schema::optionals::filter_tx, table_t::filter_tx_head);
+    copy(ec, fee_bk_head_, schema::optionals::fee_bk, table_t::fee_bk_head);
+    copy(ec, summary_head_, schema::optionals::summary, table_t::summary_head);
+    copy(ec, touched_head_, schema::optionals::touched, table_t::touched_head);
+    copy(ec, activity_head_, schema::optionals::activity, table_t::activity_head);
 
     return ec;
 }
 
+// Write copied /heads to new (or patch existing) head files in folder.
+TEMPLATE
+code CLASS::write(const head_images& images, const path& folder,
+    const event_handler& handler) NOEXCEPT
+{
+    for (const auto& item: images.heads)
+    {
+        handler(event_t::copy_header, item.table);
+        if (const auto ec = item.copy.dump(head(folder, item.name)))
+            return ec;
+    }
+
+    return error::success;
+}
+
 } // namespace database
 } // namespace libbitcoin
 
@@ -38,13 +38,16 @@ const CLASS::event_map CLASS::events
 
     { event_t::wait_lock, "wait_lock" },
     { event_t::flush_body, "flush_body" },
+    { event_t::writeback_body, "writeback_body" },
     { event_t::prune_table, "prune_table" },
     { event_t::backup_table, "backup_table" },
     { event_t::copy_header, "copy_header" },
     { event_t::archive_snapshot, "archive_snapshot" },
 
     { event_t::restore_table, "restore_table" },
-    { event_t::recover_snapshot, "recover_snapshot" }
+    { event_t::recover_snapshot, "recover_snapshot" },
+
+    { event_t::rehash_table, "rehash_table" }
 };
 
 } // namespace database
@@ -47,6 +47,13 @@ code CLASS::open(const event_handler& handler) NOEXCEPT
         return error::flush_lock;
     }
 
+    // A rehashed head implies its bucket count, which supersedes settings.
+    const auto adopt = [](code& ec, auto& logical) NOEXCEPT
+    {
+        if (!ec && !logical.adopt())
+            ec = error::verify_table;
+    };
+
     const auto verify = [&handler](code& ec, auto& logical,
         table_t table) NOEXCEPT
     {
@@ -58,14 +65,29 @@ code CLASS::open(const event_handler& handler) NOEXCEPT
         }
     };
 
+    // Links above a restored snapshot may have been reassigned.
+    header_objects.clear();
+    tx_objects.clear();
+    strong_contexts.clear();
+    candidate_fields.clear();
+
     auto ec = open_load(handler);
 
+    adopt(ec, point);
+    adopt(ec, tx);
+    adopt(ec, address);
+
+    // Prior (hashmap) strong_tx layout is nullified, rebuilt by migrate_strong.
+    if (!ec && strong_tx.obsolete() && !strong_tx.reset_obsolete())
+        ec = error::verify_table;
+
     verify(ec, header, table_t::header_table);
     verify(ec, input, table_t::input_table);
     verify(ec, output, table_t::output_table);
     verify(ec, point, table_t::point_table);
     verify(ec, ins, table_t::ins_table);
     verify(ec, outs, table_t::outs_table);
+    verify(ec, spend, table_t::spend_table);
     verify(ec, tx, table_t::tx_table);
     verify(ec, txs, table_t::txs_table);
 
@@ -81,10 +103,15 @@ code CLASS::open(const event_handler& handler) NOEXCEPT
     verify(ec, prevout, table_t::prevout_table);
     verify(ec, validated_bk, table_t::validated_bk_table);
     verify(ec, validated_tx, table_t::validated_tx_table);
+    verify(ec, fee_tx, table_t::fee_tx_table);
 
     verify(ec, address, table_t::address_table);
     verify(ec, filter_bk, table_t::filter_bk_table);
     verify(ec, filter_tx, table_t::filter_tx_table);
+    verify(ec, fee_bk, table_t::fee_bk_table);
+    verify(ec, summary, table_t::summary_table);
+    verify(ec, touched, table_t::touched_table);
+    verify(ec, activity, table_t::activity_table);
 
     if (ec)
     {
@@ -28,120 +28,152 @@ namespace database {
 TEMPLATE
 code CLASS::open_load(const event_handler& handler) NOEXCEPT
 {
-    code ec{ error::success };
-    const auto open = [&handler](code& ec, auto& file, table_t table) NOEXCEPT
+    clear_timing();
+    tasks opens{};
+    const auto open = [&opens](auto& file, table_t table) NOEXCEPT
     {
-        if (!ec)
+        opens.push_back({ table, [&file]() NOEXCEPT
         {
-            handler(event_t::open_file, table);
-            ec = file.open();
-        }
+            return file.open();
+        } });
     };
 
-    open(ec, header_head_, table_t::header_head);
-    open(ec, header_body_, table_t::header_body);
-    open(ec, input_head_, table_t::input_head);
-    open(ec, input_body_, table_t::input_body);
-    open(ec, output_head_, table_t::output_head);
-    open(ec, output_body_, table_t::output_body);
-    open(ec, point_head_, table_t::point_head);
-    open(ec, point_body_, table_t::point_body);
-    open(ec, ins_head_, table_t::ins_head);
-    open(ec, ins_body_, table_t::ins_body);
-    open(ec, outs_head_, table_t::outs_head);
-    open(ec, outs_body_, table_t::outs_body);
-    open(ec, tx_head_, table_t::tx_head);
-    open(ec, tx_body_, table_t::tx_body);
-    open(ec, txs_head_, table_t::txs_head);
-    open(ec, txs_body_, table_t::txs_body);
-
-    open(ec, candidate_head_, table_t::candidate_head);
-    open(ec, candidate_body_, table_t::candidate_body);
-    open(ec, confirmed_head_, table_t::confirmed_head);
-    open(ec, confirmed_body_, table_t::confirmed_body);
-    open(ec, strong_tx_head_, table_t::strong_tx_head);
-    open(ec, strong_tx_body_, table_t::strong_tx_body);
-
-    open(ec, ecdsa_head_, table_t::ecdsa_head);
-    open(ec, ecdsa_body_, table_t::ecdsa_body);
-    open(ec, schnorr_head_, table_t::schnorr_head);
-    open(ec, schnorr_body_, table_t::schnorr_body);
-    open(ec, silent_head_, table_t::silent_head);
-    open(ec, silent_body_, table_t::silent_body);
-    open(ec, duplicate_head_, table_t::duplicate_head);
-    open(ec, duplicate_body_, table_t::duplicate_body);
-    open(ec, prevalid_head_, table_t::prevalid_head);
-    open(ec, prevalid_body_, table_t::prevalid_body);
-    open(ec, prevout_head_, table_t::prevout_head);
-    open(ec, prevout_body_, table_t::prevout_body);
-    open(ec, validated_bk_head_, table_t::validated_bk_head);
-    open(ec, validated_bk_body_, table_t::validated_bk_body);
-    open(ec, validated_tx_head_, table_t::validated_tx_head);
-    open(ec, validated_tx_body_, table_t::validated_tx_body);
-
-    open(ec, address_head_, table_t::address_head);
-    open(ec, address_body_, table_t::address_body);
-    open(ec, filter_bk_head_, table_t::filter_bk_head);
-    open(ec, filter_bk_body_, table_t::filter_bk_body);
-    open(ec, filter_tx_head_, table_t::filter_tx_head);
-    open(ec, filter_tx_body_, table_t::filter_tx_body);
-
-    const auto load = [&handler](code& ec, auto& file, table_t table) NOEXCEPT
+    open(header_head_, table_t::header_head);
+    open(header_body_, table_t::header_body);
+    open(input_head_, table_t::input_head);
+    open(input_body_, table_t::input_body);
+    open(output_head_, table_t::output_head);
+    open(output_body_, table_t::output_body);
+    open(point_head_, table_t::point_head);
+    open(point_body_, table_t::point_body);
+    open(ins_head_, table_t::ins_head);
+    open(ins_body_, table_t::ins_body);
+    open(outs_head_, table_t::outs_head);
+    open(outs_body_, table_t::outs_body);
+    open(spend_head_, table_t::spend_head);
+    open(spend_body_, table_t::spend_body);
+    open(tx_head_, table_t::tx_head);
+    open(tx_body_, table_t::tx_body);
+    open(txs_head_, table_t::txs_head);
+    open(txs_body_, table_t::txs_body);
+
+    open(candidate_head_, table_t::candidate_head);
+    open(candidate_body_, table_t::candidate_body);
+    open(confirmed_head_, table_t::confirmed_head);
+    open(confirmed_body_, table_t::confirmed_body);
+    open(strong_tx_head_, table_t::strong_tx_head);
+    open(strong_tx_body_, table_t::strong_tx_body);
+
+    open(ecdsa_head_, table_t::ecdsa_head);
+    open(ecdsa_body_, table_t::ecdsa_body);
+    open(schnorr_head_, table_t::schnorr_head);
+    open(schnorr_body_, table_t::schnorr_body);
+    open(silent_head_, table_t::silent_head);
+    open(silent_body_, table_t::silent_body);
+    open(duplicate_head_, table_t::duplicate_head);
+    open(duplicate_body_, table_t::duplicate_body);
+    open(prevalid_head_, table_t::prevalid_head);
+    open(prevalid_body_, table_t::prevalid_body);
+    open(prevout_head_, table_t::prevout_head);
+    open(prevout_body_, table_t::prevout_body);
+    open(validated_bk_head_, table_t::validated_bk_head);
+    open(validated_bk_body_, table_t::validated_bk_body);
+    open(validated_tx_head_, table_t::validated_tx_head);
+    open(validated_tx_body_, table_t::validated_tx_body);
+    open(fee_tx_head_, table_t::fee_tx_head);
+    open(fee_tx_body_, table_t::fee_tx_body);
+
+    open(address_head_, table_t::address_head);
+    open(address_body_, table_t::address_body);
+    open(filter_bk_head_, table_t::filter_bk_head);
+    open(filter_bk_body_, table_t::filter_bk_body);
+    open(filter_tx_head_, table_t::filter_tx_head);
+    open(filter_tx_body_, table_t::filter_tx_body);
+    open(fee_bk_head_, table_t::fee_bk_head);
+    open(fee_bk_body_, table_t::fee_bk_body);
+    open(summary_head_, table_t::summary_head);
+    open(summary_body_, table_t::summary_body);
+    open(touched_head_, table_t::touched_head);
+    open(touched_body_, table_t::touched_body);
+    open(activity_head_, table_t::activity_head);
+    open(activity_body_, table_t::activity_body);
+
+    auto ec = execute(opens, event_t::open_file, handler);
+
+    tasks loads{};
+    const auto load = [&loads](auto& file, table_t table) NOEXCEPT
     {
-        if (!ec)
+        loads.push_back({ table, [&file]() NOEXCEPT
         {
-            handler(event_t::load_file, table);
-            ec = file.load();
-        }
+            return file.load();
+        } });
     };
 
-    load(ec, header_head_, table_t::header_head);
-    load(ec, header_body_, table_t::header_body);
-    load(ec, input_head_, table_t::input_head);
-    load(ec, input_body_, table_t::input_body);
-    load(ec, output_head_, table_t::output_head);
-    load(ec, output_body_, table_t::output_body);
-    load(ec, point_head_, table_t::point_head);
-    load(ec, point_body_, table_t::point_body);
-    load(ec, ins_head_, table_t::ins_head);
-    load(ec, ins_body_, table_t::ins_body);
-    load(ec, outs_head_, table_t::outs_head);
-    load(ec, outs_body_, table_t::outs_body);
-    load(ec, tx_head_, table_t::tx_head);
-    load(ec, tx_body_, table_t::tx_body);
-    load(ec, txs_head_, table_t::txs_head);
-    load(ec, txs_body_, table_t::txs_body);
-
-    load(ec, candidate_head_, table_t::candidate_head);
-    load(ec, candidate_body_, table_t::candidate_body);
-    load(ec, confirmed_head_, table_t::confirmed_head);
-    load(ec, confirmed_body_, table_t::confirmed_body);
-    load(ec, strong_tx_head_, table_t::strong_tx_head);
-    load(ec, strong_tx_body_, table_t::strong_tx_body);
-
-    load(ec, ecdsa_head_, table_t::ecdsa_head);
-    load(ec, ecdsa_body_, table_t::ecdsa_body);
-    load(ec, schnorr_head_, table_t::schnorr_head);
-    load(ec, schnorr_body_, table_t::schnorr_body);
-    load(ec, silent_head_, table_t::silent_head);
-    load(ec, silent_body_, table_t::silent_body);
-    load(ec, duplicate_head_, table_t::duplicate_head);
-    load(ec, duplicate_body_, table_t::duplicate_body);
-    load(ec, prevalid_head_, table_t::prevalid_head);
-    load(ec, prevalid_body_, table_t::prevalid_body);
-    load(ec, prevout_head_, table_t::prevout_head);
-    load(ec, prevout_body_, table_t::prevout_body);
-    load(ec, validated_bk_head_, table_t::validated_bk_head);
-    load(ec, validated_bk_body_, table_t::validated_bk_body);
-    load(ec, validated_tx_head_, table_t::validated_tx_head);
-    load(ec, validated_tx_body_, table_t::validated_tx_body);
-
-    load(ec, address_head_, table_t::address_head);
-    load(ec, address_body_, table_t::address_body);
-    load(ec, filter_bk_head_, table_t::filter_bk_head);
-    load(ec, filter_bk_body_, table_t::filter_bk_body);
-    load(ec, filter_tx_head_, table_t::filter_tx_head);
-    load(ec, filter_tx_body_, table_t::filter_tx_body);
+    load(header_head_, table_t::header_head);
+    load(header_body_, table_t::header_body);
+    load(input_head_, table_t::input_head);
+    load(input_body_, table_t::input_body);
+    load(output_head_, table_t::output_head);
+    load(output_body_, table_t::output_body);
+    load(point_head_, table_t::point_head);
+    load(point_body_, table_t::point_body);
+    load(ins_head_, table_t::ins_head);
+    load(ins_body_, table_t::ins_body);
+    load(outs_head_, table_t::outs_head);
+    load(outs_body_, table_t::outs_body);
+    load(spend_head_, table_t::spend_head);
+    load(spend_body_, table_t::spend_body);
+    load(tx_head_, table_t::tx_head);
+    load(tx_body_, table_t::tx_body);
+    load(txs_head_, table_t::txs_head);
+    load(txs_body_, table_t::txs_body);
+
+    load(candidate_head_, table_t::candidate_head);
+    load(candidate_body_, table_t::candidate_body);
+    load(confirmed_head_, table_t::confirmed_head);
+    load(confirmed_body_, table_t::confirmed_body);
+    load(strong_tx_head_, table_t::strong_tx_head);
+    load(strong_tx_body_, table_t::strong_tx_body);
+
+    load(ecdsa_head_, table_t::ecdsa_head);
+    load(ecdsa_body_, table_t::ecdsa_body);
+    load(schnorr_head_, table_t::schnorr_head);
+    load(schnorr_body_, table_t::schnorr_body);
+    load(silent_head_, table_t::silent_head);
+    load(silent_body_, table_t::silent_body);
+    load(duplicate_head_, table_t::duplicate_head);
+    load(duplicate_body_, table_t::duplicate_body);
+    load(prevalid_head_, table_t::prevalid_head);
+    load(prevalid_body_, table_t::prevalid_body);
+    load(prevout_head_, table_t::prevout_head);
+    load(prevout_body_, table_t::prevout_body);
+    load(validated_bk_head_, table_t::validated_bk_head);
+    load(validated_bk_body_, table_t::validated_bk_body);
+    load(validated_tx_head_, table_t::validated_tx_head);
+    load(validated_tx_body_, table_t::validated_tx_body);
+    load(fee_tx_head_, table_t::fee_tx_head);
+    load(fee_tx_body_, table_t::fee_tx_body);
+
+    load(address_head_, table_t::address_head);
+    load(address_body_, table_t::address_body);
+    load(filter_bk_head_, table_t::filter_bk_head);
+    load(filter_bk_body_, table_t::filter_bk_body);
+    load(filter_tx_head_, table_t::filter_tx_head);
+    load(filter_tx_body_, table_t::filter_tx_body);
+    load(fee_bk_head_, table_t::fee_bk_head);
+    load(fee_bk_body_, table_t::fee_bk_body);
+    load(summary_head_, table_t::summary_head);
+    load(summary_body_, table_t::summary_body);
+    load(touched_head_, table_t::touched_head);
+    load(touched_body_, table_t::touched_body);
+    load(activity_head_, table_t::activity_head);
+    load(activity_body_, table_t::activity_body);
+
+    if (!ec) ec = execute(loads, event_t::load_file, handler);
+
+    // Loaded heads are not known to match any snapshot.
+    primary_generation_ = zero;
+    secondary_generation_ = zero;
 
     // create, open, and restore each invoke open_load.
     const auto dirty = header_body_.size() > schema::header::minrow;
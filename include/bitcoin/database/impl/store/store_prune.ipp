@@ -29,6 +29,12 @@ namespace database {
 TEMPLATE
 code CLASS::prune(const event_handler& handler) NOEXCEPT
 {
+    // Prune snapshots under its own locks, so excludes other snapshots.
+    while (!snapshot_mutex_.try_lock_for(std::chrono::seconds(1)))
+    {
+        handler(event_t::wait_lock, table_t::store);
+    }
+
     // Transactor lock generally only covers writes, but in this case prevout
     // reads must also be guarded since the body shrinks and head is cleared.
     while (!transactor_mutex_.try_lock_for(std::chrono::seconds(1)))
@@ -36,6 +42,14 @@ code CLASS::prune(const event_handler& handler) NOEXCEPT
         handler(event_t::wait_lock, table_t::store);
     }
 
+    // A rehash in progress must complete (or abort) before prune.
+    if (rehashing_ || rehash_fault_)
+    {
+        transactor_mutex_.unlock();
+        snapshot_mutex_.unlock();
+        return rehashing_ ? error::rehash_active : error::rehash_table;
+    }
+
     code ec{ error::success };
 
     // Prevouts resettable if all candidates confirmed (fork is candidate top).
@@ -89,6 +103,7 @@ code CLASS::prune(const event_handler& handler) NOEXCEPT
     }
 
     transactor_mutex_.unlock();
+    snapshot_mutex_.unlock();
     return ec;
 }
 
@@ -0,0 +1,175 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_STORE_REHASH_IPP
+#define LIBBITCOIN_DATABASE_STORE_REHASH_IPP
+
+#include <algorithm>
+#include <chrono>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// public
+TEMPLATE
+code CLASS::rehash(table_t table, size_t buckets,
+    const event_handler& handler) NOEXCEPT
+{
+    switch (table)
+    {
+        case table_t::point_table:
+            return rehash(point, point_head_, table, buckets, handler);
+        case table_t::tx_table:
+            return rehash(tx, tx_head_, table, buckets, handler);
+        case table_t::address_table:
+            return rehash(address, address_head_, table, buckets, handler);
+        default:
+            return error::rehash_table;
+    }
+}
+
+// protected
+TEMPLATE
+template <typename Table>
+code CLASS::rehash(Table& table, Storage<one>& head, table_t id,
+    size_t buckets, const event_handler& handler) NOEXCEPT
+{
+    // Each step suspends writers (and maintenance), not the entire rehash.
+    const auto exclusive = [this, &handler]() NOEXCEPT
+    {
+        while (!transactor_mutex_.try_lock_for(std::chrono::seconds(1)))
+        {
+            handler(event_t::wait_lock, table_t::store);
+        }
+    };
+
+    // Release the shadow head (no longer referenced by the table).
+    const auto release = [this]() NOEXCEPT
+    {
+        /* code */ shadow_head_.unload();
+        /* code */ shadow_head_.close();
+        /* bool */ file::remove(shadow_head_.file());
+    };
+
+    // Restore migrated lists to the head, as if rehash was never begun. If
+    // this fails the head is inconsistent, so the shadow is retained (as it
+    // may still be referenced) and close leaves the flush lock for restore.
+    const auto abort = [&]() NOEXCEPT
+    {
+        if (table.abort_rehash())
+            release();
+        else
+            rehash_fault_ = true;
+
+        rehashing_ = false;
+    };
+
+    exclusive();
+    if (rehashing_ || rehash_fault_)
+    {
+        transactor_mutex_.unlock();
+        return rehashing_ ? error::rehash_active : error::rehash_table;
+    }
+
+    // Shadow head is fully allocated at begin, so it is never remapped.
+    handler(event_t::rehash_table, id);
+    /* bool */ file::remove(shadow_head_.file());
+    auto ec = shadow_head_.create();
+    if (!ec) ec = shadow_head_.open();
+    if (!ec) ec = shadow_head_.load();
+    if (!ec && !table.begin_rehash(shadow_head_, buckets))
+        ec = error::rehash_table;
+
+    if (ec)
+    {
+        release();
+        transactor_mutex_.unlock();
+        return ec;
+    }
+
+    // Shadow is in use by the table until end (or failure) of rehash.
+    rehashing_ = true;
+    transactor_mutex_.unlock();
+
+    // Readers and writers proceed between steps, readers block during steps.
+    auto complete = false;
+    const auto range = std::max(one, size_t{ configuration_.rehash_range });
+    while (!ec && !complete)
+    {
+        exclusive();
+        handler(event_t::rehash_table, id);
+        if (!table.rehash(complete, range))
+        {
+            ec = error::rehash_table;
+            abort();
+        }
+
+        transactor_mutex_.unlock();
+    }
+
+    if (ec)
+        return ec;
+
+    // Replace head file with shadow file, reopened in the head storage.
+    const auto replace = [this, &head]() NOEXCEPT
+    {
+        if (shadow_head_.flush() || shadow_head_.unload() ||
+            shadow_head_.close() || head.unload() || head.close() ||
+            !file::rename(shadow_head_.file(), head.file()) ||
+            head.open() || head.load())
+            return false;
+
+        // Load resets head generation, heads are advanced in lockstep.
+        while (head.generation() < header_head_.generation())
+            head.advance();
+
+        return true;
+    };
+
+    // Snapshot generations are reset under snapshot lock (precedes transactor).
+    while (!snapshot_mutex_.try_lock_for(std::chrono::seconds(1)))
+    {
+        handler(event_t::wait_lock, table_t::store);
+    }
+
+    exclusive();
+    handler(event_t::rehash_table, id);
+    if (table.end_rehash(replace))
+    {
+        // Replaced head is unlike its prior dumps, so next snapshot is full.
+        rehashing_ = false;
+        primary_generation_ = zero;
+        secondary_generation_ = zero;
+    }
+    else
+    {
+        // Abort fails (fault) if replace failed after closing the head.
+        ec = error::rehash_table;
+        abort();
+    }
+
+    transactor_mutex_.unlock();
+    snapshot_mutex_.unlock();
+    return ec;
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
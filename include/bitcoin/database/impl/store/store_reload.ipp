@@ -62,6 +62,8 @@ code CLASS::reload(const event_handler& handler) NOEXCEPT
     reload(ec, ins_body_, table_t::ins_body);
     reload(ec, outs_head_, table_t::outs_head);
     reload(ec, outs_body_, table_t::outs_body);
+    reload(ec, spend_head_, table_t::spend_head);
+    reload(ec, spend_body_, table_t::spend_body);
     reload(ec, tx_head_, table_t::tx_head);
     reload(ec, tx_body_, table_t::tx_body);
     reload(ec, txs_head_, table_t::txs_head);
@@ -90,6 +92,8 @@ code CLASS::reload(const event_handler& handler) NOEXCEPT
     reload(ec, validated_bk_body_, table_t::validated_bk_body);
     reload(ec, validated_tx_head_, table_t::validated_tx_head);
     reload(ec, validated_tx_body_, table_t::validated_tx_body);
+    reload(ec, fee_tx_head_, table_t::fee_tx_head);
+    reload(ec, fee_tx_body_, table_t::fee_tx_body);
 
     reload(ec, address_head_, table_t::address_head);
     reload(ec, address_body_, table_t::address_body);
@@ -97,6 +101,14 @@ code CLASS::reload(const event_handler& handler) NOEXCEPT
     reload(ec, filter_bk_body_, table_t::filter_bk_body);
     reload(ec, filter_tx_head_, table_t::filter_tx_head);
     reload(ec, filter_tx_body_, table_t::filter_tx_body);
+    reload(ec, fee_bk_head_, table_t::fee_bk_head);
+    reload(ec, fee_bk_body_, table_t::fee_bk_body);
+    reload(ec, summary_head_, table_t::summary_head);
+    reload(ec, summary_body_, table_t::summary_body);
+    reload(ec, touched_head_, table_t::touched_head);
+    reload(ec, touched_body_, table_t::touched_body);
+    reload(ec, activity_head_, table_t::activity_head);
+    reload(ec, activity_body_, table_t::activity_body);
 
     transactor_mutex_.unlock();
     return ec;
@@ -47,6 +47,7 @@ void CLASS::report(const error_handler& handler) const NOEXCEPT
     report(point_body_, table_t::point_body);
     report(ins_body_, table_t::ins_body);
     report(outs_body_, table_t::outs_body);
+    report(spend_body_, table_t::spend_body);
     report(tx_body_, table_t::tx_body);
     report(txs_body_, table_t::txs_body);
     report(candidate_body_, table_t::candidate_body);
@@ -60,9 +61,46 @@ void CLASS::report(const error_handler& handler) const NOEXCEPT
     report(prevout_body_, table_t::prevout_body);
     report(validated_bk_body_, table_t::validated_bk_body);
     report(validated_tx_body_, table_t::validated_tx_body);
+    report(fee_tx_body_, table_t::fee_tx_body);
     report(address_body_, table_t::address_body);
     report(filter_bk_body_, table_t::filter_bk_body);
     report(filter_tx_body_, table_t::filter_tx_body);
+    report(fee_bk_body_, table_t::fee_bk_body);
+    report(summary_body_, table_t::summary_body);
+    report(touched_body_, table_t::touched_body);
+    report(activity_body_, table_t::activity_body);
+}
+
+// public
+TEMPLATE
+void CLASS::report(const statistics_handler& handler,
+    size_t samples) const NOEXCEPT
+{
+    const auto report = [&handler, samples](const auto& table,
+        table_t id) NOEXCEPT
+    {
+        hash_statistics statistics{};
+        if (table.get_statistics(statistics, samples))
+            handler(statistics, id);
+    };
+
+    report(header, table_t::header_table);
+    report(point, table_t::point_table);
+    report(tx, table_t::tx_table);
+    report(duplicate, table_t::duplicate_table);
+    report(validated_tx, table_t::validated_tx_table);
+    report(address, table_t::address_table);
+    report(summary, table_t::summary_table);
+    report(activity, table_t::activity_table);
+}
+
+// public
+TEMPLATE
+void CLASS::report_timing(const timing_handler& handler) const NOEXCEPT
+{
+    std::unique_lock lock{ timing_mutex_ };
+    for (const auto& [table, elapsed]: timing_)
+        handler(elapsed, table);
 }
 
 // public
@@ -76,6 +114,7 @@ code CLASS::get_fault() const NOEXCEPT
     if ((ec = point_body_.get_fault())) return ec;
     if ((ec = ins_body_.get_fault())) return ec;
     if ((ec = outs_body_.get_fault())) return ec;
+    if ((ec = spend_body_.get_fault())) return ec;
     if ((ec = tx_body_.get_fault())) return ec;
     if ((ec = txs_body_.get_fault())) return ec;
     if ((ec = candidate_body_.get_fault())) return ec;
@@ -89,9 +128,14 @@ code CLASS::get_fault() const NOEXCEPT
     if ((ec = prevout_body_.get_fault())) return ec;
     if ((ec = validated_bk_body_.get_fault())) return ec;
     if ((ec = validated_tx_body_.get_fault())) return ec;
+    if ((ec = fee_tx_body_.get_fault())) return ec;
     if ((ec = address_body_.get_fault())) return ec;
     if ((ec = filter_bk_body_.get_fault())) return ec;
     if ((ec = filter_tx_body_.get_fault())) return ec;
+    if ((ec = fee_bk_body_.get_fault())) return ec;
+    if ((ec = summary_body_.get_fault())) return ec;
+    if ((ec = touched_body_.get_fault())) return ec;
+    if ((ec = activity_body_.get_fault())) return ec;
     return ec;
 }
 
@@ -111,6 +155,7 @@ size_t CLASS::get_space() const NOEXCEPT
     space(point_body_);
     space(ins_body_);
     space(outs_body_);
+    space(spend_body_);
     space(tx_body_);
     space(txs_body_);
     space(candidate_body_);
@@ -124,9 +169,14 @@ size_t CLASS::get_space() const NOEXCEPT
     space(prevout_body_);
     space(validated_bk_body_);
     space(validated_tx_body_);
+    space(fee_tx_body_);
     space(address_body_);
     space(filter_bk_body_);
     space(filter_tx_body_);
+    space(fee_bk_body_);
+    space(summary_body_);
+    space(touched_body_);
+    space(activity_body_);
 
     return total;
 }
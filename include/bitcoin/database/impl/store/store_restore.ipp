@@ -97,6 +97,13 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
         }
     };
 
+    // A rehashed head implies its bucket count, which supersedes settings.
+    const auto adopt = [](code& ec, auto& logical) NOEXCEPT
+    {
+        if (!ec && !logical.adopt())
+            ec = error::restore_table;
+    };
+
     const auto dropped = [&handler](code& ec, auto& logical,
         table_t table) NOEXCEPT
     {
@@ -108,17 +115,32 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
         }
     };
 
+    // Links above the restored snapshot are reassigned.
+    header_objects.clear();
+    tx_objects.clear();
+    strong_contexts.clear();
+    candidate_fields.clear();
+
     if (!ec)
         ec = open_load(handler);
 
     if (!ec)
     {
+        adopt(ec, point);
+        adopt(ec, tx);
+        adopt(ec, address);
+
+        // Prior (hashmap) strong_tx layout is nullified, rebuilt by migrate_strong.
+        if (!ec && strong_tx.obsolete() && !strong_tx.reset_obsolete())
+            ec = error::restore_table;
+
         restore(ec, header, table_t::header_table);
         restore(ec, input, table_t::input_table);
         restore(ec, output, table_t::output_table);
         restore(ec, point, table_t::point_table);
         restore(ec, ins, table_t::ins_table);
         restore(ec, outs, table_t::outs_table);
+        restore(ec, spend, table_t::spend_table);
         restore(ec, tx, table_t::tx_table);
         restore(ec, txs, table_t::txs_table);
 
@@ -134,10 +156,15 @@ code CLASS::restore(const event_handler& handler) NOEXCEPT
         restore(ec, prevout, table_t::prevout_table);
         restore(ec, validated_bk, table_t::validated_bk_table);
         restore(ec, validated_tx, table_t::validated_tx_table);
+        restore(ec, fee_tx, table_t::fee_tx_table);
 
         restore(ec, address, table_t::address_table);
         restore(ec, filter_bk, table_t::filter_bk_table);
         restore(ec, filter_tx, table_t::filter_tx_table);
+        restore(ec, fee_bk, table_t::fee_bk_table);
+        restore(ec, summary, table_t::summary_table);
+        restore(ec, touched, table_t::touched_table);
+        restore(ec, activity, table_t::activity_table);
 
         if (ec)
             /* code */ unload_close(handler);
@@ -29,50 +29,82 @@ namespace database {
 TEMPLATE
 code CLASS::snapshot(const event_handler& handler, bool prune) NOEXCEPT
 {
+    // Prune holds both locks across its snapshot.
+    while (!prune && !snapshot_mutex_.try_lock_for(std::chrono::seconds(1)))
+    {
+        handler(event_t::wait_lock, table_t::store);
+    }
+
     while (!prune && !transactor_mutex_.try_lock_for(std::chrono::seconds(1)))
     {
         handler(event_t::wait_lock, table_t::store);
     }
 
-    code ec{ error::success };
-    const auto flush = [&handler](code& ec, auto& file, table_t table) NOEXCEPT
+    // A rehash in progress must complete (or abort) before snapshot.
+    // Prune precludes rehash under its own lock.
+    if (!prune && (rehashing_ || rehash_fault_))
+    {
+        transactor_mutex_.unlock();
+        snapshot_mutex_.unlock();
+        return rehashing_ ? error::rehash_active : error::rehash_table;
+    }
+
+    // Writes are suspended only to set body counts and copy heads to memory.
+    clear_timing();
+    head_images images{};
+    auto ec = capture(images, handler, prune);
+    if (!prune) transactor_mutex_.unlock();
+
+    // Bodies are flushed (at least) to captured counts and heads are archived
+    // while writes proceed. Records beyond captured counts are truncated upon
+    // restore, and the prior snapshot remains valid until the final rename.
+    tasks flushes{};
+    const auto incremental = configuration_.incremental_snapshot;
+    const auto flush = [&flushes, incremental](auto& file,
+        table_t table) NOEXCEPT
     {
-        if (!ec)
+        flushes.push_back({ table, [&file, incremental]() NOEXCEPT
         {
-            handler(event_t::flush_body, table);
-            ec = file.flush();
-        }
+            return incremental ? file.flush_appended() : file.flush();
+        } });
     };
 
     // Assumes/requires tables open/loaded.
-    flush(ec, header_body_, table_t::header_body);
-    flush(ec, input_body_, table_t::input_body);
-    flush(ec, output_body_, table_t::output_body);
-    flush(ec, point_body_, table_t::point_body);
-    flush(ec, ins_body_, table_t::ins_body);
-    flush(ec, outs_body_, table_t::outs_body);
-    flush(ec, tx_body_, table_t::tx_body);
-    flush(ec, txs_body_, table_t::txs_body);
+    flush(header_body_, table_t::header_body);
+    flush(input_body_, table_t::input_body);
+    flush(output_body_, table_t::output_body);
+    flush(point_body_, table_t::point_body);
+    flush(ins_body_, table_t::ins_body);
+    flush(outs_body_, table_t::outs_body);
+    flush(spend_body_, table_t::spend_body);
+    flush(tx_body_, table_t::tx_body);
+    flush(txs_body_, table_t::txs_body);
 
-    flush(ec, candidate_body_, table_t::candidate_body);
-    flush(ec, confirmed_body_, table_t::confirmed_body);
-    flush(ec, strong_tx_body_, table_t::strong_tx_body);
+    flush(candidate_body_, table_t::candidate_body);
+    flush(confirmed_body_, table_t::confirmed_body);
+    flush(strong_tx_body_, table_t::strong_tx_body);
 
-    flush(ec, ecdsa_body_, table_t::ecdsa_body);
-    flush(ec, schnorr_body_, table_t::schnorr_body);
-    flush(ec, silent_body_, table_t::silent_body);
-    flush(ec, duplicate_body_, table_t::duplicate_body);
-    flush(ec, prevalid_body_, table_t::prevalid_body);
-    if (!prune) flush(ec, prevout_body_, table_t::prevout_body);
-    flush(ec, validated_bk_body_, table_t::validated_bk_body);
-    flush(ec, validated_tx_body_, table_t::validated_tx_body);
+    flush(ecdsa_body_, table_t::ecdsa_body);
+    flush(schnorr_body_, table_t::schnorr_body);
+    flush(silent_body_, table_t::silent_body);
+    flush(duplicate_body_, table_t::duplicate_body);
+    flush(prevalid_body_, table_t::prevalid_body);
+    if (!prune) flush(prevout_body_, table_t::prevout_body);
+    flush(validated_bk_body_, table_t::validated_bk_body);
+    flush(validated_tx_body_, table_t::validated_tx_body);
+    flush(fee_tx_body_, table_t::fee_tx_body);
 
-    flush(ec, address_body_, table_t::address_body);
-    flush(ec, filter_bk_body_, table_t::filter_bk_body);
-    flush(ec, filter_tx_body_, table_t::filter_tx_body);
+    flush(address_body_, table_t::address_body);
+    flush(filter_bk_body_, table_t::filter_bk_body);
+    flush(filter_tx_body_, table_t::filter_tx_body);
+    flush(fee_bk_body_, table_t::fee_bk_body);
+    flush(summary_body_, table_t::summary_body);
+    flush(touched_body_, table_t::touched_body);
+    flush(activity_body_, table_t::activity_body);
 
-    if (!ec) ec = backup(handler, prune);
-    if (!prune) transactor_mutex_.unlock();
+    if (!ec) ec = execute(flushes, event_t::flush_body, handler);
+    if (!ec) ec = persist(images, handler);
+    if (!prune) snapshot_mutex_.unlock();
     return ec;
 }
 
@@ -48,6 +48,9 @@ const CLASS::table_map CLASS::tables
     { table_t::outs_table, "outs_table" },
     { table_t::outs_head, "outs_head" },
     { table_t::outs_body, "outs_body" },
+    { table_t::spend_table, "spend_table" },
+    { table_t::spend_head, "spend_head" },
+    { table_t::spend_body, "spend_body" },
     { table_t::tx_table, "tx_table" },
     { table_t::tx_head, "tx_head" },
     { table_t::txs_table, "txs_table" },
@@ -91,6 +94,9 @@ const CLASS::table_map CLASS::tables
     { table_t::validated_tx_table, "validated_tx_table" },
     { table_t::validated_tx_head, "validated_tx_head" },
     { table_t::validated_tx_body, "validated_tx_body" },
+    { table_t::fee_tx_table, "fee_tx_table" },
+    { table_t::fee_tx_head, "fee_tx_head" },
+    { table_t::fee_tx_body, "fee_tx_body" },
 
     // Optionals.
     { table_t::address_table, "address_table" },
@@ -101,7 +107,19 @@ const CLASS::table_map CLASS::tables
     { table_t::filter_bk_body, "filter_bk_body" },
     { table_t::filter_tx_table, "filter_tx_table" },
     { table_t::filter_tx_head, "filter_tx_head" },
-    { table_t::filter_tx_body, "filter_tx_body" }
+    { table_t::filter_tx_body, "filter_tx_body" },
+    { table_t::fee_bk_table, "fee_bk_table" },
+    { table_t::fee_bk_head, "fee_bk_head" },
+    { table_t::fee_bk_body, "fee_bk_body" },
+    { table_t::summary_table, "summary_table" },
+    { table_t::summary_head, "summary_head" },
+    { table_t::summary_body, "summary_body" },
+    { table_t::touched_table, "touched_table" },
+    { table_t::touched_head, "touched_head" },
+    { table_t::touched_body, "touched_body" },
+    { table_t::activity_table, "activity_table" },
+    { table_t::activity_head, "activity_head" },
+    { table_t::activity_body, "activity_body" }
 };
 
 } // namespace database
@@ -28,120 +28,148 @@ namespace database {
 TEMPLATE
 code CLASS::unload_close(const event_handler& handler) NOEXCEPT
 {
-    code ec{ error::success };
-    const auto unload = [&handler](code& ec, auto& file, table_t table) NOEXCEPT
+    clear_timing();
+    tasks unloads{};
+    const auto unload = [&unloads](auto& file, table_t table) NOEXCEPT
     {
-        if (!ec)
+        unloads.push_back({ table, [&file]() NOEXCEPT
         {
-            handler(event_t::unload_file, table);
-            ec = file.unload();
-        }
+            return file.unload();
+        } });
     };
 
-    unload(ec, header_head_, table_t::header_head);
-    unload(ec, header_body_, table_t::header_body);
-    unload(ec, input_head_, table_t::input_head);
-    unload(ec, input_body_, table_t::input_body);
-    unload(ec, output_head_, table_t::output_head);
-    unload(ec, output_body_, table_t::output_body);
-    unload(ec, point_head_, table_t::point_head);
-    unload(ec, point_body_, table_t::point_body);
-    unload(ec, ins_head_, table_t::ins_head);
-    unload(ec, ins_body_, table_t::ins_body);
-    unload(ec, outs_head_, table_t::outs_head);
-    unload(ec, outs_body_, table_t::outs_body);
-    unload(ec, tx_head_, table_t::tx_head);
-    unload(ec, tx_body_, table_t::tx_body);
-    unload(ec, txs_head_, table_t::txs_head);
-    unload(ec, txs_body_, table_t::txs_body);
-
-    unload(ec, candidate_head_, table_t::candidate_head);
-    unload(ec, candidate_body_, table_t::candidate_body);
-    unload(ec, confirmed_head_, table_t::confirmed_head);
-    unload(ec, confirmed_body_, table_t::confirmed_body);
-    unload(ec, strong_tx_head_, table_t::strong_tx_head);
-    unload(ec, strong_tx_body_, table_t::strong_tx_body);
-
-    unload(ec, ecdsa_head_, table_t::ecdsa_head);
-    unload(ec, ecdsa_body_, table_t::ecdsa_body);
-    unload(ec, schnorr_head_, table_t::schnorr_head);
-    unload(ec, schnorr_body_, table_t::schnorr_body);
-    unload(ec, silent_head_, table_t::silent_head);
-    unload(ec, silent_body_, table_t::silent_body);
-    unload(ec, duplicate_head_, table_t::duplicate_head);
-    unload(ec, duplicate_body_, table_t::duplicate_body);
-    unload(ec, prevalid_head_, table_t::prevalid_head);
-    unload(ec, prevalid_body_, table_t::prevalid_body);
-    unload(ec, prevout_head_, table_t::prevout_head);
-    unload(ec, prevout_body_, table_t::prevout_body);
-    unload(ec, validated_bk_head_, table_t::validated_bk_head);
-    unload(ec, validated_bk_body_, table_t::validated_bk_body);
-    unload(ec, validated_tx_head_, table_t::validated_tx_head);
-    unload(ec, validated_tx_body_, table_t::validated_tx_body);
-
-    unload(ec, address_head_, table_t::address_head);
-    unload(ec, address_body_, table_t::address_body);
-    unload(ec, filter_bk_head_, table_t::filter_bk_head);
-    unload(ec, filter_bk_body_, table_t::filter_bk_body);
-    unload(ec, filter_tx_head_, table_t::filter_tx_head);
-    unload(ec, filter_tx_body_, table_t::filter_tx_body);
-
-    const auto close = [&handler](code& ec, auto& file, table_t table) NOEXCEPT
+    unload(header_head_, table_t::header_head);
+    unload(header_body_, table_t::header_body);
+    unload(input_head_, table_t::input_head);
+    unload(input_body_, table_t::input_body);
+    unload(output_head_, table_t::output_head);
+    unload(output_body_, table_t::output_body);
+    unload(point_head_, table_t::point_head);
+    unload(point_body_, table_t::point_body);
+    unload(ins_head_, table_t::ins_head);
+    unload(ins_body_, table_t::ins_body);
+    unload(outs_head_, table_t::outs_head);
+    unload(outs_body_, table_t::outs_body);
+    unload(spend_head_, table_t::spend_head);
+    unload(spend_body_, table_t::spend_body);
+    unload(tx_head_, table_t::tx_head);
+    unload(tx_body_, table_t::tx_body);
+    unload(txs_head_, table_t::txs_head);
+    unload(txs_body_, table_t::txs_body);
+
+    unload(candidate_head_, table_t::candidate_head);
+    unload(candidate_body_, table_t::candidate_body);
+    unload(confirmed_head_, table_t::confirmed_head);
+    unload(confirmed_body_, table_t::confirmed_body);
+    unload(strong_tx_head_, table_t::strong_tx_head);
+    unload(strong_tx_body_, table_t::strong_tx_body);
+
+    unload(ecdsa_head_, table_t::ecdsa_head);
+    unload(ecdsa_body_, table_t::ecdsa_body);
+    unload(schnorr_head_, table_t::schnorr_head);
+    unload(schnorr_body_, table_t::schnorr_body);
+    unload(silent_head_, table_t::silent_head);
+    unload(silent_body_, table_t::silent_body);
+    unload(duplicate_head_, table_t::duplicate_head);
+    unload(duplicate_body_, table_t::duplicate_body);
+    unload(prevalid_head_, table_t::prevalid_head);
+    unload(prevalid_body_, table_t::prevalid_body);
+    unload(prevout_head_, table_t::prevout_head);
+    unload(prevout_body_, table_t::prevout_body);
+    unload(validated_bk_head_, table_t::validated_bk_head);
+    unload(validated_bk_body_, table_t::validated_bk_body);
+    unload(validated_tx_head_, table_t::validated_tx_head);
+    unload(validated_tx_body_, table_t::validated_tx_body);
+    unload(fee_tx_head_, table_t::fee_tx_head);
+    unload(fee_tx_body_, table_t::fee_tx_body);
+
+    unload(address_head_, table_t::address_head);
+    unload(address_body_, table_t::address_body);
+    unload(filter_bk_head_, table_t::filter_bk_head);
+    unload(filter_bk_body_, table_t::filter_bk_body);
+    unload(filter_tx_head_, table_t::filter_tx_head);
+    unload(filter_tx_body_, table_t::filter_tx_body);
+    unload(fee_bk_head_, table_t::fee_bk_head);
+    unload(fee_bk_body_, table_t::fee_bk_body);
+    unload(summary_head_, table_t::summary_head);
+    unload(summary_body_, table_t::summary_body);
+    unload(touched_head_, table_t::touched_head);
+    unload(touched_body_, table_t::touched_body);
+    unload(activity_head_, table_t::activity_head);
+    unload(activity_body_, table_t::activity_body);
+
+    auto ec = execute(unloads, event_t::unload_file, handler);
+
+    tasks closes{};
+    const auto close = [&closes](auto& file, table_t table) NOEXCEPT
     {
-        if (!ec)
+        closes.push_back({ table, [&file]() NOEXCEPT
         {
-            handler(event_t::close_file, table);
-            ec = file.close();
-        }
+            return file.close();
+        } });
     };
 
-    close(ec, header_head_, table_t::header_head);
-    close(ec, header_body_, table_t::header_body);
-    close(ec, input_head_, table_t::input_head);
-    close(ec, input_body_, table_t::input_body);
-    close(ec, output_head_, table_t::output_head);
-    close(ec, output_body_, table_t::output_body);
-    close(ec, point_head_, table_t::point_head);
-    close(ec, point_body_, table_t::point_body);
-    close(ec, ins_head_, table_t::ins_head);
-    close(ec, ins_body_, table_t::ins_body);
-    close(ec, outs_head_, table_t::outs_head);
-    close(ec, outs_body_, table_t::outs_body);
-    close(ec, tx_head_, table_t::tx_head);
-    close(ec, tx_body_, table_t::tx_body);
-    close(ec, txs_head_, table_t::txs_head);
-    close(ec, txs_body_, table_t::txs_body);
-
-    close(ec, candidate_head_, table_t::candidate_head);
-    close(ec, candidate_body_, table_t::candidate_body);
-    close(ec, confirmed_head_, table_t::confirmed_head);
-    close(ec, confirmed_body_, table_t::confirmed_body);
-    close(ec, strong_tx_head_, table_t::strong_tx_head);
-    close(ec, strong_tx_body_, table_t::strong_tx_body);
-
-    close(ec, ecdsa_head_, table_t::ecdsa_head);
-    close(ec, ecdsa_body_, table_t::ecdsa_body);
-    close(ec, schnorr_head_, table_t::schnorr_head);
-    close(ec, schnorr_body_, table_t::schnorr_body);
-    close(ec, silent_head_, table_t::silent_head);
-    close(ec, silent_body_, table_t::silent_body);
-    close(ec, duplicate_head_, table_t::duplicate_head);
-    close(ec, duplicate_body_, table_t::duplicate_body);
-    close(ec, prevalid_head_, table_t::prevalid_head);
-    close(ec, prevalid_body_, table_t::prevalid_body);
-    close(ec, prevout_head_, table_t::prevout_head);
-    close(ec, prevout_body_, table_t::prevout_body);
-    close(ec, validated_bk_head_, table_t::validated_bk_head);
-    close(ec, validated_bk_body_, table_t::validated_bk_body);
-    close(ec, validated_tx_head_, table_t::validated_tx_head);
-    close(ec, validated_tx_body_, table_t::validated_tx_body);
-
-    close(ec, address_head_, table_t::address_head);
-    close(ec, address_body_, table_t::address_body);
-    close(ec, filter_bk_head_, table_t::filter_bk_head);
-    close(ec, filter_bk_body_, table_t::filter_bk_body);
-    close(ec, filter_tx_head_, table_t::filter_tx_head);
-    close(ec, filter_tx_body_, table_t::filter_tx_body);
+    close(header_head_, table_t::header_head);
+    close(header_body_, table_t::header_body);
+    close(input_head_, table_t::input_head);
+    close(input_body_, table_t::input_body);
+    close(output_head_, table_t::output_head);
+    close(output_body_, table_t::output_body);
+    close(point_head_, table_t::point_head);
+    close(point_body_, table_t::point_body);
+    close(ins_head_, table_t::ins_head);
+    close(ins_body_, table_t::ins_body);
+    close(outs_head_, table_t::outs_head);
+    close(outs_body_, table_t::outs_body);
+    close(spend_head_, table_t::spend_head);
+    close(spend_body_, table_t::spend_body);
+    close(tx_head_, table_t::tx_head);
+    close(tx_body_, table_t::tx_body);
+    close(txs_head_, table_t::txs_head);
+    close(txs_body_, table_t::txs_body);
+
+    close(candidate_head_, table_t::candidate_head);
+    close(candidate_body_, table_t::candidate_body);
+    close(confirmed_head_, table_t::confirmed_head);
+    close(confirmed_body_, table_t::confirmed_body);
+    close(strong_tx_head_, table_t::strong_tx_head);
+    close(strong_tx_body_, table_t::strong_tx_body);
+
+    close(ecdsa_head_, table_t::ecdsa_head);
+    close(ecdsa_body_, table_t::ecdsa_body);
+    close(schnorr_head_, table_t::schnorr_head);
+    close(schnorr_body_, table_t::schnorr_body);
+    close(silent_head_, table_t::silent_head);
+    close(silent_body_, table_t::silent_body);
+    close(duplicate_head_, table_t::duplicate_head);
+    close(duplicate_body_, table_t::duplicate_body);
+    close(prevalid_head_, table_t::prevalid_head);
+    close(prevalid_body_, table_t::prevalid_body);
+    close(prevout_head_, table_t::prevout_head);
+    close(prevout_body_, table_t::prevout_body);
+    close(validated_bk_head_, table_t::validated_bk_head);
+    close(validated_bk_body_, table_t::validated_bk_body);
+    close(validated_tx_head_, table_t::validated_tx_head);
+    close(validated_tx_body_, table_t::validated_tx_body);
+    close(fee_tx_head_, table_t::fee_tx_head);
+    close(fee_tx_body_, table_t::fee_tx_body);
+
+    close(address_head_, table_t::address_head);
+    close(address_body_, table_t::address_body);
+    close(filter_bk_head_, table_t::filter_bk_head);
+    close(filter_bk_body_, table_t::filter_bk_body);
+    close(filter_tx_head_, table_t::filter_tx_head);
+    close(filter_tx_body_, table_t::filter_tx_body);
+    close(fee_bk_head_, table_t::fee_bk_head);
+    close(fee_bk_body_, table_t::fee_bk_body);
+    close(summary_head_, table_t::summary_head);
+    close(summary_body_, table_t::summary_body);
+    close(touched_head_, table_t::touched_head);
+    close(touched_body_, table_t::touched_body);
+    close(activity_head_, table_t::activity_head);
+    close(activity_body_, table_t::activity_body);
+
+    if (!ec) ec = execute(closes, event_t::close_file, handler);
 
     return ec;
 }
@@ -0,0 +1,93 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_STORE_WRITEBACK_IPP
+#define LIBBITCOIN_DATABASE_STORE_WRITEBACK_IPP
+
+#include <mutex>
+#include <shared_mutex>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+// public
+TEMPLATE
+code CLASS::writeback(const event_handler& handler) NOEXCEPT
+{
+    const auto bytes = configuration_.writeback_bytes;
+    if (is_zero(bytes))
+        return error::success;
+
+    // Concurrent with writers (shared), skipped while writes are suspended,
+    // such as by close (which flushes all bodies).
+    std::shared_lock lock{ transactor_mutex_, std::try_to_lock };
+    if (!lock.owns_lock())
+        return error::success;
+
+    tasks writebacks{};
+    const auto writeback = [&writebacks, bytes](auto& file,
+        table_t table) NOEXCEPT
+    {
+        writebacks.push_back({ table, [&file, bytes]() NOEXCEPT
+        {
+            return file.writeback(bytes);
+        } });
+    };
+
+    // Assumes/requires tables open/loaded.
+    writeback(header_body_, table_t::header_body);
+    writeback(input_body_, table_t::input_body);
+    writeback(output_body_, table_t::output_body);
+    writeback(point_body_, table_t::point_body);
+    writeback(ins_body_, table_t::ins_body);
+    writeback(outs_body_, table_t::outs_body);
+    writeback(spend_body_, table_t::spend_body);
+    writeback(tx_body_, table_t::tx_body);
+    writeback(txs_body_, table_t::txs_body);
+
+    writeback(candidate_body_, table_t::candidate_body);
+    writeback(confirmed_body_, table_t::confirmed_body);
+    writeback(strong_tx_body_, table_t::strong_tx_body);
+
+    writeback(ecdsa_body_, table_t::ecdsa_body);
+    writeback(schnorr_body_, table_t::schnorr_body);
+    writeback(silent_body_, table_t::silent_body);
+    writeback(duplicate_body_, table_t::duplicate_body);
+    writeback(prevalid_body_, table_t::prevalid_body);
+    writeback(prevout_body_, table_t::prevout_body);
+    writeback(validated_bk_body_, table_t::validated_bk_body);
+    writeback(validated_tx_body_, table_t::validated_tx_body);
+    writeback(fee_tx_body_, table_t::fee_tx_body);
+
+    writeback(address_body_, table_t::address_body);
+    writeback(filter_bk_body_, table_t::filter_bk_body);
+    writeback(filter_tx_body_, table_t::filter_tx_body);
+    writeback(fee_bk_body_, table_t::fee_bk_body);
+    writeback(summary_body_, table_t::summary_body);
+    writeback(touched_body_, table_t::touched_body);
+    writeback(activity_body_, table_t::activity_body);
+
+    // Periodic (background) writeback is not open/snapshot/close timing.
+    return execute(writebacks, event_t::writeback_body, handler, false);
+}
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
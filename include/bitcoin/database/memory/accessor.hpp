@@ -27,7 +27,8 @@ namespace libbitcoin {
 namespace database {
 
 /// Shared r/w access to a memory buffer, mutex blocks memory remap.
-template <typename Mutex>
+/// An exclusive Lock type blocks all other guarded access (and remap).
+template <typename Mutex, typename Lock = std::shared_lock<Mutex>>
 class accessor
   : public memory
 {
@@ -60,14 +61,14 @@ public:
 private:
     uint8_t* begin_{};
     uint8_t* end_{};
-    std::shared_lock<Mutex> shared_lock_;
+    Lock lock_;
 };
 
 } // namespace database
 } // namespace libbitcoin
 
-#define TEMPLATE template <typename Mutex>
-#define CLASS accessor<Mutex>
+#define TEMPLATE template <typename Mutex, typename Lock>
+#define CLASS accessor<Mutex, Lock>
 
 #include <bitcoin/database/impl/memory/accessor.ipp>
 
@@ -0,0 +1,117 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_FIELDS_CACHE_HPP
+#define LIBBITCOIN_DATABASE_MEMORY_FIELDS_CACHE_HPP
+
+#include <shared_mutex>
+#include <vector>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Thread safe in-memory columns of candidate header link, version, timestamp,
+/// bits and mtp by height. Columns are dense by height (20 bytes per block)
+/// and always a prefix of the candidate index, so chain state population is a
+/// contiguous copy. Positive only, a miss must defer to the store.
+template <typename Header>
+class fields_cache
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(fields_cache);
+
+    struct fields
+    {
+        uint32_t version{};
+        uint32_t timestamp{};
+        uint32_t bits{};
+        uint32_t mtp{};
+    };
+
+    fields_cache(bool enabled) NOEXCEPT;
+
+    /// True if constructed enabled.
+    bool enabled() const NOEXCEPT;
+
+    /// Count of cached heights (from zero).
+    size_t count() const NOEXCEPT;
+
+    /// Cache candidate at height, ignored unless height is count.
+    void push(const Header& link, size_t height,
+        const fields& values) NOEXCEPT;
+
+    /// Uncache candidates at and above height.
+    void pop(size_t height) NOEXCEPT;
+
+    /// Copy count values ending at height to out (false if not cached).
+    /// Link is the block at height, to which the values are ancestral, or
+    /// terminal if the block at height is the (cached) candidate.
+    template <typename Iterator>
+    bool get_versions(Iterator out, size_t count, size_t height,
+        const Header& link={}) const NOEXCEPT;
+    template <typename Iterator>
+    bool get_timestamps(Iterator out, size_t count, size_t height,
+        const Header& link={}) const NOEXCEPT;
+    template <typename Iterator>
+    bool get_bits(Iterator out, size_t count, size_t height,
+        const Header& link={}) const NOEXCEPT;
+    template <typename Iterator>
+    bool get_mtps(Iterator out, size_t count, size_t height,
+        const Header& link={}) const NOEXCEPT;
+
+    /// Timestamp at height of the block (link) at or above it (false if not
+    /// cached).
+    bool get_timestamp(uint32_t& out, size_t at, size_t height,
+        const Header& link={}) const NOEXCEPT;
+
+    /// Remove all entries (retains allocation).
+    void clear() NOEXCEPT;
+
+private:
+    using column = std::vector<uint32_t>;
+
+    template <typename Iterator>
+    bool copy(Iterator out, const column& values, size_t count,
+        size_t height, const Header& link) const NOEXCEPT;
+    bool is_cached(size_t height, const Header& link) const NOEXCEPT;
+
+    // This is thread safe.
+    const bool enabled_;
+
+    // These are protected by mutex_.
+    mutable std::shared_mutex mutex_{};
+    column links_{};
+    column versions_{};
+    column timestamps_{};
+    column bits_{};
+    column mtps_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#define TEMPLATE template <typename Header>
+#define CLASS fields_cache<Header>
+
+#include <bitcoin/database/impl/memory/fields_cache.ipp>
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
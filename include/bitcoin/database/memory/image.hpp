@@ -0,0 +1,62 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_IMAGE_HPP
+#define LIBBITCOIN_DATABASE_MEMORY_IMAGE_HPP
+
+#include <filesystem>
+#include <vector>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Copy of a memory map captured for a deferred dump. Either the full map or
+/// a patch of the pages marked since the generation of a prior dump file.
+struct BCD_API image
+{
+    using path = std::filesystem::path;
+
+    /// Write the full map to a new file (must not exist), or write the patch
+    /// pages to the existing prior dump file (must exist), or move the staged
+    /// full map file to path.
+    code dump(const path& path) const NOEXCEPT;
+
+    /// True if the captured data is a patch of pages.
+    bool patch{};
+
+    /// Byte size of the map as of capture.
+    size_t size{};
+
+    /// Bytes per patch page (the last page may be partial).
+    size_t page{};
+
+    /// Indexes of the patch pages, in order.
+    std::vector<size_t> pages{};
+
+    /// The full map, or the concatenated patch pages.
+    system::data_chunk data{};
+
+    /// File of the full map dumped at capture (in place of data), if any.
+    path staged{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
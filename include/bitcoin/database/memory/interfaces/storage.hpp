@@ -21,6 +21,7 @@
 
 #include <filesystem>
 #include <bitcoin/database/define.hpp>
+#include <bitcoin/database/memory/image.hpp>
 #include <bitcoin/database/memory/interfaces/memory.hpp>
 
 namespace libbitcoin {
@@ -61,6 +62,13 @@ public:
     /// Flush memory map to disk, suspend writes for call, must be loaded.
     virtual code flush() NOEXCEPT = 0;
 
+    /// Flush rows appended since last load/flush, skip if none (append-only).
+    virtual code flush_appended() NOEXCEPT = 0;
+
+    /// Initiate writeback of rows appended since last writeback/flush if at
+    /// least bytes, without waiting for completion (does not suspend writes).
+    virtual code writeback(size_t bytes) NOEXCEPT = 0;
+
     /// Flush, unmap and truncate to logical, restartable, idempotent.
     virtual code unload() NOEXCEPT = 0;
 
@@ -70,6 +78,23 @@ public:
     /// Dump current logical map to a new file in path, must not exist.
     virtual code dump(const path& path) const NOEXCEPT = 0;
 
+    /// Patch a dump of the given generation with pages marked since, or dump
+    /// in full if zero generation, untracked pages, or dump size mismatch.
+    virtual code dump(const path& path, size_t since) const NOEXCEPT = 0;
+
+    /// Capture the logical map for a deferred dump, as a patch of the prior
+    /// dump at path if dump(path, since) would patch it, otherwise in full.
+    /// A capture over limit bytes is instead dumped in full to staged file.
+    virtual code capture(image& out, const path& path, size_t since,
+        size_t limit=max_size_t, const path& staged={}) const NOEXCEPT = 0;
+
+    /// Record a direct write of bytes at offset, for incremental dump.
+    virtual void mark(size_t offset, size_t bytes=one) NOEXCEPT = 0;
+
+    /// Write generation (reset by load), advance after a set of dumps.
+    virtual size_t generation() const NOEXCEPT = 0;
+    virtual void advance() NOEXCEPT = 0;
+
     /// Current of rows/bytes in map (zero if closed).
     virtual size_t size() const NOEXCEPT = 0;
 
@@ -92,6 +117,11 @@ public:
     /// Pointer is constrained to starting write within full capacity.
     virtual memory_ptr get_capacity(size_t offset=zero) const NOEXCEPT = 0;
 
+    /// Get exclusive r/w access to start of memory map (or null), within
+    /// logical. Blocks all remap-protected access until released, so must not
+    /// be obtained while the calling thread holds any access to the storage.
+    virtual memory_ptr get_exclusive() const NOEXCEPT = 0;
+
     /// Get unprotected r/w access to start/offset of memory map (or null).
     /// Pointer is constrained to starting write within full capacity.
     virtual memory::iterator get_raw(size_t offset=zero) const NOEXCEPT = 0;
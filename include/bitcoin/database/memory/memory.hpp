@@ -20,12 +20,20 @@
 #define LIBBITCOIN_DATABASE_MEMORY_MEMORY_HPP
 
 #include <bitcoin/database/memory/accessor.hpp>
+#include <bitcoin/database/memory/fields_cache.hpp>
 #include <bitcoin/database/memory/finalizer.hpp>
+#include <bitcoin/database/memory/image.hpp>
 #include <bitcoin/database/memory/interfaces/memory.hpp>
 #include <bitcoin/database/memory/interfaces/storage.hpp>
 #include <bitcoin/database/memory/mman.hpp>
 #include <bitcoin/database/memory/mmap.hpp>
 #include <bitcoin/database/memory/mmaps.hpp>
+#include <bitcoin/database/memory/object_cache.hpp>
+#include <bitcoin/database/memory/pool.hpp>
+#include <bitcoin/database/memory/recycler.hpp>
 #include <bitcoin/database/memory/streamers.hpp>
+#include <bitcoin/database/memory/striped_mutex.hpp>
+#include <bitcoin/database/memory/strong_cache.hpp>
+#include <bitcoin/database/memory/wire_iov.hpp>
 
 #endif
@@ -24,15 +24,38 @@
 #include <mutex>
 #include <shared_mutex>
 #include <tuple>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/file/file.hpp>
 #include <bitcoin/database/memory/accessor.hpp>
+#include <bitcoin/database/memory/recycler.hpp>
+#include <bitcoin/database/memory/striped_mutex.hpp>
 #include <bitcoin/database/memory/interfaces/memory.hpp>
 #include <bitcoin/database/memory/interfaces/storage.hpp>
 
 namespace libbitcoin {
 namespace database {
 
+/// Optional mapping behaviors, applied at each map/remap where supported.
+struct map_options
+{
+    /// Advise transparent huge pages (MADV_HUGEPAGE).
+    bool huge{ false };
+
+    /// Prefault the mapping (MAP_POPULATE, MADV_POPULATE_WRITE on remap).
+    bool populate{ false };
+
+    /// Lock the mapping into memory (mlock), subject to RLIMIT_MEMLOCK.
+    bool lock{ false };
+
+    /// Reserve address space of this many bytes per column (zero disables),
+    /// so that growth within it maps in place and takes no remap lock.
+    size_t reserve{ zero };
+
+    /// Resident byte budget per column of pool storage (zero is unbounded).
+    size_t resident{ zero };
+};
+
 /// Thread safe access to a memory-mapped file, or to a set of column files
 /// sharing one allocation/remap guard set (SoA aggregate).
 /// A slab has a row width of 1, so "count" implies "bytes" for slabs below.
@@ -60,11 +83,13 @@ public:
 
     /// Scalar construction (columns == 1): unchanged signature and codegen.
     mmap(const path& filename, size_t minimum=1, size_t expansion=0,
-        bool random=true) NOEXCEPT requires (is_one(columns));
+        bool random=true, const map_options& options={}) NOEXCEPT
+        requires (is_one(columns));
 
     /// Aggregate construction (columns > 1): one file per column, shared guards.
     mmap(const paths& filenames, size_t minimum=1, size_t expansion=0,
-        bool random=true) NOEXCEPT requires (columns > one);
+        bool random=true, const map_options& options={}) NOEXCEPT
+        requires (columns > one);
 
     /// Destruct for debug assertion only.
     virtual ~mmap() NOEXCEPT;
@@ -75,6 +100,9 @@ public:
     /// True if the memory map(s) are loaded.
     bool is_loaded() const NOEXCEPT;
 
+    /// Logical count as of the last writeback initiation or flush.
+    size_t written() const NOEXCEPT;
+
     /// storage interface
     /// -----------------------------------------------------------------------
 
@@ -102,9 +130,17 @@ public:
     /// Clear disk full condition, fails if fault, must be loaded, idempotent.
     code reload() NOEXCEPT override;
 
-    /// Flush memory map(s) to disk, suspend writes for call, must be loaded.
+    /// Flush memory map(s) to disk as of call, must be loaded. Writes may
+    /// proceed (but not remap), so suspend writes for a consistent flush.
     code flush() NOEXCEPT override;
 
+    /// Flush rows appended since last load/flush, skip if none (append-only).
+    code flush_appended() NOEXCEPT override;
+
+    /// Initiate writeback of rows appended since last writeback/flush if at
+    /// least bytes, without waiting for completion (does not suspend writes).
+    code writeback(size_t bytes) NOEXCEPT override;
+
     /// Flush, unmap and truncate to logical, restartable, idempotent.
     code unload() NOEXCEPT override;
 
@@ -114,6 +150,24 @@ public:
     /// Dump current logical map to a new file in path, must not exist.
     code dump(const path& path) const NOEXCEPT override;
 
+    /// Patch a dump of the given generation with pages marked since, or dump
+    /// in full if zero generation, untracked pages, or dump size mismatch.
+    code dump(const path& path, size_t since) const NOEXCEPT override;
+
+    /// Capture the logical map for a deferred dump, as a patch of the prior
+    /// dump at path if dump(path, since) would patch it, otherwise in full.
+    /// A capture over limit bytes is instead dumped in full to staged file.
+    code capture(image& out, const path& path, size_t since,
+        size_t limit=max_size_t, const path& staged={}) const NOEXCEPT override;
+
+    /// Record a direct write of bytes at offset, for incremental dump.
+    /// Pages are tracked only for random access (head) maps.
+    void mark(size_t offset, size_t bytes=one) NOEXCEPT override;
+
+    /// Write generation (reset by load), advance after a set of dumps.
+    size_t generation() const NOEXCEPT override;
+    void advance() NOEXCEPT override;
+
     /// The current count of rows/bytes in map (zero if closed).
     size_t size() const NOEXCEPT override;
 
@@ -135,6 +189,9 @@ public:
     /// Remap-protected r/w access to start/offset (or null), within capacity.
     memory_ptr get_capacity(size_t offset=zero) const NOEXCEPT override;
 
+    /// Exclusively-protected r/w access to start (or null), within logical.
+    memory_ptr get_exclusive() const NOEXCEPT override;
+
     /// Unprotected r/w access to start/offset (or null), within logical.
     memory::iterator get_raw(size_t offset=zero) const NOEXCEPT override;
 
@@ -169,27 +226,44 @@ protected:
     }
 
     size_t to_capacity(size_t required) const NOEXCEPT;
+    bool is_reserved(size_t capacity) const NOEXCEPT;
+    bool grow(size_t capacity) NOEXCEPT;
     void set_first_code(const error::error_t& ec) NOEXCEPT;
     void set_disk_space(size_t required) NOEXCEPT;
 
 private:
     static constexpr auto fail = -1;
-    using access = accessor<std::shared_mutex>;
+    static constexpr size_t page_bytes = 4096;
+    using access = accessor<striped_mutex>;
+    using exclusive = accessor<striped_mutex,
+        std::unique_lock<striped_mutex>>;
     using sequence = std::make_index_sequence<columns>;
 
     // mman dispatch, not thread safe.
     template <size_t... Index>
-    bool flush_all_(std::index_sequence<Index...>) NOEXCEPT;
+    bool flush_all_(size_t to, std::index_sequence<Index...>) NOEXCEPT;
+    template <size_t... Index>
+    bool flush_appended_all_(size_t from, size_t to,
+        std::index_sequence<Index...>) NOEXCEPT;
+    template <size_t... Index>
+    bool writeback_all_(size_t from, size_t to,
+        std::index_sequence<Index...>) NOEXCEPT;
     template <size_t... Index>
     bool map_all_(std::index_sequence<Index...>) NOEXCEPT;
     template <size_t... Index>
     bool unmap_all_(std::index_sequence<Index...>) NOEXCEPT;
     template <size_t... Index>
     bool remap_all_(size_t capacity, std::index_sequence<Index...>) NOEXCEPT;
+    template <size_t... Index>
+    bool extend_all_(size_t capacity, std::index_sequence<Index...>) NOEXCEPT;
 
     // mman wrappers, not thread safe.
     template <size_t Column>
-    bool flush_() NOEXCEPT;
+    bool flush_(size_t to) NOEXCEPT;
+    template <size_t Column>
+    bool flush_appended_(size_t from, size_t to) NOEXCEPT;
+    template <size_t Column>
+    bool writeback_(size_t from, size_t to) NOEXCEPT;
     template <size_t Column>
     bool map_() NOEXCEPT;
     template <size_t Column>
@@ -199,22 +273,44 @@ private:
     template <size_t Column>
     bool remap_(size_t size) NOEXCEPT;
     template <size_t Column>
-    bool resize_(size_t size) NOEXCEPT;
+    bool resize_(size_t size, bool release=true) NOEXCEPT;
     template <size_t Column>
     bool finalize_(size_t size) NOEXCEPT;
+    template <size_t Column>
+    uint8_t* reserve_(size_t size) NOEXCEPT;
+    template <size_t Column>
+    bool extend_(size_t size) NOEXCEPT;
+    bool advise_(uint8_t* start, size_t bytes) NOEXCEPT;
+    static size_t page_size_() NOEXCEPT;
 
     // These are thread safe.
     const paths filenames_;
     const size_t minimum_;
     const size_t expansion_;
     const bool random_;
+    const map_options options_;
     std::atomic<size_t> space_{ zero };
     std::atomic<error::error_t> error_{ error::success };
 
+    // These are thread safe, and reset by load.
+    // flushed_ is the logical row count as of the last load/flush.
+    // written_ is the logical row count as of the last writeback initiation.
+    // stamps_ holds the write generation of each page of a random map.
+    std::atomic<size_t> flushed_{ zero };
+    std::atomic<size_t> written_{ zero };
+    std::atomic<size_t> generation_{ one };
+    std::atomic_bool untracked_{ true };
+    std::vector<std::atomic<size_t>> stamps_{};
+
+    // This is thread safe, a mirror of logical_ for lock-free size().
+    std::atomic<size_t> size_{ zero };
+
     // These are protected by field_mutex_.
     // Fields require field_mutex_ exclusive for write, shared for flush/read.
     // logical_ and capacity_ are row counts (byte cound if width is one).
+    // reserved_ is the byte size of each column's address space reservation.
     std::array<int, columns> opened_;
+    std::array<size_t, columns> reserved_{};
     size_t capacity_{};
     size_t logical_{};
     bool fault_{};
@@ -222,8 +318,10 @@ private:
     mutable std::shared_mutex field_mutex_{};
 
     // These are protected by remap_mutex_.
+    // Accessors are pooled and the mutex is reader-striped, so that get() is
+    // neither a heap allocation nor a contended cache line in steady state.
     std::array<uint8_t*, columns> memory_map_{};
-    mutable std::shared_mutex remap_mutex_{};
+    mutable striped_mutex remap_mutex_{};
 };
 
 using map = mmap<one>;
@@ -0,0 +1,105 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_OBJECT_CACHE_HPP
+#define LIBBITCOIN_DATABASE_MEMORY_OBJECT_CACHE_HPP
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Thread safe, size-bounded and sharded cache of const objects by link.
+/// Each shard evicts in order of insertion, a zero capacity disables cache.
+template <typename Link, typename Object>
+class object_cache
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(object_cache);
+
+    using cptr = std::shared_ptr<const Object>;
+
+    /// Capacity is the maximum number of objects across all shards.
+    object_cache(size_t capacity, size_t shards=16) NOEXCEPT;
+
+    /// True if capacity is non-zero.
+    bool enabled() const NOEXCEPT;
+
+    /// Number of objects cached.
+    size_t size() const NOEXCEPT;
+
+    /// Counts of get() calls (when enabled) that found and did not find.
+    size_t hits() const NOEXCEPT;
+    size_t misses() const NOEXCEPT;
+
+    /// Get cached object, nullptr if not cached.
+    cptr get(const Link& link) const NOEXCEPT;
+
+    /// Cache object, evicting the oldest object of its shard when full.
+    void put(const Link& link, const cptr& object) NOEXCEPT;
+
+    /// Remove object of link if cached.
+    void erase(const Link& link) NOEXCEPT;
+
+    /// Remove all objects (counters are retained).
+    void clear() NOEXCEPT;
+
+private:
+    using key = typename Link::integer;
+    using keys = std::list<key>;
+    struct entry
+    {
+        cptr object{};
+        typename keys::iterator position{};
+    };
+
+    // Order holds exactly the cached keys, each entry holds its position.
+    struct shard
+    {
+        mutable std::shared_mutex mutex{};
+        std::unordered_map<key, entry> map{};
+        keys order{};
+    };
+
+    shard& to_shard(const Link& link) const NOEXCEPT;
+
+    // These are thread safe.
+    const size_t limit_;
+    mutable std::vector<shard> shards_;
+    mutable std::atomic<size_t> hits_{};
+    mutable std::atomic<size_t> misses_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#define TEMPLATE template <typename Link, typename Object>
+#define CLASS object_cache<Link, Object>
+
+#include <bitcoin/database/impl/memory/object_cache.ipp>
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
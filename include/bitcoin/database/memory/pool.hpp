@@ -0,0 +1,157 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_POOL_HPP
+#define LIBBITCOIN_DATABASE_MEMORY_POOL_HPP
+
+#include <array>
+#include <atomic>
+#include <filesystem>
+#include <mutex>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/memory/interfaces/memory.hpp>
+#include <bitcoin/database/memory/mmap.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Storage (substitutable for mmap) that manages its own residency in fixed
+/// chunks of each column, for stores that exceed physical memory. Addressing
+/// remains the file mapping, so memory spans are contiguous across chunks.
+/// Each view pins the chunk of its offset against eviction. A chunk is
+/// prefetched as it becomes resident. A CLOCK sweep evicts unpinned chunks
+/// above the resident budget (map_options::resident). Chunks enter cold and
+/// are promoted by a second reference, so a scan evicts its own chunks first.
+template <size_t... Widths>
+class pool
+  : public mmap<Widths...>
+{
+public:
+    DELETE_COPY_MOVE(pool);
+
+    using base = mmap<Widths...>;
+    using path = std::filesystem::path;
+    using paths = typename base::paths;
+    static constexpr auto columns = base::columns;
+
+    /// Bytes per chunk, a multiple of the page size.
+    static constexpr size_t chunk = system::power2(20u);
+
+    /// Scalar construction (columns == 1).
+    pool(const path& filename, size_t minimum=1, size_t expansion=0,
+        bool random=true, const map_options& options={}) NOEXCEPT
+        requires (is_one(columns));
+
+    /// Aggregate construction (columns > 1).
+    pool(const paths& filenames, size_t minimum=1, size_t expansion=0,
+        bool random=true, const map_options& options={}) NOEXCEPT
+        requires (columns > one);
+
+    /// Frees chunk state.
+    virtual ~pool() NOEXCEPT;
+
+    /// Count of chunks of column tracked as resident.
+    size_t resident(size_t column=zero) const NOEXCEPT;
+
+    /// Count of chunks of column pinned by at least one view.
+    size_t pinned(size_t column=zero) const NOEXCEPT;
+
+    /// Unload and reset residency (all chunks evicted).
+    code unload() NOEXCEPT override;
+
+    /// Pinned remap-protected r/w access to column at offset (or null).
+    memory_ptr get_at(size_t column,
+        size_t offset=zero) const NOEXCEPT override;
+
+private:
+    static constexpr uint8_t evicted = 0;
+    static constexpr uint8_t cold = 1;
+    static constexpr uint8_t hot = 2;
+
+    // 4096 blocks of 4096 frames of 1MiB is 16TiB per column.
+    static constexpr size_t block = system::power2(12u);
+    static constexpr size_t blocks = system::power2(12u);
+
+    struct frame
+    {
+        std::atomic<uint8_t> state{ evicted };
+        std::atomic<uint32_t> pins{};
+    };
+
+    struct directory
+    {
+        std::array<std::atomic<frame*>, blocks> slots{};
+        std::atomic<size_t> resident{};
+        size_t hand{};
+    };
+
+    // Forwards to the remap-protected accessor, unpins chunk on destruct.
+    class view final
+      : public memory
+    {
+    public:
+        DELETE_COPY_MOVE(view);
+
+        view(memory_ptr&& memory, std::atomic<uint32_t>& pins) NOEXCEPT;
+        ~view() NOEXCEPT;
+
+        uint8_t* offset(size_t bytes) const NOEXCEPT override;
+        ptrdiff_t size() const NOEXCEPT override;
+        uint8_t* data() const NOEXCEPT override;
+        operator system::data_slab() const NOEXCEPT override;
+        uint8_t* begin() const NOEXCEPT override;
+        uint8_t* end() const NOEXCEPT override;
+
+    private:
+        const memory_ptr memory_;
+        std::atomic<uint32_t>& pins_;
+    };
+
+    static size_t to_limit(const map_options& options) NOEXCEPT;
+    static void advise(uint8_t* start, size_t bytes, bool evict) NOEXCEPT;
+
+    frame* get_frame(size_t column, size_t index,
+        bool create) const NOEXCEPT;
+    void reference(size_t column, frame& item, uint8_t* origin, size_t index,
+        size_t logical) const NOEXCEPT;
+    void sweep(size_t column, uint8_t* origin, size_t logical) const NOEXCEPT;
+
+    // This is thread safe.
+    const size_t limit_;
+
+    // These are thread safe, except hand (protected by sweep_mutex_).
+    mutable std::array<directory, columns> directories_{};
+    mutable std::mutex sweep_mutex_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#define TEMPLATE template <size_t... Widths>
+#define CLASS pool<Widths...>
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+#include <bitcoin/database/impl/memory/pool.ipp>
+
+BC_POP_WARNING()
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
@@ -0,0 +1,118 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_RECYCLER_HPP
+#define LIBBITCOIN_DATABASE_MEMORY_RECYCLER_HPP
+
+#include <new>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Stateless allocator (Allocator named requirement) for std::allocate_shared.
+/// Single object blocks are recycled through a bounded per-thread free list,
+/// so that a steady state of short-lived shared objects does not use the heap.
+/// A block released on another thread is recycled by the releasing thread.
+template <typename Type>
+class recycler
+{
+public:
+    using value_type = Type;
+
+    /// Maximum number of free blocks retained per thread (per Type).
+    static constexpr size_t limit = 64;
+
+    recycler() NOEXCEPT = default;
+
+    template <typename Other>
+    recycler(const recycler<Other>&) NOEXCEPT
+    {
+    }
+
+    Type* allocate(size_t count) NOEXCEPT
+    {
+        auto& list = free_list();
+        if (is_one(count) && !is_null(list.head))
+        {
+            const auto node = list.head;
+            list.head = node->next;
+            --list.size;
+            return static_cast<Type*>(static_cast<void*>(node));
+        }
+
+        return static_cast<Type*>(::operator new(count * sizeof(Type)));
+    }
+
+    void deallocate(Type* ptr, size_t count) NOEXCEPT
+    {
+        auto& list = free_list();
+        if (is_one(count) && list.size < limit)
+        {
+            const auto node = static_cast<link*>(static_cast<void*>(ptr));
+            node->next = list.head;
+            list.head = node;
+            ++list.size;
+            return;
+        }
+
+        ::operator delete(ptr);
+    }
+
+    template <typename Other>
+    bool operator==(const recycler<Other>&) const NOEXCEPT
+    {
+        return true;
+    }
+
+private:
+    struct link
+    {
+        link* next;
+    };
+
+    static_assert(sizeof(Type) >= sizeof(link));
+    static_assert(alignof(Type) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__);
+
+    struct blocks
+    {
+        ~blocks() NOEXCEPT
+        {
+            while (!is_null(head))
+            {
+                const auto next = head->next;
+                ::operator delete(head);
+                head = next;
+            }
+        }
+
+        link* head{};
+        size_t size{};
+    };
+
+    static blocks& free_list() NOEXCEPT
+    {
+        thread_local blocks list{};
+        return list;
+    }
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
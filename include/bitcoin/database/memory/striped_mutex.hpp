@@ -0,0 +1,75 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_STRIPED_MUTEX_HPP
+#define LIBBITCOIN_DATABASE_MEMORY_STRIPED_MUTEX_HPP
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Shared mutex (SharedMutex named requirement) optimized for readers.
+/// Shared lock is one atomic increment of a counter on a cache line assigned
+/// to the calling thread, so concurrent readers do not share a cache line.
+/// Exclusive lock flags readers to back off and waits (yielding) for the sum
+/// of all counters to drain, so it is expensive and intended for remap only.
+/// A shared lock may be released from any thread.
+class BCD_API striped_mutex
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(striped_mutex);
+
+    /// Number of reader counters (threads are assigned round robin).
+    static constexpr size_t stripes = 64;
+
+    striped_mutex() NOEXCEPT;
+
+    /// Exclusive.
+    void lock() NOEXCEPT;
+    bool try_lock() NOEXCEPT;
+    void unlock() NOEXCEPT;
+
+    /// Shared.
+    void lock_shared() NOEXCEPT;
+    bool try_lock_shared() NOEXCEPT;
+    void unlock_shared() NOEXCEPT;
+
+private:
+    // Cache line size is not portably constexpr (hardware_destructive_...).
+    struct alignas(64) stripe
+    {
+        std::atomic<int64_t> count{};
+    };
+
+    static size_t to_stripe() NOEXCEPT;
+    bool is_idle() const NOEXCEPT;
+
+    // These are thread safe.
+    std::array<stripe, stripes> stripes_{};
+    std::atomic_bool exclusive_{};
+    std::mutex writer_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,84 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_STRONG_CACHE_HPP
+#define LIBBITCOIN_DATABASE_MEMORY_STRONG_CACHE_HPP
+
+#include <shared_mutex>
+#include <vector>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Thread safe in-memory index of tx link to the height and median time past
+/// of the block to which the tx is strong. Arrays are dense by link (4 bytes
+/// per tx and 8 per block). Positive only, a miss must defer to the store.
+template <typename Tx, typename Header>
+class strong_cache
+{
+public:
+    DELETE_COPY_MOVE_DESTRUCT(strong_cache);
+
+    strong_cache(bool enabled) NOEXCEPT;
+
+    /// True if constructed enabled.
+    bool enabled() const NOEXCEPT;
+
+    /// Preallocate for counts of tx and header links.
+    void reserve(size_t txs, size_t headers) NOEXCEPT;
+
+    /// Set context of block, must precede set of its txs.
+    void set_block(const Header& link, uint32_t height,
+        uint32_t mtp) NOEXCEPT;
+
+    /// Set (or unset) count of contiguous txs as strong to block.
+    void set(const Tx& first, size_t count, const Header& block,
+        bool positive) NOEXCEPT;
+
+    /// Context of block to which tx is strong, false if not cached.
+    bool get(uint32_t& height, uint32_t& mtp, const Tx& link) const NOEXCEPT;
+
+    /// Remove all entries (retains allocation).
+    void clear() NOEXCEPT;
+
+private:
+    template <typename Integer>
+    void expand(std::vector<Integer>& table, size_t count) NOEXCEPT;
+
+    // These are thread safe.
+    const bool enabled_;
+    mutable std::shared_mutex mutex_{};
+
+    // These are protected by mutex_ (resize) and atomic_ref (elements).
+    mutable std::vector<uint64_t> blocks_{};
+    mutable std::vector<uint32_t> txs_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#define TEMPLATE template <typename Tx, typename Header>
+#define CLASS strong_cache<Tx, Header>
+
+#include <bitcoin/database/impl/memory/strong_cache.ipp>
+
+#undef CLASS
+#undef TEMPLATE
+
+#endif
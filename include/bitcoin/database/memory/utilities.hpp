@@ -20,6 +20,10 @@
 #define LIBBITCOIN_DATABASE_MEMORY_UTILITIES_HPP
 
 #include <atomic>
+#include <tuple>
+#if defined(HAVE_MSC)
+    #include <intrin.h>
+#endif
 #include <bitcoin/database/define.hpp>
 
 namespace libbitcoin {
@@ -31,6 +35,18 @@ BCD_API size_t page_size() NOEXCEPT;
 /// The bytes of physical memory, zero if failed.
 BCD_API uint64_t system_memory() NOEXCEPT;
 
+/// Hint that the cache line at address will be read soon (never faults).
+INLINE void prefetch(const void* address) NOEXCEPT
+{
+#if defined(HAVE_MSC) && (defined(_M_X64) || defined(_M_IX86))
+    _mm_prefetch(static_cast<const char*>(address), _MM_HINT_T0);
+#elif !defined(HAVE_MSC)
+    __builtin_prefetch(address);
+#else
+    std::ignore = address;
+#endif
+}
+
 /// C++26: std::atomic<size_t>::fetch_max
 template <typename Integral, if_integral_integer<Integral> = true>
 Integral fetch_max(std::atomic<Integral>& atomic, Integral value) NOEXCEPT
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_MEMORY_WIRE_IOV_HPP
+#define LIBBITCOIN_DATABASE_MEMORY_WIRE_IOV_HPP
+
+#include <iterator>
+#include <utility>
+#include <vector>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/memory/interfaces/memory.hpp>
+#include <bitcoin/database/memory/streamers.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Scatter-gather wire encoding, as (pointer, length) segments that map
+/// directly to iovec (writev) entries. Segments reference pinned memory maps
+/// or a side buffer of synthesized fragments (fields, counts, prefixes).
+/// Caution: pinned maps are guarded against remap until clear/destruct.
+class BCD_API wire_iov
+{
+public:
+    using segment = std::pair<const uint8_t*, size_t>;
+    using segments = std::vector<segment>;
+
+    /// Retain memory, guarding its map against remap.
+    void pin(const memory_ptr& memory) NOEXCEPT;
+
+    /// Append segment of pinned memory at position, false if out of bounds.
+    bool append(const memory_ptr& memory, size_t position,
+        size_t size) NOEXCEPT;
+
+    /// Append to side buffer as written by write(bytewriter&), up to maximum
+    /// bytes. Side segments are not addressable until finalized.
+    template <typename Writer>
+    inline bool synthesize(size_t maximum, Writer&& write) NOEXCEPT
+    {
+        using namespace system;
+        const auto start = side_.size();
+        side_.resize(start + maximum);
+
+        iostream stream{ std::next(side_.data(), start),
+            possible_narrow_and_sign_cast<ptrdiff_t>(maximum) };
+        writer sink{ stream };
+        const auto valid = write(sink) && sink;
+        const auto size = valid ? sink.get_write_position() : zero;
+        side_.resize(start + size);
+        add(nullptr, size);
+        return valid;
+    }
+
+    /// Resolve side buffer segments, required once appends are complete.
+    void finalize() NOEXCEPT;
+
+    /// Release pins and empty all segments.
+    void clear() NOEXCEPT;
+
+    /// Segments (after finalize), empty if not found or failed.
+    const segments& get_segments() const NOEXCEPT;
+
+    /// Total bytes of all segments.
+    size_t size() const NOEXCEPT;
+
+    /// Copy of the concatenated segments (after finalize).
+    data_chunk to_data() const NOEXCEPT;
+
+private:
+    void add(const uint8_t* data, size_t size) NOEXCEPT;
+
+    std::vector<memory_ptr> pins_{};
+    data_chunk side_{};
+    segments segments_{};
+    size_t size_{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -68,6 +68,10 @@ public:
     /// Assign link value to bucket index.
     bool push(const Link& link, const Link& index) NOEXCEPT;
 
+    /// Assign function(prior) to bucket index, atomically (terminal if unset).
+    template <typename Function>
+    bool merge(const Link& index, const Function& function) NOEXCEPT;
+
 private:
     using link = Link::integer;
     using body = manager<Link, system::data_array<zero>, Link::size>;
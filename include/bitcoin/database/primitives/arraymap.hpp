@@ -75,6 +75,9 @@ public:
     /// Count of body records (or bytes if slab).
     Link count() const NOEXCEPT;
 
+    /// Reduce count as specified.
+    bool truncate(const Link& count) NOEXCEPT;
+
     /// Increase count as necessary to specified.
     bool expand(const Link& count) NOEXCEPT;
 
@@ -112,6 +115,14 @@ public:
     template <typename Element, if_equal<Element::size, RowSize> = true>
     bool put(size_t key, const Element& element) NOEXCEPT;
 
+    /// Assign value directly to key, without body allocation (value array).
+    /// Expands HEADER as necessary, word-atomic when aligned.
+    bool set(size_t key, const Link& value) NOEXCEPT;
+
+    /// Assign function(prior) directly to key, atomically (terminal if unset).
+    template <typename Function>
+    bool merge(size_t key, const Function& function) NOEXCEPT;
+
 private:
     static constexpr auto is_slab = (RowSize == max_size_t);
     using head = database::arrayhead<Link, Align>;
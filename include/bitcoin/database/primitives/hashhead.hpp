@@ -22,8 +22,10 @@
 #include <algorithm>
 #include <atomic>
 #include <shared_mutex>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/memory/memory.hpp>
+#include <bitcoin/database/memory/utilities.hpp>
 #include <bitcoin/database/primitives/keys.hpp>
 #include <bitcoin/database/primitives/linkage.hpp>
 
@@ -64,10 +66,42 @@ public:
     /// Unsafe if verify false.
     inline Link top(const Key& key) const NOEXCEPT;
     inline Link top(const Link& index) const NOEXCEPT;
+    inline Link top(const Link& index, const Key& key) const NOEXCEPT;
+    inline void prefetch(const Link& index) const NOEXCEPT;
     inline bool push(const Link& current, bytes& next, const Key& key) NOEXCEPT;
     inline bool push(bool& collision, const Link& current, bytes& next,
         const Key& key) NOEXCEPT;
 
+    /// Rehash (not thread safe, requires exclusive access to the body).
+    /// While rehashing, keys of migrated buckets resolve to shadow buckets,
+    /// which are indexed from buckets() (i.e. following the head buckets).
+
+    /// Adopt the bucket count implied by the head file size.
+    bool adopt() NOEXCEPT;
+
+    /// Create shadow head of buckets in empty file, and begin rehash.
+    bool begin_rehash(storage& shadow, size_t buckets) NOEXCEPT;
+
+    /// True if rehash is begun and not ended.
+    inline bool is_rehashing() const NOEXCEPT;
+
+    /// Count of head buckets migrated to shadow.
+    inline size_t migrated() const NOEXCEPT;
+
+    /// Count of scannable buckets, including shadow buckets while rehashing.
+    inline size_t span() const NOEXCEPT;
+
+    /// Migrate next head bucket, obtaining its top for conflict list reinsert
+    /// (by push) into shadow buckets, false if all buckets are migrated.
+    bool migrate(Link& top) NOEXCEPT;
+
+    /// End rehash after head file has been replaced by shadow file.
+    bool end_rehash() NOEXCEPT;
+
+    /// Abort rehash, obtaining tops of shadow buckets for conflict list
+    /// reinsert (by push) into vacated head buckets, releasing the shadow.
+    bool abort_rehash(std::vector<Link>& tops) NOEXCEPT;
+
 protected:
 
     // filtering
@@ -95,6 +129,7 @@ protected:
     INLINE static constexpr cell next_cell(bool& collision, cell previous,
         link current, uint64_t entropy) NOEXCEPT;
 
+    inline storage& to_file(link& index) const NOEXCEPT;
     inline cell get_cell(const Link& index) const NOEXCEPT;
     inline bool set_cell(bool& collision, bytes& next, const Link& current,
         const Key& key) NOEXCEPT;
@@ -136,8 +171,13 @@ private:
 
     // These are thread safe.
     storage& file_;
-    const Link buckets_;
+    std::atomic<link> buckets_;
     mutable std::shared_mutex mutex_{};
+
+    // These are protected by exclusive access to the body (see rehash).
+    storage* shadow_{};
+    link shadow_buckets_{};
+    link migrated_{};
 };
 
 } // namespace database
@@ -19,7 +19,11 @@
 #ifndef LIBBITCOIN_DATABASE_PRIMITIVES_HASHMAP_HPP
 #define LIBBITCOIN_DATABASE_PRIMITIVES_HASHMAP_HPP
 
+#include <algorithm>
 #include <atomic>
+#include <functional>
+#include <numeric>
+#include <span>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/memory/memory.hpp>
 #include <bitcoin/database/primitives/hashhead.hpp>
@@ -27,6 +31,7 @@
 #include <bitcoin/database/primitives/keys.hpp>
 #include <bitcoin/database/primitives/linkage.hpp>
 #include <bitcoin/database/primitives/manager.hpp>
+#include <bitcoin/database/types/hash_statistics.hpp>
 
 namespace libbitcoin {
 namespace database {
@@ -66,6 +71,9 @@ public:
     /// Hash table bucket count.
     size_t buckets() const NOEXCEPT;
 
+    /// Count of buckets to scan by top(), exceeds buckets() while rehashing.
+    size_t span() const NOEXCEPT;
+
     /// Head file bytes.
     size_t head_size() const NOEXCEPT;
 
@@ -90,6 +98,11 @@ public:
     /// Count of puts not resulting in table body search to detect duplication.
     size_t negative_search_count() const NOEXCEPT;
 
+    /// Scan head (in parallel) for conflict list statistics, with lookups of
+    /// keys from every bucket of a sampling stride (buckets/samples). Memory
+    /// is held for each range of buckets, so writes are not blocked by scan.
+    bool get_statistics(hash_statistics& out, size_t samples) const NOEXCEPT;
+
     /// Errors.
     /// -----------------------------------------------------------------------
 
@@ -102,10 +115,35 @@ public:
     /// Resume from disk full condition.
     code reload() NOEXCEPT;
 
+    /// Rehash, writers must be suspended by caller for each call.
+    /// -----------------------------------------------------------------------
+    /// Each call holds exclusive access to the body, blocking readers (and
+    /// iterator construction) only for its duration. Readers always obtain
+    /// body access before reading the head.
+
+    /// Adopt the bucket count implied by the head file size (not thread safe).
+    bool adopt() NOEXCEPT;
+
+    /// Begin rehash into empty shadow head file of the specified buckets.
+    bool begin_rehash(storage& shadow, size_t buckets) NOEXCEPT;
+
+    /// Migrate up to the specified number of head buckets into the shadow,
+    /// reinserting their conflict lists, and set complete when none remain.
+    bool rehash(bool& complete, size_t buckets) NOEXCEPT;
+
+    /// Carry body count to shadow, replace the head file with the shadow file
+    /// (by invoking replace), and adopt its bucket count.
+    bool end_rehash(const std::function<bool()>& replace) NOEXCEPT;
+
+    /// Abort rehash, reinserting conflict lists of the shadow into the head
+    /// (restoring the prior head), after which the shadow is unused.
+    bool abort_rehash() NOEXCEPT;
+
     /// Query interface, iterator is not thread safe.
     /// -----------------------------------------------------------------------
 
     /// Return the link at the top of the conflict list (for table scanning).
+    /// While rehashing, lists of migrated buckets are at [buckets(), span()).
     inline Link top(const Link& list) const NOEXCEPT;
 
     /// True if an instance of object with key exists.
@@ -116,6 +154,16 @@ public:
     inline Link first(const memory_ptr& ptr, const Key& key) const NOEXCEPT;
     inline Link first(const Key& key) const NOEXCEPT;
 
+    /// Batched exists/first, links/found are positionally matched to keys.
+    /// Keys are hashed and head cells prefetched before any is read, and then
+    /// conflict lists are walked in interleaved rounds (one row per key per
+    /// round), so that a miss for each key may be in flight concurrently.
+    /// False if output size does not match keys size or memory is unloaded.
+    bool exists_many(std::span<const Key> keys,
+        std::span<bool> found) const NOEXCEPT;
+    bool first_many(std::span<const Key> keys,
+        std::span<Link> links) const NOEXCEPT;
+
     /// Iterator holds shared lock on storage remap.
     inline iterator it(Key&& key) const NOEXCEPT;
     inline iterator it(const Key& key) const NOEXCEPT;
@@ -204,6 +252,11 @@ public:
     bool commit(const memory_ptr& ptr, const Link& link,
         const Key& key) NOEXCEPT;
 
+    /// Commit previously set element at link to key, using get_memory() ptr,
+    /// and set duplicate if the key was already committed at another link.
+    bool commit(bool& duplicate, const memory_ptr& ptr, const Link& link,
+        const Key& key) NOEXCEPT;
+
 protected:
     /// memory_ptr parameter must be from start (i.e. from get_memory()).
     /// Get first element matching key, from top link and whole table memory.
@@ -231,6 +284,13 @@ private:
     static constexpr auto index_size = Link::size + key_size;
     using head = database::hashhead<Link, Key, CellSize>;
     using body = database::manager<Link, Key, RowSize>;
+    using key_bytes = std::array<uint8_t, key_size>;
+
+    // Statistics.
+    static size_t probes(const memory_ptr& ptr, Link link,
+        const Key& key) NOEXCEPT;
+    void sample(hash_statistics& out, const memory_ptr& ptr,
+        const key_bytes& bytes) const NOEXCEPT;
 
     // Thread safe (index/top/push).
     // Not thread safe (create/open/close/backup/restore).
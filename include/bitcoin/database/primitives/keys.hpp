@@ -48,6 +48,10 @@ INLINE uint64_t thumb(const Key& value) NOEXCEPT;
 template <class Key>
 INLINE void write(writer& sink, const Key& key) NOEXCEPT;
 
+/// Read size() bytes of key from bytes (inverse of write).
+template <class Key, class Array>
+INLINE Key read(const Array& bytes) NOEXCEPT;
+
 /// Compare size() bytes of key to bytes.
 template <class Array, class Key>
 INLINE bool compare(const Array& bytes, const Key& key) NOEXCEPT;
@@ -55,6 +55,10 @@ public:
     template <size_t Columns = sizeof...(Sizes), if_equal<Columns, one> = true>
     inline memory_ptr get_capacity(const Link& link) const NOEXCEPT;
 
+    /// Return exclusive memory object for full map (blocks all other access).
+    template <size_t Columns = sizeof...(Sizes), if_equal<Columns, one> = true>
+    inline memory_ptr get_exclusive() const NOEXCEPT;
+
     /// Manage shared multi-backed byte storage device (caller owns storage).
     managers(storage& body) NOEXCEPT;
 
@@ -85,6 +85,9 @@ public:
     /// any subsequent element is reserved or put, or will overwrite.
     bool reserve(const Link& size) NOEXCEPT;
 
+    /// Allocate count or slab size at returned link (follow with put).
+    inline Link allocate(const Link& size) NOEXCEPT;
+
     /// Return ptr for batch processing, holds shared lock on storage remap.
     memory_ptr get_memory() const NOEXCEPT;
 
@@ -122,6 +125,11 @@ public:
     template <typename Element, if_equal<Element::size, Size> = true>
     bool put(const memory_ptr& ptr, const Element& element) NOEXCEPT;
 
+    /// Put previously allocated element at link, using get_memory() ptr.
+    template <typename Element, if_equal<Element::size, Size> = true>
+    static bool put(const memory_ptr& ptr, const Link& link,
+        const Element& element) NOEXCEPT;
+
     /// Put element and return link.
     template <typename Element, if_equal<Element::size, Size> = true>
     bool put_link(Link& link, const Element& element) NOEXCEPT;
@@ -98,6 +98,12 @@ public:
     /// Count of puts not resulting in table body search to detect duplication.
     size_t negative_search_count() const NOEXCEPT;
 
+    /// Counts of decoded object cache reads that were and were not cached.
+    size_t header_cache_hits() const NOEXCEPT;
+    size_t header_cache_misses() const NOEXCEPT;
+    size_t tx_cache_hits() const NOEXCEPT;
+    size_t tx_cache_misses() const NOEXCEPT;
+
     /// Store extent.
     /// -----------------------------------------------------------------------
 
@@ -118,6 +124,7 @@ public:
     size_t point_head_size() const NOEXCEPT;
     size_t ins_head_size() const NOEXCEPT;
     size_t outs_head_size() const NOEXCEPT;
+    size_t spend_head_size() const NOEXCEPT;
     size_t txs_head_size() const NOEXCEPT;
     size_t tx_head_size() const NOEXCEPT;
 
@@ -132,8 +139,13 @@ public:
     size_t prevout_head_size() const NOEXCEPT;
     size_t validated_bk_head_size() const NOEXCEPT;
     size_t validated_tx_head_size() const NOEXCEPT;
+    size_t fee_tx_head_size() const NOEXCEPT;
     size_t filter_bk_head_size() const NOEXCEPT;
     size_t filter_tx_head_size() const NOEXCEPT;
+    size_t fee_bk_head_size() const NOEXCEPT;
+    size_t summary_head_size() const NOEXCEPT;
+    size_t touched_head_size() const NOEXCEPT;
+    size_t activity_head_size() const NOEXCEPT;
     size_t address_head_size() const NOEXCEPT;
 
     /// Table body logical byte sizes.
@@ -143,6 +155,7 @@ public:
     size_t point_body_size() const NOEXCEPT;
     size_t ins_body_size() const NOEXCEPT;
     size_t outs_body_size() const NOEXCEPT;
+    size_t spend_body_size() const NOEXCEPT;
     size_t txs_body_size() const NOEXCEPT;
     size_t tx_body_size() const NOEXCEPT;
 
@@ -157,8 +170,13 @@ public:
     size_t prevout_body_size() const NOEXCEPT;
     size_t validated_bk_body_size() const NOEXCEPT;
     size_t validated_tx_body_size() const NOEXCEPT;
+    size_t fee_tx_body_size() const NOEXCEPT;
     size_t filter_bk_body_size() const NOEXCEPT;
     size_t filter_tx_body_size() const NOEXCEPT;
+    size_t fee_bk_body_size() const NOEXCEPT;
+    size_t summary_body_size() const NOEXCEPT;
+    size_t touched_body_size() const NOEXCEPT;
+    size_t activity_body_size() const NOEXCEPT;
     size_t address_body_size() const NOEXCEPT;
 
     /// Table (head + body) logical byte sizes.
@@ -168,6 +186,7 @@ public:
     size_t point_size() const NOEXCEPT;
     size_t ins_size() const NOEXCEPT;
     size_t outs_size() const NOEXCEPT;
+    size_t spend_size() const NOEXCEPT;
     size_t txs_size() const NOEXCEPT;
     size_t tx_size() const NOEXCEPT;
 
@@ -182,13 +201,19 @@ public:
     size_t prevout_size() const NOEXCEPT;
     size_t validated_bk_size() const NOEXCEPT;
     size_t validated_tx_size() const NOEXCEPT;
+    size_t fee_tx_size() const NOEXCEPT;
     size_t filter_bk_size() const NOEXCEPT;
     size_t filter_tx_size() const NOEXCEPT;
+    size_t fee_bk_size() const NOEXCEPT;
+    size_t summary_size() const NOEXCEPT;
+    size_t touched_size() const NOEXCEPT;
+    size_t activity_size() const NOEXCEPT;
     size_t address_size() const NOEXCEPT;
 
     /// Buckets (hashmap + arraymap).
     size_t header_buckets() const NOEXCEPT;
     size_t point_buckets() const NOEXCEPT;
+    size_t spend_buckets() const NOEXCEPT;
     size_t txs_buckets() const NOEXCEPT;
     size_t tx_buckets() const NOEXCEPT;
 
@@ -197,8 +222,13 @@ public:
     size_t prevout_buckets() const NOEXCEPT;
     size_t validated_bk_buckets() const NOEXCEPT;
     size_t validated_tx_buckets() const NOEXCEPT;
+    size_t fee_tx_buckets() const NOEXCEPT;
     size_t filter_bk_buckets() const NOEXCEPT;
     size_t filter_tx_buckets() const NOEXCEPT;
+    size_t fee_bk_buckets() const NOEXCEPT;
+    size_t summary_buckets() const NOEXCEPT;
+    size_t touched_buckets() const NOEXCEPT;
+    size_t activity_buckets() const NOEXCEPT;
     size_t address_buckets() const NOEXCEPT;
 
     /// Records.
@@ -210,7 +240,6 @@ public:
 
     size_t candidate_records() const NOEXCEPT;
     size_t confirmed_records() const NOEXCEPT;
-    size_t strong_tx_records() const NOEXCEPT;
     size_t ecdsa_records() const NOEXCEPT;
     size_t schnorr_records() const NOEXCEPT;
     size_t silent_records() const NOEXCEPT;
@@ -218,6 +247,8 @@ public:
     size_t prevalid_records() const NOEXCEPT;
     size_t filter_bk_records() const NOEXCEPT;
     size_t address_records() const NOEXCEPT;
+    size_t summary_records() const NOEXCEPT;
+    size_t activity_records() const NOEXCEPT;
 
     /// Counters (archive slabs - txs/puts/filter_tx can be derived).
     size_t input_count(const tx_link& link) const NOEXCEPT;
@@ -228,10 +259,21 @@ public:
     counts put_counts(const tx_links& txs) const NOEXCEPT;
 
     /// Optional/configured table state.
+    bool spend_enabled() const NOEXCEPT;
+    bool fee_enabled() const NOEXCEPT;
     bool address_enabled() const NOEXCEPT;
     bool filter_enabled() const NOEXCEPT;
+    bool histogram_enabled() const NOEXCEPT;
+    bool summary_enabled() const NOEXCEPT;
+    bool touched_enabled() const NOEXCEPT;
+    bool activity_enabled() const NOEXCEPT;
     size_t interval_span() const NOEXCEPT;
 
+    /// Hash table occupancy/search statistics, with lookups sampled from up
+    /// to samples buckets (false if not a hash table or scan failure).
+    bool get_statistics(hash_statistics& out, table_t table,
+        size_t samples) const NOEXCEPT;
+
     /// Initialization (natural-keyed).
     /// -----------------------------------------------------------------------
     /// Not reliable during organization.
@@ -328,10 +370,18 @@ public:
     constexpr size_t to_validated_bk(const header_link& link) const NOEXCEPT;
     constexpr size_t to_filter_bk(const header_link& link) const NOEXCEPT;
     constexpr size_t to_filter_tx(const header_link& link) const NOEXCEPT;
+    constexpr size_t to_fee_bk(const header_link& link) const NOEXCEPT;
+    constexpr size_t to_touched(const header_link& link) const NOEXCEPT;
     constexpr size_t to_prevout(const header_link& link) const NOEXCEPT;
     constexpr size_t to_txs(const header_link& link) const NOEXCEPT;
 
-    /// hashmap enumeration
+    /// tx to arraymap tables (guard domain transitions)
+    constexpr size_t to_fee_tx(const tx_link& link) const NOEXCEPT;
+
+    /// hashmap enumeration (buckets [0, span), which includes rehash shadow)
+    size_t header_span() const NOEXCEPT;
+    size_t point_span() const NOEXCEPT;
+    size_t tx_span() const NOEXCEPT;
     header_link top_header(size_t bucket) const NOEXCEPT;
     point_link top_point(size_t bucket) const NOEXCEPT;
     tx_link top_tx(size_t bucket) const NOEXCEPT;
@@ -421,6 +471,12 @@ public:
     data_chunk get_wire_tx(const tx_link& link, bool witness) const NOEXCEPT;
     data_chunk get_wire_block(const header_link& link, bool witness) const NOEXCEPT;
 
+    /// Scatter-gather (zero copy) wire encodings, empty if not found.
+    /// Caution: input and output bodies cannot remap while result is held.
+    wire_iov get_wire_tx_iov(const tx_link& link, bool witness) const NOEXCEPT;
+    wire_iov get_wire_block_iov(const header_link& link,
+        bool witness) const NOEXCEPT;
+
     /// Objects.
     /// -----------------------------------------------------------------------
 
@@ -475,6 +531,23 @@ public:
     bool get_branch_fees(const stopper& cancel, fee_rate_sets& out, size_t start,
         size_t count) const NOEXCEPT;
 
+    /// Compute and store tx fee rates by block or confirmed range (backfill).
+    /// Connection persists fee rates, which are otherwise computed upon read.
+    bool set_block_fees(const header_link& link) NOEXCEPT;
+    bool set_branch_fees(const stopper& cancel, size_t start,
+        size_t count) NOEXCEPT;
+
+    /// Fee rate histograms by block or confirmed range (no tx reads).
+    bool get_fee_histogram(fee_histogram& out,
+        const header_link& link) const NOEXCEPT;
+    bool get_fee_histograms(fee_histograms& out, size_t start,
+        size_t count) const NOEXCEPT;
+
+    /// Compute and store fee rate histograms by block or confirmed range.
+    bool set_fee_histogram(const header_link& link) NOEXCEPT;
+    bool set_fee_histograms(const stopper& cancel, size_t start,
+        size_t count) NOEXCEPT;
+
     /// Merkle.
     /// -----------------------------------------------------------------------
 
@@ -550,6 +623,9 @@ public:
         const header& header, const header_link& link,
         size_t height) const NOEXCEPT;
 
+    /// Rebuild fields cache from candidate index (concurrent), not writer safe.
+    bool initialize_fields_cache() NOEXCEPT;
+
     /// Validation.
     /// -----------------------------------------------------------------------
 
@@ -652,6 +728,15 @@ public:
 
     bool set_strong(const header_link& link) NOEXCEPT;
     bool set_unstrong(const header_link& link) NOEXCEPT;
+
+    /// Rebuild strong index from confirmed index (concurrent), not writer safe.
+    bool initialize_strong() NOEXCEPT;
+
+    /// Rebuild strong index if opened from the prior layout (see open).
+    bool migrate_strong() NOEXCEPT;
+
+    /// Rebuild strong cache from confirmed index (concurrent), not writer safe.
+    bool initialize_strong_cache() NOEXCEPT;
     bool set_prevouts(const header_link& link, const block& block) NOEXCEPT;
     bool get_branch(header_states& branch, const hash_digest& hash) const NOEXCEPT;
     bool get_work(uint256_t& work, const header_states& states) const NOEXCEPT;
@@ -720,6 +805,11 @@ public:
         histories& out, const hash_digest& key, size_t limit=max_size_t,
         bool turbo=false) const NOEXCEPT;
 
+    /// Batch of get_history, grouped by key (txs shared by keys read once).
+    code get_history_many(const stopper& cancel, height_link& cursor,
+        history_sets& out, const hashes& keys, size_t limit=max_size_t,
+        bool turbo=false) const NOEXCEPT;
+
     /// Electrum queries (unspents, deduped, electrum sort).
     code get_unconfirmed_unspent(const stopper& cancel, unspents& out,
         const hash_digest& key, bool turbo=false) const NOEXCEPT;
@@ -728,6 +818,10 @@ public:
     code get_unspent(const stopper& cancel, unspents& out,
         const hash_digest& key, bool turbo=false) const NOEXCEPT;
 
+    /// Batch of get_unspent, grouped by key (txs shared by keys read once).
+    code get_unspent_many(const stopper& cancel, unspent_sets& out,
+        const hashes& keys, bool turbo=false) const NOEXCEPT;
+
     /// Balance queries (universal, unconfirmed conflict resolution arbitrary).
     code get_unconfirmed_balance(const stopper& cancel, uint64_t& out,
         const hash_digest& key, bool turbo=false) const NOEXCEPT;
@@ -737,6 +831,19 @@ public:
         uint64_t& unconfirmed, const hash_digest& key,
         bool turbo=false) const NOEXCEPT;
 
+    /// Summary query (optional, confirmed, constant time).
+    code get_address_summary(address_summary& out,
+        const hash_digest& key) const NOEXCEPT;
+
+    /// Electrum status (optional, confirmed from summary, null if no history).
+    code get_address_status(const stopper& cancel, hash_digest& out,
+        const hash_digest& key, bool turbo=false) const NOEXCEPT;
+
+    /// Touched addresses of block (sorted, deduplicated, stored if enabled).
+    bool is_touched(const header_link& link) const NOEXCEPT;
+    bool get_touched(hashes& out, const header_link& link) const NOEXCEPT;
+    bool set_touched(const header_link& link) NOEXCEPT;
+
     /// History queries.
     history get_tx_history(const tx_link& link, size_t start=zero,
         size_t end=max_size_t) const NOEXCEPT;
@@ -796,12 +903,37 @@ protected:
     uint32_t to_output_index(const tx_link& parent_fk,
         const output_link& output_fk) const NOEXCEPT;
 
+    /// Spend index (false if not resolved by the index).
+    bool get_spender(point_link& out, const output_link& link) const NOEXCEPT;
+    bool get_spender(point_link& out, const tx_link& link,
+        uint32_t output_index) const NOEXCEPT;
+    bool get_spend(point_link& out, const outs_link& position) const NOEXCEPT;
+    bool set_spends(const tx_link& link) NOEXCEPT;
+
+    /// Wire (segments of the pinned input and output maps).
+    /// -----------------------------------------------------------------------
+
+    bool get_wire_output(wire_iov& sink, const memory_ptr& outputs,
+        const output_link& link) const NOEXCEPT;
+    bool get_wire_tx(wire_iov& sink, const memory_ptr& inputs,
+        const memory_ptr& outputs, const tx_link& link,
+        bool witness) const NOEXCEPT;
+    bool get_wire_block(wire_iov& sink, const memory_ptr& inputs,
+        const memory_ptr& outputs, const header_link& link,
+        bool witness) const NOEXCEPT;
+
     /// Objects.
     /// -----------------------------------------------------------------------
 
     bool get_outputs_total_value(uint64_t& out,
         const output_links& links) const NOEXCEPT;
 
+    /// Remove decoded header and transactions of block from object caches.
+    void uncache(const header_link& link) const NOEXCEPT;
+
+    /// Copy of cached transaction with unpopulated (unshared) inputs.
+    transaction::cptr uncached(const transaction& tx) const NOEXCEPT;
+
     /// Validate.
     /// -----------------------------------------------------------------------
     inline code to_block_code(linkage<schema::code>::integer value) const NOEXCEPT;
@@ -820,6 +952,9 @@ protected:
     bool set_tx_state(const tx_link& link, const context& ctx,
         uint64_t fee, size_t sigops, tx_state state) NOEXCEPT;
 
+    /// Fee rate is invariant for a tx, so persisted once (connect/backfill).
+    bool set_tx_fees(const tx_link& link, const fee_rate& rate) NOEXCEPT;
+
     /// Confirm.
     /// -----------------------------------------------------------------------
     bool is_confirmed_unspent(const output_link& link) const NOEXCEPT;
@@ -849,6 +984,9 @@ protected:
     bool get_doubles(tx_links& out, const block& block) const NOEXCEPT;
     bool get_doubles(tx_links& out, const point& point) const NOEXCEPT;
 
+    /// Bypasses the duplicate table search (point known duplicated).
+    bool get_doubles_(tx_links& out, const point& point) const NOEXCEPT;
+
     /// Context.
     /// -----------------------------------------------------------------------
 
@@ -884,10 +1022,17 @@ protected:
         const system::settings& settings, const header& header,
         const header_link& link, size_t height) const NOEXCEPT;
 
+    /// Cache fields of candidate at height (if enabled).
+    void cache_fields(const header_link& link, size_t height) NOEXCEPT;
+
     /// Bypasses and only asserts coinbase guard (internal use).
     bool populate_with_metadata_(const transaction& tx,
         bool chain) const NOEXCEPT;
 
+    /// Populate input from previously-resolved prevout tx (internal use).
+    bool populate_with_metadata(const input& input, const tx_link& tx,
+        bool chain) const NOEXCEPT;
+
     /// merkle
     /// -----------------------------------------------------------------------
 
@@ -915,6 +1060,10 @@ protected:
     code set_code(const tx_link& tx_fk, const transaction_view& tx,
         bool bypass) NOEXCEPT;
 
+    /// tx_fks must be allocated for all txs (group commit, see set_code(tx)).
+    code set_code(const tx_link& tx_fks, const transactions& txs,
+        bool bypass) NOEXCEPT;
+
     /// History.
     /// -----------------------------------------------------------------------
 
@@ -926,6 +1075,50 @@ protected:
         const tx_link& link) const NOEXCEPT;
     code get_address_txs(const stopper& cancel, tx_links& out,
         const hash_digest& key, size_t limit) const NOEXCEPT;
+    code get_activity_txs(const stopper& cancel, tx_links& out,
+        const hash_digest& key, size_t start, size_t limit) const NOEXCEPT;
+
+    /// Summary.
+    /// -----------------------------------------------------------------------
+
+    /// Address changes of a confirmed block, sorted by address.
+    struct summary_change
+    {
+        hash_digest key{};
+        uint64_t received{};
+        uint64_t sent{};
+        uint32_t funded{};
+        uint32_t spent{};
+        hashes txs{};
+        tx_links links{};
+    };
+    using summary_changes = std::vector<summary_change>;
+
+    /// False implies missing block or prevouts (txs populated in parallel).
+    bool get_summary_changes(summary_changes& out,
+        const header_link& link) const NOEXCEPT;
+
+    /// The summary's block (link) is confirmed at the summary's height.
+    bool is_current(const address_summary& summary,
+        const header_link& link) const NOEXCEPT;
+
+    /// Latest current summary of the address (default if none).
+    bool get_current_summary(address_summary& out,
+        const hash_digest& key) const NOEXCEPT;
+
+    /// Supersede summaries of changed addresses by confirmation of the block
+    /// (link) at height, current only once the block is committed.
+    bool push_summaries(const summary_changes& changes,
+        const header_link& link, size_t height) NOEXCEPT;
+
+    /// Append confirmed activity of changed addresses at height.
+    bool push_activity(const summary_changes& changes, size_t height) NOEXCEPT;
+
+    /// Touched.
+    /// -----------------------------------------------------------------------
+
+    /// Address keys of block outputs and prevouts (false implies missing).
+    bool compute_touched(hashes& out, const header_link& link) const NOEXCEPT;
 
 private:
     // This value should never be read, but may be useful in debugging.
@@ -944,6 +1137,9 @@ private:
     template <typename Functor>
     static code parallel_unspent_transform(const stopper& cancel, bool turbo,
         unspents& out, const output_links& outs, Functor&& functor) NOEXCEPT;
+    template <typename Links, typename Functor>
+    static code parallel_key_transform(const stopper& cancel, bool turbo,
+        std::vector<Links>& out, const hashes& keys, Functor&& functor) NOEXCEPT;
 
     static point::cptr make_point(hash_digest&& hash,
         uint32_t index) NOEXCEPT;
@@ -954,6 +1150,9 @@ private:
     // These are thread safe.
     mutable std::shared_mutex candidate_reorganization_mutex_{};
     mutable std::shared_mutex confirmed_reorganization_mutex_{};
+
+    // Serializes existence check with put, so fee caches are written once.
+    std::mutex fee_mutex_{};
     mutable std::atomic<size_t> span_{};
     Store& store_;
 };
@@ -969,6 +1168,8 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 #include <bitcoin/database/impl/query/address/address_balance.ipp>
 #include <bitcoin/database/impl/query/address/address_history.ipp>
 #include <bitcoin/database/impl/query/address/address_outpoints.ipp>
+#include <bitcoin/database/impl/query/address/address_summary.ipp>
+#include <bitcoin/database/impl/query/address/address_touched.ipp>
 #include <bitcoin/database/impl/query/address/address_unspent.ipp>
 
 #include <bitcoin/database/impl/query/archive/chain_reader.ipp>
@@ -48,6 +48,32 @@ struct BCD_API settings
     /// Depth of electrum merkle tree interval caching.
     uint16_t interval_depth{ max_uint8 };
 
+    /// Open, load, flush, unload and close table files concurrently.
+    bool concurrent_files{ true };
+
+    /// Snapshot flushes only appended body rows and patches changed heads.
+    bool incremental_snapshot{ false };
+
+    /// Head bytes copied to memory by snapshot, beyond which heads are dumped
+    /// to staged files under the snapshot lock (bounding memory).
+    uint64_t snapshot_bytes{ 268435456 };
+
+    /// Appended bytes of a body that initiate writeback, zero disables.
+    uint64_t writeback_bytes{ 0 };
+
+    /// Head buckets migrated under each exclusive step of an online rehash.
+    uint32_t rehash_range{ 4096 };
+
+    /// Decoded headers and (witness) transactions cached, zero disables.
+    uint32_t header_cache{ 0 };
+    uint32_t tx_cache{ 0 };
+
+    /// Strong block height and mtp by tx link held in memory for confirmation.
+    bool strong_cache{ false };
+
+    /// Candidate header fields by height held in memory for chain state.
+    bool fields_cache{ false };
+
     /// Path to the database directory.
     std::filesystem::path path{ "bitcoin" };
 
@@ -60,13 +86,22 @@ struct BCD_API settings
 
     uint64_t input_size;
     uint16_t input_rate;
+    uint64_t input_reserve;
+    uint64_t input_resident;
 
     uint64_t output_size;
     uint16_t output_rate;
+    uint64_t output_reserve;
+    uint64_t output_resident;
 
     uint32_t point_buckets;
     uint64_t point_size;
     uint16_t point_rate;
+    uint64_t point_reserve;
+    uint64_t point_resident;
+    bool point_head_huge;
+    bool point_head_populate;
+    bool point_head_lock;
 
     uint64_t ins_size;
     uint16_t ins_rate;
@@ -74,9 +109,16 @@ struct BCD_API settings
     uint64_t outs_size;
     uint16_t outs_rate;
 
+    uint32_t spend_buckets;
+    uint64_t spend_size;
+    uint16_t spend_rate;
+
     uint32_t tx_buckets;
     uint64_t tx_size;
     uint16_t tx_rate;
+    bool tx_head_huge;
+    bool tx_head_populate;
+    bool tx_head_lock;
 
     uint32_t txs_buckets;
     uint64_t txs_size;
@@ -127,12 +169,19 @@ struct BCD_API settings
     uint64_t validated_tx_size;
     uint16_t validated_tx_rate;
 
+    uint32_t fee_tx_buckets;
+    uint64_t fee_tx_size;
+    uint16_t fee_tx_rate;
+
     /// Optionals.
     /// -----------------------------------------------------------------------
 
     uint32_t address_buckets;
     uint64_t address_size;
     uint16_t address_rate;
+    bool address_head_huge;
+    bool address_head_populate;
+    bool address_head_lock;
 
     uint32_t filter_bk_buckets;
     uint64_t filter_bk_size;
@@ -141,6 +190,22 @@ struct BCD_API settings
     uint32_t filter_tx_buckets;
     uint64_t filter_tx_size;
     uint16_t filter_tx_rate;
+
+    uint32_t fee_bk_buckets;
+    uint64_t fee_bk_size;
+    uint16_t fee_bk_rate;
+
+    uint32_t summary_buckets;
+    uint64_t summary_size;
+    uint16_t summary_rate;
+
+    uint32_t touched_buckets;
+    uint64_t touched_size;
+    uint16_t touched_rate;
+
+    uint32_t activity_buckets;
+    uint64_t activity_size;
+    uint16_t activity_rate;
 };
 
 } // namespace database
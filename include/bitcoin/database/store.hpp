@@ -20,11 +20,16 @@
 #define LIBBITCOIN_DATABASE_STORE_HPP
 
 #include <atomic>
+#include <chrono>
 #include <filesystem>
+#include <mutex>
 #include <shared_mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
 #include <bitcoin/database/define.hpp>
 #include <bitcoin/database/locks/locks.hpp>
+#include <bitcoin/database/memory/memory.hpp>
 #include <bitcoin/database/settings.hpp>
 #include <bitcoin/database/tables/tables.hpp>
 #include <bitcoin/database/types/types.hpp>
@@ -35,7 +40,8 @@ namespace database {
 /// The store and query interface are the primary products of database.
 /// Store provides implmentation support for the public query interface.
 /// Query privides query interface implmentation over the store.
-/// Event handlers are invoked synchronously, providing progress.
+/// Event handlers are invoked synchronously, providing progress. When file
+/// operations are concurrent, handler invocations are serialized.
 template <template <size_t...> class Storage>
 class store
 {
@@ -44,6 +50,10 @@ public:
 
     typedef std::function<void(event_t, table_t)> event_handler;
     typedef std::function<void(const code&, table_t)> error_handler;
+    typedef std::chrono::microseconds duration;
+    typedef std::function<void(const duration&, table_t)> timing_handler;
+    typedef std::function<void(const hash_statistics&, table_t)>
+        statistics_handler;
     typedef std::shared_lock<std::shared_timed_mutex> transactor;
 
     /// Event and table names, useful for internal logging.
@@ -67,18 +77,36 @@ public:
     /// Prune prunable tables (from loaded, leaves loaded).
     code prune(const event_handler& handler) NOEXCEPT;
 
-    /// Snapshot the set of tables (from loaded, leaves loaded).
+    /// Snapshot the set of tables (from loaded, leaves loaded). Writes are
+    /// suspended only while body counts are set and heads are copied.
     code snapshot(const event_handler& handler, bool prune=false) NOEXCEPT;
 
+    /// Initiate writeback of appended body rows above the configured size,
+    /// without waiting (from loaded, leaves loaded). Call periodically so that
+    /// snapshot flush is residual. Skipped while writes are suspended.
+    code writeback(const event_handler& handler) NOEXCEPT;
+
     /// Restore the most recent snapshot (from closed, leaves loaded).
     code restore(const event_handler& handler) NOEXCEPT;
 
     /// Continue from a disk full condition (from unloaded, leaves loaded).
     code reload(const event_handler& handler) NOEXCEPT;
 
+    /// Resize the head of point, tx or address table to buckets, migrating a
+    /// range of buckets per step, with writes suspended only during steps.
+    code rehash(table_t table, size_t buckets,
+        const event_handler& handler) NOEXCEPT;
+
     /// Dump all error/full conditions to handler.
     void report(const error_handler& handler) const NOEXCEPT;
 
+    /// Dump statistics of each hash table to handler (see query).
+    void report(const statistics_handler& handler,
+        size_t samples) const NOEXCEPT;
+
+    /// Dump file operation time of the last open, snapshot or close by table.
+    void report_timing(const timing_handler& handler) const NOEXCEPT;
+
     /// Unload and close the set of tables, clear locks.
     code close(const event_handler& handler) NOEXCEPT;
 
@@ -110,11 +138,51 @@ public:
 protected:
     using path = std::filesystem::path;
 
+    /// A file operation identified by table, for events and timing.
+    struct task
+    {
+        table_t table;
+        std::function<code()> run;
+    };
+    using tasks = std::vector<task>;
+
+    /// Head images captured for a snapshot, of head generation (pre-advance),
+    /// patches of the dumps of generation since (if nonzero).
+    struct head_image
+    {
+        table_t table;
+        std::string name;
+        image copy;
+    };
+    struct head_images
+    {
+        size_t generation{};
+        size_t since{};
+        std::vector<head_image> heads{};
+    };
+
+    /// Execute file operations, concurrently if configured (first error).
+    /// Timed operations accumulate into the per-table (report) timing.
+    code execute(const tasks& work, event_t event,
+        const event_handler& handler, bool timed=true) NOEXCEPT;
+    void clear_timing() NOEXCEPT;
+
     /// Method helpers.
     code open_load(const event_handler& handler) NOEXCEPT;
     code unload_close(const event_handler& handler) NOEXCEPT;
     code backup(const event_handler& handler, bool prune=false) NOEXCEPT;
-    code dump(const path& folder, const event_handler& handler) NOEXCEPT;
+    code capture(head_images& images, const event_handler& handler,
+        bool prune=false) NOEXCEPT;
+    code persist(const head_images& images,
+        const event_handler& handler) NOEXCEPT;
+    code dump(const path& folder, const event_handler& handler,
+        size_t since=zero) NOEXCEPT;
+    code copy(head_images& images, const path& folder) NOEXCEPT;
+    code write(const head_images& images, const path& folder,
+        const event_handler& handler) NOEXCEPT;
+    template <typename Table>
+    code rehash(Table& table, Storage<one>& head, table_t id, size_t buckets,
+        const event_handler& handler) NOEXCEPT;
 
     // This is thread safe.
     const settings& configuration_;
@@ -147,6 +215,10 @@ protected:
     Storage<one> outs_head_;
     Storage<one> outs_body_;
 
+    // value array
+    Storage<one> spend_head_;
+    Storage<one> spend_body_;
+
     // record hashmap
     Storage<one> tx_head_;
     Storage<one> tx_body_;
@@ -205,6 +277,10 @@ protected:
     Storage<one> validated_tx_head_;
     Storage<one> validated_tx_body_;
 
+    // record arraymap
+    Storage<one> fee_tx_head_;
+    Storage<one> fee_tx_body_;
+
     /// Optionals.
     /// -----------------------------------------------------------------------
 
@@ -220,6 +296,28 @@ protected:
     Storage<one> filter_tx_head_;
     Storage<one> filter_tx_body_;
 
+    // record arraymap
+    Storage<one> fee_bk_head_;
+    Storage<one> fee_bk_body_;
+
+    // record hashmap
+    Storage<one> summary_head_;
+    Storage<one> summary_body_;
+
+    // slab
+    Storage<one> touched_head_;
+    Storage<one> touched_body_;
+
+    // record hashmap
+    Storage<one> activity_head_;
+    Storage<one> activity_body_;
+
+    /// Rehash.
+    /// -----------------------------------------------------------------------
+
+    // shadow head (of table being rehashed)
+    Storage<one> shadow_head_;
+
     /// Locks.
     /// -----------------------------------------------------------------------
 
@@ -228,9 +326,27 @@ protected:
     interprocess_lock process_lock_;
     std::shared_timed_mutex transactor_mutex_{};
 
+    // Held (before transactor_mutex_) across snapshot, which persists outside
+    // of transactor_mutex_, and by operations that must not overlap it.
+    std::timed_mutex snapshot_mutex_{};
+
+    // These are protected by snapshot_mutex_ (head generations, zero if not
+    // known to be dumped since load).
+    size_t primary_generation_{};
+    size_t secondary_generation_{};
+
+    // These are protected by transactor_mutex_ (shadow head in use, or head
+    // left inconsistent by failure to abort a failed rehash).
+    bool rehashing_{};
+    bool rehash_fault_{};
+
     // This is thread safe.
     stopper dirty_{ true };
 
+    // These are protected by timing_mutex_.
+    std::unordered_map<table_t, duration> timing_{};
+    mutable std::mutex timing_mutex_{};
+
 private:
     static constexpr bool random = true;
     static constexpr bool sequential = false;
@@ -261,6 +377,7 @@ public:
     table::point point;
     table::ins ins;
     table::outs outs;
+    table::spend spend;
     table::transaction tx;
     table::txs txs;
 
@@ -278,11 +395,26 @@ public:
     table::prevout prevout;
     table::validated_bk validated_bk;
     table::validated_tx validated_tx;
+    table::fee_tx fee_tx;
 
     /// Optionals.
     table::address address;
     table::filter_bk filter_bk;
     table::filter_tx filter_tx;
+    table::fee_bk fee_bk;
+    table::summary summary;
+    table::touched touched;
+    table::activity activity;
+
+    /// Decoded objects (optional, cleared on open, restore and close).
+    object_cache<header_link, system::chain::header> header_objects;
+    object_cache<tx_link, system::chain::transaction> tx_objects;
+
+    /// Strong tx contexts (optional, cleared on open, restore and close).
+    strong_cache<tx_link, header_link> strong_contexts;
+
+    /// Candidate header fields (optional, cleared on open, restore and close).
+    fields_cache<header_link> candidate_fields;
 };
 
 } // namespace database
@@ -304,8 +436,10 @@ BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
 #include <bitcoin/database/impl/store/store_open.ipp>
 #include <bitcoin/database/impl/store/store_prune.ipp>
 #include <bitcoin/database/impl/store/store_snapshot.ipp>
+#include <bitcoin/database/impl/store/store_writeback.ipp>
 #include <bitcoin/database/impl/store/store_restore.ipp>
 #include <bitcoin/database/impl/store/store_reload.ipp>
+#include <bitcoin/database/impl/store/store_rehash.ipp>
 #include <bitcoin/database/impl/store/store_report.ipp>
 #include <bitcoin/database/impl/store/store_close.ipp>
 
@@ -306,6 +306,26 @@ struct header
         uint32_t bits{};
     };
 
+    struct get_fields
+      : public schema::header
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            source.skip_bytes(skip_to_mtp);
+            mtp = source.read_little_endian<uint32_t>();
+            source.skip_bytes(skip_to_version - skip_to_parent);
+            version = source.read_little_endian<uint32_t>();
+            timestamp = source.read_little_endian<uint32_t>();
+            bits = source.read_little_endian<uint32_t>();
+            return source;
+        }
+
+        context::mtp_t mtp{};
+        uint32_t version{};
+        uint32_t timestamp{};
+        uint32_t bits{};
+    };
+
     struct get_milestone
       : public schema::header
     {
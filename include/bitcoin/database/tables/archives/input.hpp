@@ -267,6 +267,29 @@ struct input
 
         bytewriter& sink;
     };
+
+    struct wire_segments
+      : public schema::input
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            // script (prefixed, stored in wire format)
+            source.skip_bytes(source.read_size());
+            script_size = source.get_read_position();
+
+            // witness (count and prefixed elements, stored in wire format)
+            const auto count = source.read_size();
+            for (size_t element{}; element < count; ++element)
+                source.skip_bytes(source.read_size());
+
+            witness_size = source.get_read_position() - script_size;
+            return source;
+        }
+
+        // Script is at zero offset, witness follows script.
+        size_t script_size{};
+        size_t witness_size{};
+    };
 };
 
 BC_POP_WARNING()
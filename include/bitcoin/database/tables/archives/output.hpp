@@ -132,6 +132,27 @@ struct output
         system::chain::script::cptr script{};
     };
 
+    // Address key (script hash) without script deserialization.
+    struct get_script_hash
+      : public schema::output
+    {
+        inline link count() const NOEXCEPT
+        {
+            BC_ASSERT(false);
+            return {};
+        }
+
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            source.skip_bytes(tx::size);
+            source.skip_variable();
+            key = system::sha256_hash(source.read_bytes(source.read_size()));
+            return source;
+        }
+
+        hash_digest key{};
+    };
+
     struct get_parent_value
       : public schema::output
     {
@@ -286,6 +307,29 @@ struct output
 
         bytewriter& sink;
     };
+
+    struct wire_segment
+      : public schema::output
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            // skip: parent_fk
+            source.skip_bytes(tx::size);
+
+            // value (translates from variable to fixed width)
+            value = source.read_variable();
+
+            // script (prefixed, stored in wire format)
+            script_position = source.get_read_position();
+            source.skip_bytes(source.read_size());
+            script_size = source.get_read_position() - script_position;
+            return source;
+        }
+
+        uint64_t value{};
+        size_t script_position{};
+        size_t script_size{};
+    };
 };
 
 BC_POP_WARNING()
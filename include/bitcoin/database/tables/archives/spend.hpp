@@ -0,0 +1,120 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TABLES_ARCHIVES_SPEND_HPP
+#define LIBBITCOIN_DATABASE_TABLES_ARCHIVES_SPEND_HPP
+
+#include <algorithm>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/tables/schema.hpp>
+
+namespace libbitcoin {
+namespace database {
+namespace table {
+
+/// spend is an array of output spender state, indexed by outs link.
+/// The value is the first spender's point fk, with a merged bit set when
+/// there are multiple spenders. A terminal point fk implies unspent, and a
+/// terminal value implies unindexed (head only, no body records).
+struct spend
+  : public array_map<schema::spend>
+{
+    using point = schema::point::link;
+    using array_map<schema::spend>::arraymap;
+    static constexpr auto offset = to_bits(point::size);
+    static_assert(offset < to_bits(link::size));
+
+    /// Combine two spender states (commutative and associative).
+    static constexpr link::integer merge(link::integer left,
+        link::integer right) NOEXCEPT
+    {
+        using namespace system;
+        // Unindexed yields to any state, then unspent to any spender.
+        if (left == link::terminal)
+            return right;
+
+        if (right == link::terminal)
+            return left;
+
+        if (left == point::terminal)
+            return right;
+
+        if (right == point::terminal || left == right)
+            return left;
+
+        // Distinct spenders (or a prior collision), retain the lesser point.
+        return set_right(std::min(set_right(left, offset, false),
+            set_right(right, offset, false)), offset, true);
+    }
+
+    struct record
+    {
+        /// Output spent by no (indexed) point.
+        inline bool unspent() const NOEXCEPT
+        {
+            return value == point::terminal;
+        }
+
+        /// Output spent by more than one point (resolve by point search).
+        inline bool multiple() const NOEXCEPT
+        {
+            return system::get_right(value, offset);
+        }
+
+        inline point::integer point_fk() const NOEXCEPT
+        {
+            using namespace system;
+            return possible_narrow_cast<point::integer>(
+                bit_and<link::integer>(value, point::terminal));
+        }
+
+        inline bool operator==(const record& other) const NOEXCEPT
+        {
+            return value == other.value;
+        }
+
+        link::integer value{ point::terminal };
+    };
+
+    /// Get the spender state of output, false if unindexed (or error).
+    inline bool find(size_t outs, record& out) const NOEXCEPT
+    {
+        const auto value = at(outs);
+        if (value.is_terminal())
+            return false;
+
+        out.value = value;
+        return true;
+    }
+
+    /// Merge spender state into output (word-atomic).
+    inline bool put(size_t outs, const record& in) NOEXCEPT
+    {
+        return arraymap::merge(outs, [&](const link& prior) NOEXCEPT
+        {
+            return link{ merge(prior, in.value) };
+        });
+    }
+};
+
+} // namespace table
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,71 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TABLES_CACHES_FEE_TX_HPP
+#define LIBBITCOIN_DATABASE_TABLES_CACHES_FEE_TX_HPP
+
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/tables/schema.hpp>
+
+namespace libbitcoin {
+namespace database {
+namespace table {
+
+/// fee_tx is a record arraymap of tx fee and virtual size, indexed by tx.fk.
+struct fee_tx
+  : public array_map<schema::fee_tx>
+{
+    using bytes = linkage<schema::size>;
+    using array_map<schema::fee_tx>::arraymap;
+
+    struct record
+      : public schema::fee_tx
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            fee = source.read_8_bytes_little_endian();
+            virtual_size = source.read_little_endian<bytes::integer, bytes::size>();
+            BC_ASSERT(!source || source.get_read_position() == count() * minrow);
+            return source;
+        }
+
+        inline bool to_data(finalizer& sink) const NOEXCEPT
+        {
+            sink.write_8_bytes_little_endian(fee);
+            sink.write_little_endian<bytes::integer, bytes::size>(virtual_size);
+            BC_ASSERT(!sink || sink.get_write_position() == count() * minrow);
+            return sink;
+        }
+
+        inline bool operator==(const record& other) const NOEXCEPT
+        {
+            return fee == other.fee
+                && virtual_size == other.virtual_size;
+        }
+
+        uint64_t fee{};
+        bytes::integer virtual_size{};
+    };
+};
+
+} // namespace table
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -38,13 +38,16 @@ enum class event_t
 
     wait_lock,
     flush_body,
+    writeback_body,
     prune_table,
     backup_table,
     copy_header,
     archive_snapshot,
 
     restore_table,
-    recover_snapshot
+    recover_snapshot,
+
+    rehash_table
 };
 
 } // namespace database
@@ -27,12 +27,14 @@ namespace libbitcoin {
 namespace database {
 namespace table {
 
-/// strong_tx is a record hashmap of tx confirmation state.
+/// strong_tx is an array of tx confirmation state, indexed by tx link.
+/// The signed header fk is the array value (head only, no body records), so
+/// a lookup is a single word read and an update is a single word write.
 struct strong_tx
-  : public hash_map<schema::strong_tx>
+  : public array_map<schema::strong_tx>
 {
     using header = schema::header::link;
-    using hash_map<schema::strong_tx>::hashmap;
+    using array_map<schema::strong_tx>::arraymap;
     static constexpr auto offset = header::bits;
     static_assert(offset < to_bits(header::size));
 
@@ -45,7 +47,6 @@ struct strong_tx
     }
 
     struct record
-      : public schema::strong_tx
     {
         inline bool positive() const NOEXCEPT
         {
@@ -57,20 +58,6 @@ struct strong_tx
             return system::set_right(signed_block_fk, offset, false);
         }
 
-        inline bool from_data(reader& source) NOEXCEPT
-        {
-            signed_block_fk = source.read_little_endian<header::integer, header::size>();
-            BC_ASSERT(!source || source.get_read_position() == minrow);
-            return source;
-        }
-
-        inline bool to_data(finalizer& sink) const NOEXCEPT
-        {
-            sink.write_little_endian<header::integer, header::size>(signed_block_fk);
-            BC_ASSERT(!sink || sink.get_write_position() == minrow);
-            return sink;
-        }
-
         inline bool operator==(const record& other) const NOEXCEPT
         {
             return positive() == other.positive()
@@ -79,6 +66,43 @@ struct strong_tx
 
         header::integer signed_block_fk{};
     };
+
+    /// The prior (hashmap) layout wrote body records, which are not read.
+    /// These are retained until the index is rebuilt (migration pending).
+    inline bool obsolete() const NOEXCEPT
+    {
+        return is_nonzero(body_size());
+    }
+
+    /// Nullify the prior layout's head cells (not states), retaining its body
+    /// records (and count) as the marker of a pending migration.
+    inline bool reset_obsolete() NOEXCEPT
+    {
+        return clear() && backup();
+    }
+
+    /// Drop the prior layout's body records, completing migration.
+    inline bool drop_obsolete() NOEXCEPT
+    {
+        return truncate(0) && backup();
+    }
+
+    /// Get the state of tx, false if never set (or error).
+    inline bool find(size_t tx, record& out) const NOEXCEPT
+    {
+        const auto value = at(tx);
+        if (value.is_terminal())
+            return false;
+
+        out.signed_block_fk = value;
+        return true;
+    }
+
+    /// Set the state of tx (word-atomic).
+    inline bool put(size_t tx, const record& in) NOEXCEPT
+    {
+        return set(tx, in.signed_block_fk);
+    }
 };
 
 } // namespace table
@@ -82,6 +82,7 @@ namespace caches
     constexpr auto duplicate = "cache_duplicate";
     constexpr auto validated_bk = "validated_bk";
     constexpr auto validated_tx = "validated_tx";
+    constexpr auto fee_tx = "fee_tx";
 }
 
 namespace optionals
@@ -89,6 +90,10 @@ namespace optionals
     constexpr auto address = "option_address";
     constexpr auto filter_bk = "option_filter_bk";
     constexpr auto filter_tx = "option_filter_tx";
+    constexpr auto fee_bk = "option_fee_bk";
+    constexpr auto summary = "option_summary";
+    constexpr auto touched = "option_touched";
+    constexpr auto activity = "option_activity";
 }
 
 namespace locks
@@ -102,6 +107,8 @@ namespace ext
     constexpr auto head = ".head";
     constexpr auto data = ".data";
     constexpr auto lock = ".lock";
+    constexpr auto rehash = ".rehash";
+    constexpr auto staged = ".staged";
 }
 
 } // namespace schema
@@ -0,0 +1,72 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TABLES_OPTIONALS_ACTIVITY_HPP
+#define LIBBITCOIN_DATABASE_TABLES_OPTIONALS_ACTIVITY_HPP
+
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/tables/schema.hpp>
+
+namespace libbitcoin {
+namespace database {
+namespace table {
+
+/// activity is a record multimap of confirmed address txs (latest first).
+struct activity
+  : public hash_map<schema::activity>
+{
+    using height_t = linkage<schema::height_>;
+    using tx = schema::transaction::link;
+    using hash_map<schema::activity>::hashmap;
+
+    struct record
+      : public schema::activity
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            height = source.read_little_endian<height_t::integer,
+                height_t::size>();
+            tx_fk = source.read_little_endian<tx::integer, tx::size>();
+            return source;
+        }
+
+        inline bool to_data(finalizer& sink) const NOEXCEPT
+        {
+            sink.write_little_endian<height_t::integer, height_t::size>(
+                height);
+            sink.write_little_endian<tx::integer, tx::size>(tx_fk);
+            return sink;
+        }
+
+        inline bool operator==(const record& other) const NOEXCEPT
+        {
+            return height == other.height
+                && tx_fk == other.tx_fk;
+        }
+
+        height_t::integer height{};
+        tx::integer tx_fk{};
+    };
+};
+
+} // namespace table
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TABLES_OPTIONALS_FEE_BK_HPP
+#define LIBBITCOIN_DATABASE_TABLES_OPTIONALS_FEE_BK_HPP
+
+#include <algorithm>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/tables/schema.hpp>
+#include <bitcoin/database/types/fee_histogram.hpp>
+
+namespace libbitcoin {
+namespace database {
+namespace table {
+
+/// fee_bk is a record arraymap of fee rate histograms indexed by block link.
+struct fee_bk
+  : public array_map<schema::fee_bk>
+{
+    using bytes = linkage<schema::size>;
+    using array_map<schema::fee_bk>::arraymap;
+    static_assert(fee_histogram::buckets * bytes::size == minsize -
+        3u * sizeof(uint32_t));
+
+    struct record
+      : public schema::fee_bk
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            for (auto& weight: histogram.weights)
+                weight = source.read_little_endian<bytes::integer, bytes::size>();
+
+            histogram.minimum = source.read_little_endian<uint32_t>();
+            histogram.median = source.read_little_endian<uint32_t>();
+            histogram.maximum = source.read_little_endian<uint32_t>();
+            BC_ASSERT(!source || source.get_read_position() == count() * minrow);
+            return source;
+        }
+
+        inline bool to_data(finalizer& sink) const NOEXCEPT
+        {
+            // Weights saturate at the bytes domain (exceeds any block).
+            for (const auto weight: histogram.weights)
+                sink.write_little_endian<bytes::integer, bytes::size>(
+                    std::min<bytes::integer>(weight, bytes::terminal));
+
+            sink.write_little_endian<uint32_t>(histogram.minimum);
+            sink.write_little_endian<uint32_t>(histogram.median);
+            sink.write_little_endian<uint32_t>(histogram.maximum);
+            BC_ASSERT(!sink || sink.get_write_position() == count() * minrow);
+            return sink;
+        }
+
+        inline bool operator==(const record& other) const NOEXCEPT
+        {
+            return histogram == other.histogram;
+        }
+
+        fee_histogram histogram{};
+    };
+};
+
+} // namespace table
+} // namespace database
+} // namespace libbitcoin
+
+#endif
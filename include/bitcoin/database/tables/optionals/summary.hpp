@@ -0,0 +1,108 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TABLES_OPTIONALS_SUMMARY_HPP
+#define LIBBITCOIN_DATABASE_TABLES_OPTIONALS_SUMMARY_HPP
+
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/tables/schema.hpp>
+#include <bitcoin/database/types/address_summary.hpp>
+
+namespace libbitcoin {
+namespace database {
+namespace table {
+
+/// summary is a record multimap of address summaries (latest first).
+/// Each confirmation of a block appends a record for each address that it
+/// touches, so the table grows with address activity. A record is current
+/// only while its block is confirmed at its height, so superseded records
+/// (reorganized or partially written) are skipped upon read.
+struct summary
+  : public hash_map<schema::summary>
+{
+    using height_t = linkage<schema::height_>;
+    using header = schema::header::link;
+    using hash_map<schema::summary>::hashmap;
+
+    struct record
+      : public schema::summary
+    {
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            summary.balance = source.read_little_endian<uint64_t>();
+            summary.funded = source.read_little_endian<uint32_t>();
+            summary.spent = source.read_little_endian<uint32_t>();
+            summary.height = source.read_little_endian<height_t::integer,
+                height_t::size>();
+            header_fk = source.read_little_endian<header::integer,
+                header::size>();
+            read_status(source, summary.status);
+            return source;
+        }
+
+        inline bool to_data(finalizer& sink) const NOEXCEPT
+        {
+            using namespace system;
+            sink.write_little_endian<uint64_t>(summary.balance);
+            sink.write_little_endian<uint32_t>(summary.funded);
+            sink.write_little_endian<uint32_t>(summary.spent);
+            sink.write_little_endian<height_t::integer, height_t::size>(
+                possible_narrow_cast<height_t::integer>(summary.height));
+            sink.write_little_endian<header::integer, header::size>(
+                header_fk);
+            write_status(sink, summary.status);
+            return sink;
+        }
+
+        inline bool operator==(const record& other) const NOEXCEPT
+        {
+            return summary == other.summary
+                && header_fk == other.header_fk;
+        }
+
+        address_summary summary{};
+        header::integer header_fk{};
+    };
+
+    static inline void read_status(reader& source,
+        address_status& status) NOEXCEPT
+    {
+        for (auto& word: status.state)
+            word = source.read_little_endian<uint32_t>();
+
+        source.read_bytes(status.buffer.data(), status.buffer.size());
+        status.size = source.read_little_endian<uint64_t>();
+    }
+
+    static inline void write_status(finalizer& sink,
+        const address_status& status) NOEXCEPT
+    {
+        for (const auto word: status.state)
+            sink.write_little_endian<uint32_t>(word);
+
+        sink.write_bytes(status.buffer);
+        sink.write_little_endian<uint64_t>(status.size);
+    }
+};
+
+} // namespace table
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -0,0 +1,85 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TABLES_OPTIONALS_TOUCHED_HPP
+#define LIBBITCOIN_DATABASE_TABLES_OPTIONALS_TOUCHED_HPP
+
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/primitives/primitives.hpp>
+#include <bitcoin/database/tables/schema.hpp>
+
+namespace libbitcoin {
+namespace database {
+namespace table {
+
+/// touched is a slab of sorted address keys indexed by block link.
+struct touched
+  : public array_map<schema::touched>
+{
+    using array_map<schema::touched>::arraymap;
+
+    struct get_keys
+      : public schema::touched
+    {
+        inline link count() const NOEXCEPT
+        {
+            return system::possible_narrow_cast<link::integer>(
+                variable_size(keys.size()) + keys.size() * schema::hash);
+        }
+
+        inline bool from_data(reader& source) NOEXCEPT
+        {
+            keys.resize(source.read_size());
+            for (auto& key: keys)
+                key = source.read_hash();
+
+            BC_ASSERT(!source || source.get_read_position() == count());
+            return source;
+        }
+
+        system::hashes keys{};
+    };
+
+    struct put_ref
+      : public schema::touched
+    {
+        inline link count() const NOEXCEPT
+        {
+            return system::possible_narrow_cast<link::integer>(
+                variable_size(keys.size()) + keys.size() * schema::hash);
+        }
+
+        inline bool to_data(finalizer& sink) const NOEXCEPT
+        {
+            sink.write_variable(keys.size());
+            for (const auto& key: keys)
+                sink.write_bytes(key);
+
+            BC_ASSERT(!sink || sink.get_write_position() == count());
+            return sink;
+        }
+
+        const system::hashes& keys{};
+    };
+};
+
+} // namespace table
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -56,13 +56,16 @@ constexpr size_t dup = 2;       // ->duplicate [TODO: increase to 3]
 constexpr size_t put = 5;       // ->input/output slab.
 constexpr size_t ins_ = 4;      // ->point|ins record.
 constexpr size_t outs_ = 4;     // ->outs (puts) record.
-constexpr size_t spend_ = 4;    // ->spend record.
+constexpr size_t spend_ = 5;    // ->spend value (point + bit).
 constexpr size_t prevout_ = 5;  // ->prevout slab.
 constexpr size_t txs_ = 5;      // ->txs slab.
 constexpr size_t tx = 4;        // ->tx record.
 constexpr size_t block = 3;     // ->header record.
 constexpr size_t tx_slab = 5;   // ->validated_tx record.
 constexpr size_t filter_ = 5;   // ->filter record.
+constexpr size_t summary_ = 5;  // ->summary record.
+constexpr size_t touched_ = 5;  // ->touched slab.
+constexpr size_t activity_ = 5; // ->activity record.
 constexpr size_t doubles_ = 4;  // doubles bucket (no actual keys).
 
 /// Archive tables.
@@ -215,6 +218,22 @@ struct outs
     static_assert(link::size == 4u);
 };
 
+// value arraymap (head only, indexed by outs link)
+struct spend
+{
+    static constexpr size_t align = true;
+    static constexpr size_t pk = schema::spend_;
+    using link = linkage<pk, to_bits(pk)>;
+    static constexpr size_t minsize =
+        ////schema::bit +     // multiple (merged bit above point::pk)
+        schema::point::pk;
+    static constexpr size_t minrow = minsize;
+    static constexpr size_t size = minsize;
+    static_assert(minsize == 4u);
+    static_assert(minrow == 4u);
+    static_assert(link::size == 5u);
+};
+
 // slab arraymap
 struct txs
 {
@@ -254,24 +273,20 @@ struct height
     static_assert(link::size == 3u);
 };
 
-// record hashmap
+// value arraymap (head only, indexed by tx link)
 struct strong_tx
 {
-    static constexpr size_t sk = schema::transaction::pk;
+    static constexpr size_t align = true;
     static constexpr size_t pk = schema::transaction::pk;
     using link = linkage<pk, to_bits(pk)>;
-    using key = system::data_array<sk>;
     static constexpr size_t minsize =
         ////schema::bit +     // positive (merged bit into header::pk)
         schema::header::pk;
-    static constexpr size_t minrow = pk + sk + minsize;
+    static constexpr size_t minrow = minsize;
     static constexpr size_t size = minsize;
-    static constexpr size_t cell = link::size;
-    static constexpr link count() NOEXCEPT { return 1; }
     static_assert(minsize == 3u);
-    static_assert(minrow == 11u);
+    static_assert(minrow == 3u);
     static_assert(link::size == 4u);
-    static_assert(cell == 4u);
 };
 
 /// Cache tables.
@@ -374,6 +389,23 @@ struct validated_tx
     static_assert(link::size == 5u);
 };
 
+// record arraymap
+struct fee_tx
+{
+    static constexpr size_t align = false;
+    static constexpr size_t pk = schema::tx;
+    using link = linkage<pk, to_bits(pk)>;
+    static constexpr size_t minsize =
+        sizeof(uint64_t) +      // fee
+        schema::size;           // virtual size
+    static constexpr size_t minrow = minsize;
+    static constexpr size_t size = minsize;
+    static constexpr link count() NOEXCEPT { return 1; }
+    static_assert(minsize == 11u);
+    static_assert(minrow == 11u);
+    static_assert(link::size == 4u);
+};
+
 /// Optional tables.
 /// ---------------------------------------------------------------------------
 
@@ -431,6 +463,88 @@ struct filter_tx
     static_assert(link::size == 5u);
 };
 
+// record arraymap
+struct fee_bk
+{
+    static constexpr size_t align = false;
+    static constexpr size_t pk = schema::header::pk;
+    using link = linkage<pk, to_bits(pk)>;
+    static constexpr size_t minsize =
+        16u * schema::size +    // weights (fee_histogram::buckets)
+        sizeof(uint32_t) +      // minimum rate
+        sizeof(uint32_t) +      // median rate
+        sizeof(uint32_t);       // maximum rate
+    static constexpr size_t minrow = minsize;
+    static constexpr size_t size = minsize;
+    static constexpr link count() NOEXCEPT { return 1; }
+    static_assert(minsize == 60u);
+    static_assert(minrow == 60u);
+    static_assert(link::size == 3u);
+};
+
+// large (sk:32) record multimap, with one record per confirmation.
+// summary records are superseded (latest first), never modified.
+struct summary
+{
+    static constexpr size_t sk = schema::hash;
+    static constexpr size_t pk = schema::summary_;
+    using link = linkage<pk, to_bits(pk)>;
+    using key = system::data_array<sk>;
+    static constexpr size_t minsize =
+        sizeof(uint64_t) +      // balance
+        sizeof(uint32_t) +      // funded
+        sizeof(uint32_t) +      // spent
+        schema::height_ +       // height
+        schema::block +         // header fk
+        schema::hash +          // status state
+        two * schema::hash +    // status buffer
+        sizeof(uint64_t);       // status size
+    static constexpr size_t minrow = pk + sk + minsize;
+    static constexpr size_t size = minsize;
+    static constexpr size_t cell = link::size;
+    static constexpr link count() NOEXCEPT { return 1; }
+    static_assert(minsize == 126u);
+    static_assert(minrow == 163u);
+    static_assert(link::size == 5u);
+    static_assert(cell == 5u);
+};
+
+// slab arraymap
+struct touched
+{
+    static constexpr size_t align = false;
+    static constexpr size_t pk = schema::touched_;
+    using link = linkage<pk, to_bits(pk)>;
+    static constexpr size_t minsize =
+        one;                    // address count (variable)
+    static constexpr size_t minrow = minsize;
+    static constexpr size_t size = max_size_t;
+    static inline link count() NOEXCEPT;
+    static_assert(minsize == 1u);
+    static_assert(minrow == 1u);
+    static_assert(link::size == 5u);
+};
+
+// record hashmap
+struct activity
+{
+    static constexpr size_t sk = schema::hash;
+    static constexpr size_t pk = schema::activity_;
+    using link = linkage<pk, to_bits(pk)>;
+    using key = system::data_array<sk>;
+    static constexpr size_t minsize =
+        schema::height_ +       // height
+        schema::tx;             // tx.pk
+    static constexpr size_t minrow = pk + sk + minsize;
+    static constexpr size_t size = minsize;
+    static constexpr size_t cell = link::size;
+    static constexpr link count() NOEXCEPT { return 1; }
+    static_assert(minsize == 7u);
+    static_assert(minrow == 44u);
+    static_assert(link::size == 5u);
+    static_assert(cell == 5u);
+};
+
 } // namespace schema
 } // namespace database
 } // namespace libbitcoin
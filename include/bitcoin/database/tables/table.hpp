@@ -93,6 +93,9 @@ enum class table_t
     validated_tx_table,
     validated_tx_head,
     validated_tx_body,
+    fee_tx_table,
+    fee_tx_head,
+    fee_tx_body,
 
     /// Optionals.
     address_table,
@@ -103,7 +106,19 @@ enum class table_t
     filter_bk_body,
     filter_tx_table,
     filter_tx_head,
-    filter_tx_body
+    filter_tx_body,
+    fee_bk_table,
+    fee_bk_head,
+    fee_bk_body,
+    summary_table,
+    summary_head,
+    summary_body,
+    touched_table,
+    touched_head,
+    touched_body,
+    activity_table,
+    activity_head,
+    activity_body
 };
 
 } // namespace database
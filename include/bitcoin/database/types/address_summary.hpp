@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TYPES_ADDRESS_SUMMARY_HPP
+#define LIBBITCOIN_DATABASE_TYPES_ADDRESS_SUMMARY_HPP
+
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/types/history.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Electrum status of an address, the sha256 of "txid:height:" for each tx of
+/// its history in Electrum order. The sha256 midstate is retained, so that
+/// confirmed history is extended by block and finalized only upon read.
+struct BCD_API address_status
+{
+    using state_t = system::sha256::state_t;
+    using block_t = system::sha256::block_t;
+    static constexpr state_t initial = system::sha256::H::get;
+
+    /// Append tx at height (history::unrooted_height is written as -1).
+    void write(const hash_digest& tx, size_t height) NOEXCEPT;
+
+    /// Status of the history written, or null_hash if none (Electrum null).
+    hash_digest finalize() const NOEXCEPT;
+
+    bool operator==(const address_status&) const NOEXCEPT = default;
+
+    /// Compressed blocks, buffered tail (size modulo block) and total size.
+    state_t state{ initial };
+    block_t buffer{};
+    uint64_t size{};
+};
+
+/// Confirmed state of an address (output script hash), as of its most recent
+/// confirmed block. Default is the state of an address never confirmed.
+struct BCD_API address_summary
+{
+    bool operator==(const address_summary&) const NOEXCEPT = default;
+
+    /// Sum of confirmed unspent output values.
+    uint64_t balance{};
+
+    /// Count of confirmed outputs to, and of confirmed spends from, address.
+    uint32_t funded{};
+    uint32_t spent{};
+
+    /// Height of the most recent confirmed block that touched the address.
+    size_t height{};
+
+    /// Unfinalized Electrum status of confirmed history.
+    address_status status{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
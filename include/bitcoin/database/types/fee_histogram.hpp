@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TYPES_FEE_HISTOGRAM_HPP
+#define LIBBITCOIN_DATABASE_TYPES_FEE_HISTOGRAM_HPP
+
+#include <array>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/types/fee_rate.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Fee rate distribution of a block's txs (excluding coinbase), with rates
+/// in satoshis per thousand virtual bytes and weights in virtual bytes.
+struct BCD_API fee_histogram
+{
+    static constexpr size_t buckets = 16;
+
+    /// Lower bound rate of each bucket (the last is unbounded).
+    static constexpr std::array<uint32_t, buckets> bounds
+    {
+        0, 1'000, 2'000, 3'000, 4'000, 5'000, 7'000, 10'000, 15'000,
+        20'000, 30'000, 50'000, 75'000, 100'000, 200'000, 500'000
+    };
+
+    /// Rate of a tx fee over its virtual size (saturating).
+    static uint32_t to_rate(const fee_rate& rate) NOEXCEPT;
+
+    /// Histogram of the tx fee rates of a block.
+    static fee_histogram from_rates(const fee_rates& rates) NOEXCEPT;
+
+    bool operator==(const fee_histogram& other) const NOEXCEPT;
+
+    /// Virtual bytes of txs with rate in each bucket.
+    std::array<uint32_t, buckets> weights{};
+
+    /// Minimum, median (by virtual bytes) and maximum tx rate.
+    uint32_t minimum{};
+    uint32_t median{};
+    uint32_t maximum{};
+};
+
+using fee_histograms = std::vector<fee_histogram>;
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
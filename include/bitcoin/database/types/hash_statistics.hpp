@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#ifndef LIBBITCOIN_DATABASE_TYPES_HASH_STATISTICS_HPP
+#define LIBBITCOIN_DATABASE_TYPES_HASH_STATISTICS_HPP
+
+#include <array>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+/// Hash table occupancy and search statistics, approximate under writes.
+struct BCD_API hash_statistics
+{
+    /// Histogram bins of conflict list length, last bin includes longer.
+    static constexpr size_t bins = 16;
+
+    /// Elements per bucket.
+    inline double load_factor() const NOEXCEPT
+    {
+        return is_zero(buckets) ? 0.0 :
+            static_cast<double>(elements) / buckets;
+    }
+
+    /// Elements visited per sampled lookup of an existing key.
+    inline double average_probes() const NOEXCEPT
+    {
+        return is_zero(lookups) ? 0.0 :
+            static_cast<double>(probes) / lookups;
+    }
+
+    /// Portion of sampled absent keys (in occupied buckets) screened out.
+    inline double filter_hit_rate() const NOEXCEPT
+    {
+        const auto screens = filter_hits + filter_misses;
+        return is_zero(screens) ? 0.0 :
+            static_cast<double>(filter_hits) / screens;
+    }
+
+    /// Head buckets and body count (records, or bytes for slabs).
+    size_t buckets{};
+    size_t body_count{};
+
+    /// Elements linked from head, and longest conflict list.
+    size_t elements{};
+    size_t longest{};
+
+    /// Count of buckets by conflict list length (zero is unoccupied).
+    std::array<size_t, bins> chains{};
+
+    /// Sampled lookups of existing keys and the elements they visited.
+    size_t lookups{};
+    size_t probes{};
+
+    /// Sampled absent keys screened out by filter (hit) or not (miss).
+    size_t filter_hits{};
+    size_t filter_misses{};
+};
+
+} // namespace database
+} // namespace libbitcoin
+
+#endif
@@ -65,6 +65,7 @@ struct BCD_API history
 };
 
 using histories = std::vector<history>;
+using history_sets = std::vector<histories>;
 
 } // namespace database
 } // namespace libbitcoin
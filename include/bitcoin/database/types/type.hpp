@@ -43,6 +43,7 @@ using tx_link = table::transaction::link;
 using filter_link = table::filter_tx::link;
 using strong_link = table::strong_tx::link;
 using address_link = table::address::link;
+using summary_link = table::summary::link;
 using ecdsa_link = table::ecdsa_correlate::link;
 using schnorr_link = table::schnorr_correlate::link;
 using silent_link = table::silent_correlate::link;
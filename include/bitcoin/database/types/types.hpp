@@ -19,10 +19,13 @@
 #ifndef LIBBITCOIN_DATABASE_TYPES_TYPES_HPP
 #define LIBBITCOIN_DATABASE_TYPES_TYPES_HPP
 
+#include <bitcoin/database/types/address_summary.hpp>
 #include <bitcoin/database/types/association.hpp>
 #include <bitcoin/database/types/associations.hpp>
 #include <bitcoin/database/types/block_state.hpp>
+#include <bitcoin/database/types/fee_histogram.hpp>
 #include <bitcoin/database/types/fee_rate.hpp>
+#include <bitcoin/database/types/hash_statistics.hpp>
 #include <bitcoin/database/types/header_state.hpp>
 #include <bitcoin/database/types/history.hpp>
 #include <bitcoin/database/types/multisig_view.hpp>
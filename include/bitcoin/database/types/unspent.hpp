@@ -59,6 +59,7 @@ struct BCD_API unspent
 };
 
 using unspents = std::vector<unspent>;
+using unspent_sets = std::vector<unspents>;
 
 } // namespace database
 } // namespace libbitcoin
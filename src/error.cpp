@@ -65,6 +65,7 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { sysconf_failure, "sysconf failure" },
     { ftruncate_failure, "ftruncate failure" },
     { fsync_failure, "fsync failure" },
+    { mlock_failure, "mlock failure" },
 
     // locks
     { transactor_lock, "transactor lock failure" },
@@ -83,6 +84,7 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { not_coalesced, "not coalesced" },
     { missing_snapshot, "missing snapshot" },
     { unloaded_file, "file not loaded" },
+    { rehash_active, "rehash in progress" },
 
     // tables
     { create_table, "failed to create table" },
@@ -91,6 +93,7 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { backup_table, "failed to backup table" },
     { restore_table, "failed to restore table" },
     { verify_table, "failed to verify table" },
+    { rehash_table, "failed to rehash table" },
 
     // states
     { tx_connected, "transaction connected" },
@@ -116,6 +119,7 @@ DEFINE_ERROR_T_MESSAGE_MAP(error)
     { tx_tx_set, "tx_tx_set" },
     { tx_address_allocate, "tx_address_allocate" },
     { tx_address_put, "tx_address_put" },
+    { tx_spend_put, "tx_spend_put" },
     { tx_tx_commit, "tx_tx_commit" },
 
     // header archive
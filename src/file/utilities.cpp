@@ -21,6 +21,11 @@
 #if defined(HAVE_MSC)
     #include <io.h>
 #endif
+#if !defined(HAVE_MSC) && defined(__linux__)
+    #include <linux/fs.h>
+    #include <sys/ioctl.h>
+    #include <unistd.h>
+#endif
 #include <fcntl.h>
 #include <sys/stat.h>
 #include <sys/types.h>
@@ -208,9 +213,78 @@ bool copy(const path& from, const path& to) NOEXCEPT
     return !copy_ex(from, to);
 }
 
+#if !defined(HAVE_MSC) && defined(__linux__)
+// Clone (FICLONE reflink) the file, or copy it within the kernel
+// (copy_file_range). False if neither completed, with no target remaining.
+inline bool kernel_copy(const path& from, const path& to) NOEXCEPT
+{
+    const auto source = ::open(system::extended_path(from).c_str(),
+        O_RDONLY | O_CLOEXEC);
+    if (source == -1)
+        return false;
+
+    struct stat status{};
+    if (::fstat(source, &status) == -1 || !S_ISREG(status.st_mode))
+    {
+        ::close(source);
+        return false;
+    }
+
+    // Target must not exist (consistent with std::filesystem::copy_file).
+    const auto target_path = system::extended_path(to);
+    const auto target = ::open(target_path.c_str(),
+        O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, status.st_mode & 0777);
+    if (target == -1)
+    {
+        ::close(source);
+        return false;
+    }
+
+#if defined(FICLONE)
+    // Reflink shares extents (XFS, btrfs), a metadata-only operation.
+    auto copied = (::ioctl(target, FICLONE, source) != -1);
+#else
+    auto copied = false;
+#endif
+
+    // Kernel copy (server-side or extent sharing if supported, otherwise
+    // page cache to page cache), with no user-space buffering.
+    if (!copied)
+    {
+        auto remaining = possible_narrow_sign_cast<size_t>(status.st_size);
+        while (!is_zero(remaining))
+        {
+            const auto count = ::copy_file_range(source, nullptr, target,
+                nullptr, remaining, 0);
+            if (count <= 0)
+                break;
+
+            remaining -= possible_narrow_sign_cast<size_t>(count);
+        }
+
+        copied = is_zero(remaining);
+    }
+
+    copied = (::close(target) != -1) && copied;
+    ::close(source);
+
+    // Remove partial target, so that fallback copy can proceed.
+    if (!copied)
+        ::unlink(target_path.c_str());
+
+    return copied;
+}
+#endif
+
 // file
 code copy_ex(const path& from, const path& to) NOEXCEPT
 {
+#if !defined(HAVE_MSC) && defined(__linux__)
+    if (kernel_copy(from, to))
+        return system::error::errorno_t::no_error;
+#endif
+
+    // Fallback (and error reporting) is a user-space copy.
     code ec{ system::error::errorno_t::no_error };
     std::filesystem::copy_file(system::extended_path(from),
         system::extended_path(to), ec);
@@ -234,8 +308,27 @@ code copy_directory_ex(const path& from, const path& to) NOEXCEPT
         return system::error::errorno_t::not_a_directory;
 
     code ec{ system::error::errorno_t::no_error };
-    std::filesystem::copy(system::extended_path(from),
-        system::extended_path(to), ec);
+    std::filesystem::create_directory(system::extended_path(to), ec);
+    if (ec) return ec;
+
+    // Regular files are copied individually so that each may be cloned.
+    // Subdirectories are created and copied recursively (others skipped).
+    std::filesystem::directory_iterator it{ system::extended_path(from), ec };
+    for (; !ec && it != std::filesystem::directory_iterator{};
+        it.increment(ec))
+    {
+        const auto name = it->path().filename();
+        if (it->is_directory(ec))
+        {
+            if ((ec = copy_directory_ex(from / name, to / name)))
+                return ec;
+        }
+        else if (!ec && it->is_regular_file(ec))
+        {
+            if ((ec = copy_ex(from / name, to / name)))
+                return ec;
+        }
+    }
 
     return ec;
 }
@@ -0,0 +1,74 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/memory/image.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <bitcoin/database/define.hpp>
+#include <bitcoin/database/file/file.hpp>
+#include <bitcoin/database/memory/mman.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+code image::dump(const path& path) const NOEXCEPT
+{
+    if (!staged.empty())
+    {
+        // Staged full map replaces any prior dump.
+        if (const auto ec = file::remove_ex(path))
+            return ec;
+
+        return file::rename_ex(staged, path);
+    }
+
+    if (!patch)
+        return file::create_file_ex(path, data.data(), data.size());
+
+#if defined(HAVE_MSC)
+    // Patches are not captured where pwrite is not available.
+    return system::error::errorno_t::not_a_stream;
+#else
+    int descriptor{};
+    if (const auto ec = file::open_ex(descriptor, path))
+        return ec;
+
+    auto source = data.data();
+    for (const auto index: pages)
+    {
+        const auto offset = index * page;
+        const auto bytes = std::min(page, system::floored_subtract(size,
+            offset));
+
+        if (::pwrite(descriptor, source, bytes, system::possible_narrow_sign_cast<
+            off_t>(offset)) != system::possible_narrow_sign_cast<ssize_t>(bytes))
+        {
+            file::close(descriptor);
+            return system::error::errorno_t::not_a_stream;
+        }
+
+        std::advance(source, bytes);
+    }
+
+    return file::close_ex(descriptor);
+#endif
+}
+
+} // namespace database
+} // namespace libbitcoin
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/memory/striped_mutex.hpp>
+
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+BC_PUSH_WARNING(NO_THROW_IN_NOEXCEPT)
+
+// Reader increment and writer flag are sequentially consistent, so either the
+// reader observes the flag (and backs off) or the writer observes the count.
+// Counts are summed because a shared lock may be released on another thread,
+// in which case the individual counters are unbalanced (but not the sum).
+
+striped_mutex::striped_mutex() NOEXCEPT
+{
+}
+
+// Exclusive.
+// ----------------------------------------------------------------------------
+
+void striped_mutex::lock() NOEXCEPT
+{
+    writer_.lock();
+    exclusive_.store(true);
+
+    while (!is_idle())
+        std::this_thread::yield();
+}
+
+bool striped_mutex::try_lock() NOEXCEPT
+{
+    if (!writer_.try_lock())
+        return false;
+
+    exclusive_.store(true);
+    if (is_idle())
+        return true;
+
+    unlock();
+    return false;
+}
+
+void striped_mutex::unlock() NOEXCEPT
+{
+    exclusive_.store(false);
+    exclusive_.notify_all();
+    writer_.unlock();
+}
+
+// Shared.
+// ----------------------------------------------------------------------------
+
+void striped_mutex::lock_shared() NOEXCEPT
+{
+    auto& count = stripes_.at(to_stripe()).count;
+    while (true)
+    {
+        count.fetch_add(one);
+        if (!exclusive_.load())
+            return;
+
+        // Back off so that the writer can drain, then wait for its release.
+        count.fetch_sub(one);
+        exclusive_.wait(true);
+    }
+}
+
+bool striped_mutex::try_lock_shared() NOEXCEPT
+{
+    auto& count = stripes_.at(to_stripe()).count;
+    count.fetch_add(one);
+    if (!exclusive_.load())
+        return true;
+
+    count.fetch_sub(one);
+    return false;
+}
+
+void striped_mutex::unlock_shared() NOEXCEPT
+{
+    stripes_.at(to_stripe()).count.fetch_sub(one, std::memory_order_release);
+}
+
+// private
+// ----------------------------------------------------------------------------
+
+size_t striped_mutex::to_stripe() NOEXCEPT
+{
+    static std::atomic<size_t> next{};
+    thread_local const auto stripe = next.fetch_add(one,
+        std::memory_order_relaxed) % stripes;
+
+    return stripe;
+}
+
+bool striped_mutex::is_idle() const NOEXCEPT
+{
+    int64_t total{};
+    for (const auto& stripe: stripes_)
+        total += stripe.count.load();
+
+    return is_zero(total);
+}
+
+BC_POP_WARNING()
+
+} // namespace database
+} // namespace libbitcoin
@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/memory/wire_iov.hpp>
+
+#include <iterator>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+void wire_iov::pin(const memory_ptr& memory) NOEXCEPT
+{
+    if (memory)
+        pins_.push_back(memory);
+}
+
+bool wire_iov::append(const memory_ptr& memory, size_t position,
+    size_t size) NOEXCEPT
+{
+    using namespace system;
+    if (!memory || is_add_overflow(position, size))
+        return false;
+
+    const auto end = possible_narrow_and_sign_cast<ptrdiff_t>(position + size);
+    if (end > memory->size())
+        return false;
+
+    // Offset is null if position is at or beyond end (empty is not added).
+    if (is_zero(size))
+        return true;
+
+    const auto data = memory->offset(position);
+    if (is_null(data))
+        return false;
+
+    add(data, size);
+    return true;
+}
+
+void wire_iov::finalize() NOEXCEPT
+{
+    // Side segments are appended in order, so resolve by running offset.
+    size_t offset{};
+    for (auto& segment: segments_)
+    {
+        if (is_null(segment.first))
+        {
+            segment.first = std::next(side_.data(), offset);
+            offset += segment.second;
+        }
+    }
+}
+
+void wire_iov::clear() NOEXCEPT
+{
+    segments_.clear();
+    side_.clear();
+    pins_.clear();
+    size_ = zero;
+}
+
+const wire_iov::segments& wire_iov::get_segments() const NOEXCEPT
+{
+    return segments_;
+}
+
+size_t wire_iov::size() const NOEXCEPT
+{
+    return size_;
+}
+
+data_chunk wire_iov::to_data() const NOEXCEPT
+{
+    data_chunk out{};
+    out.reserve(size_);
+    for (const auto& segment: segments_)
+        out.insert(out.end(), segment.first,
+            std::next(segment.first, segment.second));
+
+    return out;
+}
+
+// private
+void wire_iov::add(const uint8_t* data, size_t size) NOEXCEPT
+{
+    if (is_zero(size))
+        return;
+
+    size_ += size;
+
+    // Merge adjacent side segments, and contiguous memory segments.
+    if (!segments_.empty())
+    {
+        auto& last = segments_.back();
+        if ((is_null(data) && is_null(last.first)) || (!is_null(data) &&
+            !is_null(last.first) && std::next(last.first, last.second) == data))
+        {
+            last.second += size;
+            return;
+        }
+    }
+
+    segments_.emplace_back(data, size);
+}
+
+} // namespace database
+} // namespace libbitcoin
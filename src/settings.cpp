@@ -35,13 +35,22 @@ settings::settings() NOEXCEPT
 
     input_size{ 1 },
     input_rate{ 50 },
+    input_reserve{ 0 },
+    input_resident{ 0 },
 
     output_size{ 1 },
     output_rate{ 50 },
+    output_reserve{ 0 },
+    output_resident{ 0 },
 
     point_buckets{ 128 },
     point_size{ 1 },
     point_rate{ 50 },
+    point_reserve{ 0 },
+    point_resident{ 0 },
+    point_head_huge{ false },
+    point_head_populate{ false },
+    point_head_lock{ false },
 
     ins_size{ 1 },
     ins_rate{ 50 },
@@ -49,9 +58,16 @@ settings::settings() NOEXCEPT
     outs_size{ 1 },
     outs_rate{ 50 },
 
+    spend_buckets{ 0 },
+    spend_size{ 1 },
+    spend_rate{ 50 },
+
     tx_buckets{ 128 },
     tx_size{ 1 },
     tx_rate{ 50 },
+    tx_head_huge{ false },
+    tx_head_populate{ false },
+    tx_head_lock{ false },
 
     txs_buckets{ 128 },
     txs_size{ 1 },
@@ -99,11 +115,18 @@ settings::settings() NOEXCEPT
     validated_tx_size{ 1 },
     validated_tx_rate{ 50 },
 
+    fee_tx_buckets{ 0 },
+    fee_tx_size{ 1 },
+    fee_tx_rate{ 50 },
+
     // Optionals.
 
     address_buckets{ 128 },
     address_size{ 1 },
     address_rate{ 50 },
+    address_head_huge{ false },
+    address_head_populate{ false },
+    address_head_lock{ false },
 
     filter_bk_buckets{ 128 },
     filter_bk_size{ 1 },
@@ -111,7 +134,23 @@ settings::settings() NOEXCEPT
 
     filter_tx_buckets{ 128 },
     filter_tx_size{ 1 },
-    filter_tx_rate{ 50 }
+    filter_tx_rate{ 50 },
+
+    fee_bk_buckets{ 0 },
+    fee_bk_size{ 1 },
+    fee_bk_rate{ 50 },
+
+    summary_buckets{ 0 },
+    summary_size{ 1 },
+    summary_rate{ 50 },
+
+    touched_buckets{ 0 },
+    touched_size{ 1 },
+    touched_rate{ 50 },
+
+    activity_buckets{ 0 },
+    activity_size{ 1 },
+    activity_rate{ 50 }
 {
 }
 
@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/types/address_summary.hpp>
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+using namespace system;
+constexpr auto block_size = std::tuple_size_v<address_status::block_t>;
+constexpr auto length_size = sizeof(uint64_t);
+
+// local
+template <typename Bytes>
+inline void accumulate(address_status& status, const Bytes& bytes) NOEXCEPT
+{
+    auto used = status.size % block_size;
+    for (const auto byte: bytes)
+    {
+        status.buffer.at(used++) = static_cast<uint8_t>(byte);
+        if (used == block_size)
+        {
+            sha256::accumulate(status.state, status.buffer);
+            status.buffer = {};
+            used = zero;
+        }
+    }
+
+    status.size += bytes.size();
+}
+
+void address_status::write(const hash_digest& tx, size_t height) NOEXCEPT
+{
+    const auto at = height == history::unrooted_height ? std::string{ "-1" } :
+        std::to_string(height);
+
+    accumulate(*this, encode_hash(tx) + ":" + at + ":");
+}
+
+hash_digest address_status::finalize() const NOEXCEPT
+{
+    if (is_zero(size))
+        return {};
+
+    // Pad to the final length field with 0x80 followed by zeros.
+    const auto used = size % block_size;
+    const auto limit = block_size - length_size;
+    const auto pad = used < limit ? limit - used : block_size + limit - used;
+    std::string padding(pad, '\0');
+    padding.front() = '\x80';
+
+    // Copy retains the midstate for further extension.
+    auto copy = *this;
+    accumulate(copy, padding);
+    accumulate(copy, to_big_endian<uint64_t>(to_bits(size)));
+
+    hash_digest out{};
+    auto it = out.begin();
+    for (const auto word: copy.state)
+    {
+        const auto bytes = to_big_endian(word);
+        it = std::copy(bytes.begin(), bytes.end(), it);
+    }
+
+    return out;
+}
+
+} // namespace database
+} // namespace libbitcoin
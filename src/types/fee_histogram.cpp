@@ -0,0 +1,91 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include <bitcoin/database/types/fee_histogram.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <bitcoin/database/define.hpp>
+
+namespace libbitcoin {
+namespace database {
+
+using namespace system;
+
+uint32_t fee_histogram::to_rate(const fee_rate& rate) NOEXCEPT
+{
+    constexpr uint64_t thousand = 1'000;
+    if (is_zero(rate.bytes))
+        return max_uint32;
+
+    // Fee is bounded by money supply, so scaling cannot overflow.
+    const auto scaled = (rate.fee * thousand) / rate.bytes;
+    return limit<uint32_t>(scaled);
+}
+
+fee_histogram fee_histogram::from_rates(const fee_rates& rates) NOEXCEPT
+{
+    fee_histogram out{};
+    if (rates.empty())
+        return out;
+
+    std::vector<std::pair<uint32_t, size_t>> sorted{};
+    sorted.reserve(rates.size());
+    for (const auto& rate: rates)
+        sorted.emplace_back(to_rate(rate), rate.bytes);
+
+    std::sort(sorted.begin(), sorted.end());
+    out.minimum = sorted.front().first;
+    out.maximum = sorted.back().first;
+
+    size_t total{};
+    for (const auto& [rate, bytes]: sorted)
+    {
+        const auto bound = std::upper_bound(bounds.begin(), bounds.end(), rate);
+        auto& weight = out.weights.at(sub1(std::distance(bounds.begin(), bound)));
+        weight = limit<uint32_t>(ceilinged_add(size_t{ weight }, bytes));
+        total = ceilinged_add(total, bytes);
+    }
+
+    // Lowest rate at which at least half of the virtual bytes are included.
+    size_t cumulative{};
+    const auto half = to_half(total);
+    for (const auto& [rate, bytes]: sorted)
+    {
+        cumulative = ceilinged_add(cumulative, bytes);
+        if (cumulative >= half)
+        {
+            out.median = rate;
+            break;
+        }
+    }
+
+    return out;
+}
+
+bool fee_histogram::operator==(const fee_histogram& other) const NOEXCEPT
+{
+    return weights == other.weights
+        && minimum == other.minimum
+        && median == other.median
+        && maximum == other.maximum;
+}
+
+} // namespace database
+} // namespace libbitcoin
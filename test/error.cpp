@@ -315,6 +315,15 @@ BOOST_AUTO_TEST_CASE(error_t__code__fsync_failure__true_expected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "fsync failure");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__mlock_failure__true_expected_message)
+{
+    constexpr auto value = error::mlock_failure;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "mlock failure");
+}
+
 BOOST_AUTO_TEST_CASE(error_t__code__transactor_lock__true_expected_message)
 {
     constexpr auto value = error::transactor_lock;
@@ -423,6 +432,15 @@ BOOST_AUTO_TEST_CASE(error_t__code__unloaded_file__true_expected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "file not loaded");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__rehash_active__true_expected_message)
+{
+    constexpr auto value = error::rehash_active;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "rehash in progress");
+}
+
 BOOST_AUTO_TEST_CASE(error_t__code__create_table__true_expected_message)
 {
     constexpr auto value = error::create_table;
@@ -477,6 +495,15 @@ BOOST_AUTO_TEST_CASE(error_t__code__verify_table__true_expected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "failed to verify table");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__rehash_table__true_expected_message)
+{
+    constexpr auto value = error::rehash_table;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "failed to rehash table");
+}
+
 BOOST_AUTO_TEST_CASE(error_t__code__tx_connected__true_expected_message)
 {
     constexpr auto value = error::tx_connected;
@@ -668,6 +695,15 @@ BOOST_AUTO_TEST_CASE(error_t__code__tx_address_put__true_expected_message)
     BOOST_REQUIRE_EQUAL(ec.message(), "tx_address_put");
 }
 
+BOOST_AUTO_TEST_CASE(error_t__code__tx_spend_put__true_expected_message)
+{
+    constexpr auto value = error::tx_spend_put;
+    const auto ec = code(value);
+    BOOST_REQUIRE(ec);
+    BOOST_REQUIRE(ec == value);
+    BOOST_REQUIRE_EQUAL(ec.message(), "tx_spend_put");
+}
+
 BOOST_AUTO_TEST_CASE(error_t__code__tx_tx_commit__true_expected_message)
 {
     constexpr auto value = error::tx_tx_commit;
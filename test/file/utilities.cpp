@@ -231,6 +231,15 @@ BOOST_AUTO_TEST_CASE(file_utilities__copy__target_exists__false_both_exist)
     BOOST_REQUIRE(test::exists(TEST_PATH));
 }
 
+BOOST_AUTO_TEST_CASE(file_utilities__copy__target_missing__content_copied)
+{
+    const std::string target = TEST_PATH + "_";
+    const std::string text(4096 + 42, 'a');
+    BOOST_REQUIRE(test::create(TEST_PATH, text));
+    BOOST_REQUIRE(file::copy(TEST_PATH, target));
+    BOOST_REQUIRE_EQUAL(test::read_line(target), text);
+}
+
 // copy_directory
 
 BOOST_AUTO_TEST_CASE(file_utilities__copy_directory__missing__false)
@@ -275,6 +284,22 @@ BOOST_AUTO_TEST_CASE(file_utilities__copy_directory__target_missing__true_files_
     BOOST_REQUIRE(file::is_file(to_file));
 }
 
+BOOST_AUTO_TEST_CASE(file_utilities__copy_directory__subdirectories__true_nested_copied)
+{
+    const std::string from_dir = TEST_PATH + "_from";
+    const std::string to_dir = TEST_PATH + "_to";
+    BOOST_REQUIRE(file::create_directory(from_dir + "/sub/deep"));
+    BOOST_REQUIRE(file::create_directory(from_dir + "/empty"));
+    BOOST_REQUIRE(file::create_file(from_dir + "/file"));
+    BOOST_REQUIRE(file::create_file(from_dir + "/sub/file"));
+    BOOST_REQUIRE(file::create_file(from_dir + "/sub/deep/file"));
+    BOOST_REQUIRE(file::copy_directory(from_dir, to_dir));
+    BOOST_REQUIRE(file::is_file(to_dir + "/file"));
+    BOOST_REQUIRE(file::is_directory(to_dir + "/empty"));
+    BOOST_REQUIRE(file::is_file(to_dir + "/sub/file"));
+    BOOST_REQUIRE(file::is_file(to_dir + "/sub/deep/file"));
+}
+
 // open
 
 BOOST_AUTO_TEST_CASE(file_utilities__open__missing__failure)
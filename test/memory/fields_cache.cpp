@@ -0,0 +1,115 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(fields_cache_tests)
+
+using namespace system;
+using header = linkage<3>;
+using cache = fields_cache<header>;
+
+BOOST_AUTO_TEST_CASE(fields_cache__construct__disabled__not_cached)
+{
+    cache instance{ false };
+    BOOST_REQUIRE(!instance.enabled());
+    instance.push(7u, 0u, { 1u, 2u, 3u, 4u });
+    BOOST_REQUIRE_EQUAL(instance.count(), 0u);
+
+    uint32_t timestamp{};
+    BOOST_REQUIRE(!instance.get_timestamp(timestamp, 0u, 0u));
+}
+
+BOOST_AUTO_TEST_CASE(fields_cache__push__heights__expected_columns)
+{
+    cache instance{ true };
+    BOOST_REQUIRE(instance.enabled());
+    instance.push(10u, 0u, { 1u, 100u, 1000u, 10000u });
+    instance.push(11u, 1u, { 2u, 200u, 2000u, 20000u });
+    instance.push(12u, 2u, { 3u, 300u, 3000u, 30000u });
+    BOOST_REQUIRE_EQUAL(instance.count(), 3u);
+
+    std::vector<uint32_t> out(2);
+    BOOST_REQUIRE(instance.get_versions(out.begin(), 2u, 2u));
+    BOOST_REQUIRE_EQUAL(out.at(0), 2u);
+    BOOST_REQUIRE_EQUAL(out.at(1), 3u);
+    BOOST_REQUIRE(instance.get_timestamps(out.begin(), 2u, 1u));
+    BOOST_REQUIRE_EQUAL(out.at(0), 100u);
+    BOOST_REQUIRE_EQUAL(out.at(1), 200u);
+    BOOST_REQUIRE(instance.get_bits(out.begin(), 1u, 0u));
+    BOOST_REQUIRE_EQUAL(out.at(0), 1000u);
+    BOOST_REQUIRE(instance.get_mtps(out.begin(), 2u, 2u, 12u));
+    BOOST_REQUIRE_EQUAL(out.at(0), 20000u);
+    BOOST_REQUIRE_EQUAL(out.at(1), 30000u);
+
+    // Beyond height zero, above count, or not the candidate at height.
+    BOOST_REQUIRE(!instance.get_bits(out.begin(), 2u, 0u));
+    BOOST_REQUIRE(!instance.get_bits(out.begin(), 1u, 3u));
+    BOOST_REQUIRE(!instance.get_bits(out.begin(), 1u, 2u, 11u));
+
+    uint32_t timestamp{};
+    BOOST_REQUIRE(instance.get_timestamp(timestamp, 0u, 2u, 12u));
+    BOOST_REQUIRE_EQUAL(timestamp, 100u);
+    BOOST_REQUIRE(!instance.get_timestamp(timestamp, 0u, 2u, 11u));
+    BOOST_REQUIRE(!instance.get_timestamp(timestamp, 3u, 2u));
+}
+
+BOOST_AUTO_TEST_CASE(fields_cache__push__gap__not_cached)
+{
+    cache instance{ true };
+    instance.push(10u, 1u, { 1u, 2u, 3u, 4u });
+    BOOST_REQUIRE_EQUAL(instance.count(), 0u);
+
+    instance.push(10u, 0u, { 1u, 2u, 3u, 4u });
+    instance.push(11u, 0u, { 5u, 6u, 7u, 8u });
+    BOOST_REQUIRE_EQUAL(instance.count(), 1u);
+
+    uint32_t timestamp{};
+    BOOST_REQUIRE(instance.get_timestamp(timestamp, 0u, 0u, 10u));
+    BOOST_REQUIRE_EQUAL(timestamp, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(fields_cache__pop__height__truncated)
+{
+    cache instance{ true };
+    instance.push(10u, 0u, { 1u, 100u, 1000u, 10000u });
+    instance.push(11u, 1u, { 2u, 200u, 2000u, 20000u });
+    instance.pop(5u);
+    BOOST_REQUIRE_EQUAL(instance.count(), 2u);
+    instance.pop(1u);
+    BOOST_REQUIRE_EQUAL(instance.count(), 1u);
+
+    uint32_t timestamp{};
+    BOOST_REQUIRE(!instance.get_timestamp(timestamp, 1u, 1u));
+    instance.push(12u, 1u, { 3u, 300u, 3000u, 30000u });
+    BOOST_REQUIRE(instance.get_timestamp(timestamp, 1u, 1u, 12u));
+    BOOST_REQUIRE_EQUAL(timestamp, 300u);
+}
+
+BOOST_AUTO_TEST_CASE(fields_cache__clear__cached__not_cached)
+{
+    cache instance{ true };
+    instance.push(10u, 0u, { 1u, 2u, 3u, 4u });
+    instance.clear();
+    BOOST_REQUIRE_EQUAL(instance.count(), 0u);
+
+    uint32_t timestamp{};
+    BOOST_REQUIRE(!instance.get_timestamp(timestamp, 0u, 0u));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
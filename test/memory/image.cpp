@@ -0,0 +1,79 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(image_tests, test::directory_setup_fixture)
+
+BOOST_AUTO_TEST_CASE(image__dump__full__created)
+{
+    const std::string file = TEST_PATH;
+    const image instance{ .size = 3, .data = { 'a', 'b', 'c' } };
+    BOOST_REQUIRE(!instance.dump(file));
+    BOOST_REQUIRE_EQUAL(test::read_line(file), "abc");
+}
+
+BOOST_AUTO_TEST_CASE(image__dump__full_exists__replaced)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file, "abcdef"));
+    const image instance{ .size = 3, .data = { 'a', 'b', 'c' } };
+    BOOST_REQUIRE(!instance.dump(file));
+    BOOST_REQUIRE_EQUAL(test::read_line(file), "abc");
+}
+
+BOOST_AUTO_TEST_CASE(image__dump__staged__moved)
+{
+    const std::string file = TEST_PATH;
+    const std::string staged = file + "_staged";
+    BOOST_REQUIRE(test::create(file, "abcdef"));
+    BOOST_REQUIRE(test::create(staged, "xyz"));
+    const image instance{ .size = 3, .staged = staged };
+    BOOST_REQUIRE(!instance.dump(file));
+    BOOST_REQUIRE(!test::exists(staged));
+    BOOST_REQUIRE_EQUAL(test::read_line(file), "xyz");
+}
+
+BOOST_AUTO_TEST_CASE(image__dump__patch_missing__error)
+{
+    const std::string file = TEST_PATH;
+    const image instance{ .patch = true, .size = 3, .page = 1 };
+    BOOST_REQUIRE(instance.dump(file));
+}
+
+#if !defined(HAVE_MSC)
+BOOST_AUTO_TEST_CASE(image__dump__patch__pages_written)
+{
+    const std::string file = TEST_PATH;
+    const image full{ .size = 4, .data = { 'a', 'b', 'c', 'd' } };
+    BOOST_REQUIRE(!full.dump(file));
+
+    const image patch
+    {
+        .patch = true,
+        .size = 4,
+        .page = 1,
+        .pages = { 1, 3 },
+        .data = { 'x', 'y' }
+    };
+    BOOST_REQUIRE(!patch.dump(file));
+    BOOST_REQUIRE_EQUAL(test::read_line(file), "axcy");
+}
+#endif
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -197,6 +197,62 @@ BOOST_AUTO_TEST_CASE(mmap__load__loaded__load_loaded)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(mmap__load__huge_populate_options__true)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file, 1, 0, true, { true, true, false });
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_NE(instance.allocate(100), storage::eof);
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+#if !defined(HAVE_MSC)
+BOOST_AUTO_TEST_CASE(mmap__allocate__reserved_held_access__base_unchanged)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file, 1, 0, true, { .reserve = 1'000'000 });
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(1), zero);
+
+    auto memory = instance.get();
+    BOOST_REQUIRE(memory);
+    memory->begin()[0] = 42;
+
+    // Growth within the reservation does not wait on the held accessor.
+    BOOST_REQUIRE_EQUAL(instance.allocate(100'000), 1u);
+    BOOST_REQUIRE_EQUAL(instance.size(), 100'001u);
+
+    auto grown = instance.get();
+    BOOST_REQUIRE(grown);
+    BOOST_REQUIRE_EQUAL(grown->begin(), memory->begin());
+    BOOST_REQUIRE_EQUAL(grown->begin()[0], 42u);
+    grown->begin()[100'000] = 24;
+    memory.reset();
+    grown.reset();
+
+    // Growth beyond the reservation remaps (and reserves anew).
+    BOOST_REQUIRE_EQUAL(instance.allocate(3'000'000), 100'001u);
+    auto remapped = instance.get();
+    BOOST_REQUIRE(remapped);
+    BOOST_REQUIRE_EQUAL(remapped->begin()[0], 42u);
+    BOOST_REQUIRE_EQUAL(remapped->begin()[100'000], 24u);
+    remapped.reset();
+
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE_EQUAL(std::filesystem::file_size(file), 3'100'001u);
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+#endif
+
 BOOST_AUTO_TEST_CASE(mmap__unload__unloaded__true)
 {
     const std::string file = TEST_PATH;
@@ -758,6 +814,242 @@ BOOST_AUTO_TEST_CASE(mmap__flush__loaded__true)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(mmap__flush_appended__unloaded__flush_unloaded)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE_EQUAL(instance.flush_appended(), error::flush_unloaded);
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(mmap__flush_appended__clean_and_appended__true)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE(!instance.flush_appended());
+    BOOST_REQUIRE_NE(instance.allocate(42), storage::eof);
+    BOOST_REQUIRE(!instance.flush_appended());
+    BOOST_REQUIRE(instance.truncate(10));
+    BOOST_REQUIRE(!instance.flush_appended());
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(mmap__writeback__unloaded__flush_unloaded)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE_EQUAL(instance.writeback(one), error::flush_unloaded);
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(mmap__writeback__appended__true)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE(!instance.writeback(one));
+    BOOST_REQUIRE_EQUAL(instance.written(), zero);
+    BOOST_REQUIRE_NE(instance.allocate(42), storage::eof);
+
+    // Below threshold is deferred.
+    BOOST_REQUIRE(!instance.writeback(100));
+    BOOST_REQUIRE_EQUAL(instance.written(), zero);
+
+    // Initiated writeback advances, and then none remains.
+    BOOST_REQUIRE(!instance.writeback(one));
+    BOOST_REQUIRE_EQUAL(instance.written(), 42u);
+    BOOST_REQUIRE(!instance.writeback(one));
+    BOOST_REQUIRE_EQUAL(instance.written(), 42u);
+
+    // Truncation retreats, and then none remains.
+    BOOST_REQUIRE(instance.truncate(10));
+    BOOST_REQUIRE_EQUAL(instance.written(), 10u);
+    BOOST_REQUIRE(!instance.writeback(one));
+    BOOST_REQUIRE_EQUAL(instance.written(), 10u);
+    BOOST_REQUIRE_NE(instance.allocate(5), storage::eof);
+    BOOST_REQUIRE(!instance.flush());
+    BOOST_REQUIRE_EQUAL(instance.written(), 15u);
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(mmap__dump__since_generation__marked_pages_only)
+{
+    constexpr size_t page = 4096;
+    const std::string file = TEST_PATH;
+    const std::string copy = file + "_dump";
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file, two * page);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.generation(), one);
+    BOOST_REQUIRE_NE(instance.allocate(two * page), storage::eof);
+
+    auto memory = instance.get();
+    BOOST_REQUIRE(memory);
+    std::fill_n(memory->begin(), page, 'a');
+    std::fill_n(std::next(memory->begin(), page), page, 'b');
+    memory.reset();
+
+    // Full dump at generation one.
+    BOOST_REQUIRE(!instance.dump(copy, zero));
+    instance.advance();
+    BOOST_REQUIRE_EQUAL(instance.generation(), two);
+
+    // Unmarked first page change is not patched, marked second page is.
+    memory = instance.get();
+    BOOST_REQUIRE(memory);
+    std::fill_n(memory->begin(), page, 'c');
+    std::fill_n(std::next(memory->begin(), page), page, 'd');
+    instance.mark(page, page);
+    memory.reset();
+
+    BOOST_REQUIRE(!instance.dump(copy, one));
+    const auto dumped = test::read_line(copy);
+    BOOST_REQUIRE_EQUAL(dumped.size(), two * page);
+    BOOST_REQUIRE_EQUAL(dumped.front(), 'a');
+    BOOST_REQUIRE_EQUAL(dumped.back(), 'd');
+
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(mmap__capture__unloaded__unloaded_file)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file);
+    BOOST_REQUIRE(!instance.open());
+
+    image out{};
+    BOOST_REQUIRE_EQUAL(instance.capture(out, file + "_dump", zero),
+        error::unloaded_file);
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(mmap__capture__since_generation__marked_pages_as_of_capture)
+{
+    constexpr size_t page = 4096;
+    const std::string file = TEST_PATH;
+    const std::string copy = file + "_dump";
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file, two * page);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_NE(instance.allocate(two * page), storage::eof);
+
+    auto memory = instance.get();
+    BOOST_REQUIRE(memory);
+    std::fill_n(memory->begin(), page, 'a');
+    std::fill_n(std::next(memory->begin(), page), page, 'b');
+    memory.reset();
+
+    // Full capture at generation one (no prior dump).
+    image full{};
+    BOOST_REQUIRE(!instance.capture(full, copy, one));
+    BOOST_REQUIRE(!full.patch);
+    BOOST_REQUIRE_EQUAL(full.data.size(), two * page);
+    BOOST_REQUIRE(!full.dump(copy));
+    instance.advance();
+
+    // Marked second page is captured as a patch.
+    memory = instance.get();
+    BOOST_REQUIRE(memory);
+    std::fill_n(memory->begin(), page, 'c');
+    std::fill_n(std::next(memory->begin(), page), page, 'd');
+    instance.mark(page, page);
+
+    image patch{};
+    BOOST_REQUIRE(!instance.capture(patch, copy, one));
+    BOOST_REQUIRE(patch.patch);
+    BOOST_REQUIRE_EQUAL(patch.pages.size(), one);
+    BOOST_REQUIRE_EQUAL(patch.pages.front(), one);
+    BOOST_REQUIRE_EQUAL(patch.data.size(), page);
+
+    // Writes after capture are not dumped.
+    std::fill_n(std::next(memory->begin(), page), page, 'e');
+    memory.reset();
+
+    BOOST_REQUIRE(!patch.dump(copy));
+    const auto dumped = test::read_line(copy);
+    BOOST_REQUIRE_EQUAL(dumped.size(), two * page);
+    BOOST_REQUIRE_EQUAL(dumped.front(), 'a');
+    BOOST_REQUIRE_EQUAL(dumped.back(), 'd');
+
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(mmap__capture__over_limit__staged_full)
+{
+    constexpr size_t page = 4096;
+    const std::string file = TEST_PATH;
+    const std::string copy = file + "_dump";
+    const std::string staged = file + "_staged";
+    BOOST_REQUIRE(test::create(file));
+
+    map instance(file, two * page);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_NE(instance.allocate(two * page), storage::eof);
+
+    auto memory = instance.get();
+    BOOST_REQUIRE(memory);
+    std::fill_n(memory->begin(), page, 'a');
+    std::fill_n(std::next(memory->begin(), page), page, 'b');
+    memory.reset();
+
+    // Within limit is captured to memory.
+    image within{};
+    BOOST_REQUIRE(!instance.capture(within, copy, zero, two * page, staged));
+    BOOST_REQUIRE(within.staged.empty());
+    BOOST_REQUIRE_EQUAL(within.data.size(), two * page);
+    BOOST_REQUIRE(!test::exists(staged));
+
+    // Over limit is dumped to staged file, and moved by deferred dump.
+    image over{};
+    BOOST_REQUIRE(!instance.capture(over, copy, zero, page, staged));
+    BOOST_REQUIRE(!over.patch);
+    BOOST_REQUIRE(over.data.empty());
+    BOOST_REQUIRE_EQUAL(over.staged, staged);
+    BOOST_REQUIRE(test::exists(staged));
+
+    BOOST_REQUIRE(!over.dump(copy));
+    BOOST_REQUIRE(!test::exists(staged));
+    const auto dumped = test::read_line(copy);
+    BOOST_REQUIRE_EQUAL(dumped.size(), two * page);
+    BOOST_REQUIRE_EQUAL(dumped.front(), 'a');
+    BOOST_REQUIRE_EQUAL(dumped.back(), 'b');
+
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_CASE(mmap__write__read__expected)
 {
     constexpr uint64_t expected = 0x0102030405060708_u64;
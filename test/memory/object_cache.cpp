@@ -0,0 +1,116 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(object_cache_tests)
+
+using namespace system;
+using link = linkage<4>;
+using cache = object_cache<link, uint32_t>;
+
+BOOST_AUTO_TEST_CASE(object_cache__construct__zero_capacity__disabled)
+{
+    cache instance{ 0 };
+    BOOST_REQUIRE(!instance.enabled());
+    instance.put(42u, std::make_shared<const uint32_t>(42u));
+    BOOST_REQUIRE(!instance.get(42u));
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.hits(), 0u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(object_cache__get__put__same_object)
+{
+    cache instance{ 8, 2 };
+    BOOST_REQUIRE(instance.enabled());
+    BOOST_REQUIRE(!instance.get(42u));
+
+    const auto object = std::make_shared<const uint32_t>(42u);
+    instance.put(42u, object);
+    BOOST_REQUIRE_EQUAL(instance.get(42u), object);
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(object_cache__put__full_shard__evicts_oldest)
+{
+    // One shard of two objects.
+    cache instance{ 2, 1 };
+    instance.put(1u, std::make_shared<const uint32_t>(1u));
+    instance.put(2u, std::make_shared<const uint32_t>(2u));
+    instance.put(3u, std::make_shared<const uint32_t>(3u));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(!instance.get(1u));
+    BOOST_REQUIRE_EQUAL(*instance.get(2u), 2u);
+    BOOST_REQUIRE_EQUAL(*instance.get(3u), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(object_cache__erase__cached__removed)
+{
+    cache instance{ 2, 1 };
+    instance.put(1u, std::make_shared<const uint32_t>(1u));
+    instance.put(2u, std::make_shared<const uint32_t>(2u));
+    instance.erase(1u);
+    BOOST_REQUIRE(!instance.get(1u));
+    BOOST_REQUIRE_EQUAL(instance.size(), 1u);
+
+    // Erasure and reinsertion do not exceed capacity.
+    for (uint32_t value{}; value < 10u; ++value)
+    {
+        instance.put(value, std::make_shared<const uint32_t>(value));
+        instance.erase(value);
+        instance.put(value, std::make_shared<const uint32_t>(value));
+    }
+
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE_EQUAL(*instance.get(8u), 8u);
+    BOOST_REQUIRE_EQUAL(*instance.get(9u), 9u);
+}
+
+BOOST_AUTO_TEST_CASE(object_cache__erase__reinserted__evicted_by_reinsertion_order)
+{
+    cache instance{ 2, 1 };
+    instance.put(1u, std::make_shared<const uint32_t>(1u));
+    instance.put(2u, std::make_shared<const uint32_t>(2u));
+    instance.erase(1u);
+    instance.put(1u, std::make_shared<const uint32_t>(1u));
+
+    // Reinserted 1 is newer than 2, so 2 is evicted.
+    instance.put(3u, std::make_shared<const uint32_t>(3u));
+    BOOST_REQUIRE_EQUAL(instance.size(), 2u);
+    BOOST_REQUIRE(!instance.get(2u));
+    BOOST_REQUIRE_EQUAL(*instance.get(1u), 1u);
+    BOOST_REQUIRE_EQUAL(*instance.get(3u), 3u);
+}
+
+BOOST_AUTO_TEST_CASE(object_cache__clear__populated__empty_counters_retained)
+{
+    cache instance{ 16 };
+    instance.put(1u, std::make_shared<const uint32_t>(1u));
+    instance.put(2u, std::make_shared<const uint32_t>(2u));
+    BOOST_REQUIRE(instance.get(1u));
+    instance.clear();
+    BOOST_REQUIRE_EQUAL(instance.size(), 0u);
+    BOOST_REQUIRE(!instance.get(2u));
+    BOOST_REQUIRE_EQUAL(instance.hits(), 1u);
+    BOOST_REQUIRE_EQUAL(instance.misses(), 1u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,114 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../mocks/map_store.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(pool_tests, test::directory_setup_fixture)
+
+using pool_t = database::pool<one>;
+constexpr auto chunk = pool_t::chunk;
+
+BOOST_AUTO_TEST_CASE(pool__get__loaded__pinned_resident)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    pool_t instance(file);
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(two * chunk), zero);
+    BOOST_REQUIRE_EQUAL(instance.resident(), zero);
+
+    auto memory = instance.get(add1(chunk));
+    BOOST_REQUIRE(memory);
+    BOOST_REQUIRE_EQUAL(instance.resident(), one);
+    BOOST_REQUIRE_EQUAL(instance.pinned(), one);
+    BOOST_REQUIRE_EQUAL(system::to_unsigned(memory->size()), sub1(chunk));
+
+    memory->begin()[0] = 42;
+    memory.reset();
+    BOOST_REQUIRE_EQUAL(instance.pinned(), zero);
+    BOOST_REQUIRE_EQUAL(instance.get(add1(chunk))->begin()[0], 42u);
+
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE_EQUAL(instance.resident(), zero);
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(pool__get__over_budget__unpinned_evicted)
+{
+    const std::string file = TEST_PATH;
+    BOOST_REQUIRE(test::create(file));
+
+    pool_t instance(file, 1, 0, false, { .resident = two * chunk });
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(4u * chunk), zero);
+
+    // Pinned chunk zero is not evicted while over budget.
+    const auto pinned = instance.get(zero);
+    BOOST_REQUIRE(pinned);
+    pinned->begin()[0] = 42;
+    BOOST_REQUIRE(instance.get(chunk));
+    BOOST_REQUIRE(instance.get(two * chunk));
+    BOOST_REQUIRE(instance.get(3u * chunk));
+    BOOST_REQUIRE_EQUAL(instance.resident(), two);
+    BOOST_REQUIRE_EQUAL(instance.pinned(), one);
+    BOOST_REQUIRE_EQUAL(pinned->begin()[0], 42u);
+
+    // Evicted chunks remain addressable (residency is advisory).
+    BOOST_REQUIRE(instance.get(chunk));
+    BOOST_REQUIRE_EQUAL(instance.get(zero)->begin()[0], 42u);
+
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(pool__get__aggregate__column_tracked)
+{
+    using aggregate = database::pool<1, 3>;
+    const std::string file = TEST_PATH;
+    const aggregate::paths files{ file + "_0", file + "_1" };
+
+    aggregate instance(files);
+    BOOST_REQUIRE(!instance.create());
+    BOOST_REQUIRE(!instance.open());
+    BOOST_REQUIRE(!instance.load());
+    BOOST_REQUIRE_EQUAL(instance.allocate(chunk), zero);
+    BOOST_REQUIRE(instance.get_at(1, two * chunk));
+    BOOST_REQUIRE_EQUAL(instance.resident(0), zero);
+    BOOST_REQUIRE_EQUAL(instance.resident(1), one);
+    BOOST_REQUIRE(!instance.get_at(2));
+    BOOST_REQUIRE(!instance.unload());
+    BOOST_REQUIRE(!instance.close());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(pool__store__create_close__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<database::pool> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
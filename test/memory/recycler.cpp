@@ -0,0 +1,64 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(recycler_tests)
+
+using access = accessor<std::shared_mutex>;
+
+BOOST_AUTO_TEST_CASE(recycler__allocate__deallocated__recycled)
+{
+    recycler<uint64_t> allocator{};
+    const auto first = allocator.allocate(1);
+    BOOST_REQUIRE(!is_null(first));
+    allocator.deallocate(first, 1);
+    const auto second = allocator.allocate(1);
+    BOOST_REQUIRE_EQUAL(first, second);
+    allocator.deallocate(second, 1);
+}
+
+BOOST_AUTO_TEST_CASE(recycler__allocate__multiple__not_recycled)
+{
+    recycler<uint64_t> allocator{};
+    const auto block = allocator.allocate(3);
+    BOOST_REQUIRE(!is_null(block));
+    block[2] = 42;
+    allocator.deallocate(block, 3);
+}
+
+BOOST_AUTO_TEST_CASE(recycler__allocate_shared__accessor__recycled_and_locked)
+{
+    std::shared_mutex mutex;
+    auto ptr = std::allocate_shared<access>(recycler<access>{}, mutex);
+    const auto address = ptr.get();
+    BOOST_REQUIRE(!mutex.try_lock());
+    ptr.reset();
+    BOOST_REQUIRE(mutex.try_lock());
+    mutex.unlock();
+
+    ptr = std::allocate_shared<access>(recycler<access>{}, mutex);
+    BOOST_REQUIRE_EQUAL(ptr.get(), address);
+}
+
+BOOST_AUTO_TEST_CASE(recycler__equality__any__true)
+{
+    BOOST_REQUIRE(recycler<uint64_t>{} == recycler<access>{});
+}
+
+BOOST_AUTO_TEST_SUITE_END()
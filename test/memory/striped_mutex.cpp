@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(striped_mutex_tests)
+
+BOOST_AUTO_TEST_CASE(striped_mutex__try_lock__unlocked__true)
+{
+    striped_mutex mutex;
+    BOOST_REQUIRE(mutex.try_lock());
+    BOOST_REQUIRE(!mutex.try_lock());
+    BOOST_REQUIRE(!mutex.try_lock_shared());
+    mutex.unlock();
+    BOOST_REQUIRE(mutex.try_lock_shared());
+    mutex.unlock_shared();
+}
+
+BOOST_AUTO_TEST_CASE(striped_mutex__try_lock__shared__false)
+{
+    striped_mutex mutex;
+    mutex.lock_shared();
+    mutex.lock_shared();
+    BOOST_REQUIRE(!mutex.try_lock());
+    mutex.unlock_shared();
+    BOOST_REQUIRE(!mutex.try_lock());
+    mutex.unlock_shared();
+    BOOST_REQUIRE(mutex.try_lock());
+    mutex.unlock();
+}
+
+BOOST_AUTO_TEST_CASE(striped_mutex__unlock_shared__other_thread__released)
+{
+    striped_mutex mutex;
+    mutex.lock_shared();
+    std::thread([&]() NOEXCEPT { mutex.unlock_shared(); }).join();
+    BOOST_REQUIRE(mutex.try_lock());
+    mutex.unlock();
+}
+
+BOOST_AUTO_TEST_CASE(striped_mutex__lock__shared_released__acquired)
+{
+    striped_mutex mutex;
+    std::shared_lock reader{ mutex };
+    std::atomic_bool locked{};
+    std::thread writer([&]() NOEXCEPT
+    {
+        std::unique_lock lock{ mutex };
+        locked = true;
+    });
+
+    BOOST_REQUIRE(!locked);
+    reader.unlock();
+    writer.join();
+    BOOST_REQUIRE(locked);
+}
+
+BOOST_AUTO_TEST_CASE(striped_mutex__accessor__destruct__shared_lock_released)
+{
+    striped_mutex mutex;
+    auto access = std::make_shared<accessor<striped_mutex>>(mutex);
+    BOOST_REQUIRE(!mutex.try_lock());
+    access.reset();
+    BOOST_REQUIRE(mutex.try_lock());
+    mutex.unlock();
+}
+
+BOOST_AUTO_TEST_SUITE_END()
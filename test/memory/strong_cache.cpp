@@ -0,0 +1,89 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(strong_cache_tests)
+
+using namespace system;
+using tx = linkage<4>;
+using header = linkage<3>;
+using cache = strong_cache<tx, header>;
+
+BOOST_AUTO_TEST_CASE(strong_cache__construct__disabled__not_cached)
+{
+    cache instance{ false };
+    BOOST_REQUIRE(!instance.enabled());
+    instance.set_block(7u, 42u, 43u);
+    instance.set(1u, 2u, 7u, true);
+
+    uint32_t height{};
+    uint32_t mtp{};
+    BOOST_REQUIRE(!instance.get(height, mtp, 1u));
+}
+
+BOOST_AUTO_TEST_CASE(strong_cache__get__set__expected)
+{
+    cache instance{ true };
+    BOOST_REQUIRE(instance.enabled());
+
+    uint32_t height{};
+    uint32_t mtp{};
+    BOOST_REQUIRE(!instance.get(height, mtp, 1u));
+
+    instance.set_block(7u, 42u, 43u);
+    instance.set(1u, 2u, 7u, true);
+    BOOST_REQUIRE(!instance.get(height, mtp, 0u));
+    BOOST_REQUIRE(instance.get(height, mtp, 1u));
+    BOOST_REQUIRE_EQUAL(height, 42u);
+    BOOST_REQUIRE_EQUAL(mtp, 43u);
+    BOOST_REQUIRE(instance.get(height, mtp, 2u));
+    BOOST_REQUIRE_EQUAL(height, 42u);
+    BOOST_REQUIRE_EQUAL(mtp, 43u);
+    BOOST_REQUIRE(!instance.get(height, mtp, 3u));
+    BOOST_REQUIRE(!instance.get(height, mtp, 1000u));
+}
+
+BOOST_AUTO_TEST_CASE(strong_cache__set__negative__not_cached)
+{
+    cache instance{ true };
+    instance.set_block(0u, 1u, 2u);
+    instance.set(5u, 3u, 0u, true);
+    instance.set(6u, 1u, 0u, false);
+
+    uint32_t height{};
+    uint32_t mtp{};
+    BOOST_REQUIRE(instance.get(height, mtp, 5u));
+    BOOST_REQUIRE(!instance.get(height, mtp, 6u));
+    BOOST_REQUIRE(instance.get(height, mtp, 7u));
+}
+
+BOOST_AUTO_TEST_CASE(strong_cache__clear__cached__not_cached)
+{
+    cache instance{ true };
+    instance.reserve(10, 10);
+    instance.set_block(3u, 1u, 2u);
+    instance.set(4u, 1u, 3u, true);
+    instance.clear();
+
+    uint32_t height{};
+    uint32_t mtp{};
+    BOOST_REQUIRE(!instance.get(height, mtp, 4u));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,130 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(wire_iov_tests)
+
+using namespace system;
+using access = accessor<std::shared_mutex>;
+
+BOOST_AUTO_TEST_CASE(wire_iov__construct__default__empty)
+{
+    const wire_iov instance{};
+    BOOST_REQUIRE(instance.get_segments().empty());
+    BOOST_REQUIRE(instance.to_data().empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), zero);
+}
+
+BOOST_AUTO_TEST_CASE(wire_iov__pin__held__blocks_exclusive_until_clear)
+{
+    data_chunk chunk{ 0x00 };
+    std::shared_mutex mutex;
+    auto memory = std::make_shared<access>(mutex);
+    memory->assign(chunk.data(), std::next(chunk.data(), chunk.size()));
+
+    wire_iov instance{};
+    instance.pin(memory);
+    memory.reset();
+    BOOST_REQUIRE(!mutex.try_lock());
+    instance.clear();
+    BOOST_REQUIRE(mutex.try_lock());
+    mutex.unlock();
+}
+
+BOOST_AUTO_TEST_CASE(wire_iov__append__out_of_bounds__false)
+{
+    data_chunk chunk{ 0x01, 0x02, 0x03 };
+    std::shared_mutex mutex;
+    const auto memory = std::make_shared<access>(mutex);
+    memory->assign(chunk.data(), std::next(chunk.data(), chunk.size()));
+
+    wire_iov instance{};
+    BOOST_REQUIRE(!instance.append(nullptr, 0, 1));
+    BOOST_REQUIRE(!instance.append(memory, 2, 2));
+    BOOST_REQUIRE(!instance.append(memory, 4, 0));
+    BOOST_REQUIRE(instance.append(memory, 3, 0));
+    BOOST_REQUIRE(instance.get_segments().empty());
+}
+
+BOOST_AUTO_TEST_CASE(wire_iov__append__contiguous__merged_into_memory)
+{
+    data_chunk chunk{ 0x01, 0x02, 0x03, 0x04 };
+    std::shared_mutex mutex;
+    const auto memory = std::make_shared<access>(mutex);
+    memory->assign(chunk.data(), std::next(chunk.data(), chunk.size()));
+
+    wire_iov instance{};
+    BOOST_REQUIRE(instance.append(memory, 0, 2));
+    BOOST_REQUIRE(instance.append(memory, 2, 1));
+    instance.finalize();
+
+    const auto& segments = instance.get_segments();
+    BOOST_REQUIRE_EQUAL(segments.size(), one);
+    BOOST_REQUIRE_EQUAL(segments.front().first, chunk.data());
+    BOOST_REQUIRE_EQUAL(segments.front().second, 3u);
+    BOOST_REQUIRE_EQUAL(instance.to_data(), (data_chunk{ 0x01, 0x02, 0x03 }));
+}
+
+BOOST_AUTO_TEST_CASE(wire_iov__synthesize__interleaved__expected_segments)
+{
+    data_chunk chunk{ 0x01, 0x02, 0x03, 0x04 };
+    std::shared_mutex mutex;
+    const auto memory = std::make_shared<access>(mutex);
+    memory->assign(chunk.data(), std::next(chunk.data(), chunk.size()));
+
+    wire_iov instance{};
+    BOOST_REQUIRE(instance.synthesize(4, [](bytewriter& sink) NOEXCEPT
+    {
+        sink.write_2_bytes_little_endian(0xbbaa);
+        return true;
+    }));
+    BOOST_REQUIRE(instance.synthesize(9, [](bytewriter& sink) NOEXCEPT
+    {
+        sink.write_variable(0xfd);
+        return true;
+    }));
+    BOOST_REQUIRE(instance.append(memory, 1, 2));
+    BOOST_REQUIRE(instance.synthesize(1, [](bytewriter& sink) NOEXCEPT
+    {
+        sink.write_byte(0xcc);
+        return true;
+    }));
+    instance.finalize();
+
+    const data_chunk expected{ 0xaa, 0xbb, 0xfd, 0xfd, 0x00, 0x02, 0x03, 0xcc };
+    BOOST_REQUIRE_EQUAL(instance.get_segments().size(), 3u);
+    BOOST_REQUIRE_EQUAL(instance.get_segments().at(1).first, std::next(chunk.data()));
+    BOOST_REQUIRE_EQUAL(instance.size(), expected.size());
+    BOOST_REQUIRE_EQUAL(instance.to_data(), expected);
+}
+
+BOOST_AUTO_TEST_CASE(wire_iov__synthesize__writer_false__false_empty)
+{
+    wire_iov instance{};
+    BOOST_REQUIRE(!instance.synthesize(4, [](bytewriter& sink) NOEXCEPT
+    {
+        sink.write_byte(0xaa);
+        return false;
+    }));
+    instance.finalize();
+    BOOST_REQUIRE(instance.get_segments().empty());
+    BOOST_REQUIRE_EQUAL(instance.size(), zero);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
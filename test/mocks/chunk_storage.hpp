@@ -69,8 +69,8 @@ public:
     {
     }
 
-    chunk_storages(const path& filename, size_t=1, size_t=0, bool=true) NOEXCEPT
-        requires (is_one(columns))
+    chunk_storages(const path& filename, size_t=1, size_t=0, bool=true,
+        const map_options& ={}) NOEXCEPT requires (is_one(columns))
       : alias_{}, paths_{ filename }, logical_{}
     {
     }
@@ -133,6 +133,16 @@ public:
         return error::success;
     }
 
+    code flush_appended() NOEXCEPT override
+    {
+        return error::success;
+    }
+
+    code writeback(size_t) NOEXCEPT override
+    {
+        return error::success;
+    }
+
     code unload() NOEXCEPT override
     {
         return error::success;
@@ -148,6 +158,30 @@ public:
         return error::success;
     }
 
+    code dump(const path&, size_t) const NOEXCEPT override
+    {
+        return error::success;
+    }
+
+    code capture(image&, const path&, size_t, size_t=max_size_t,
+        const path& ={}) const NOEXCEPT override
+    {
+        return error::success;
+    }
+
+    void mark(size_t, size_t=one) NOEXCEPT override
+    {
+    }
+
+    size_t generation() const NOEXCEPT override
+    {
+        return {};
+    }
+
+    void advance() NOEXCEPT override
+    {
+    }
+
     const path& file() const NOEXCEPT override
     {
         return paths_[0];
@@ -249,6 +283,18 @@ public:
         return ptr;
     }
 
+    memory_ptr get_exclusive() const NOEXCEPT override
+    {
+        using namespace system;
+        using exclusive = accessor<std::shared_mutex,
+            std::unique_lock<std::shared_mutex>>;
+        auto data = at(zero).data();
+        const auto allocated = size() * widths.at(zero);
+        const auto ptr = emplace_shared<exclusive>(map_mutex_);
+        ptr->assign(data, std::next(data, allocated));
+        return ptr;
+    }
+
     memory::iterator get_raw(size_t offset=zero) const NOEXCEPT override
     {
         return std::next(at(zero).data(), offset);
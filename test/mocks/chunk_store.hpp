@@ -93,6 +93,16 @@ public:
         return outs_body_.buffer();
     }
 
+    system::data_chunk& spend_head() NOEXCEPT
+    {
+        return spend_head_.buffer();
+    }
+
+    system::data_chunk& spend_body() NOEXCEPT
+    {
+        return spend_body_.buffer();
+    }
+
     system::data_chunk& tx_head() NOEXCEPT
     {
         return tx_head_.buffer();
@@ -267,6 +277,16 @@ public:
         return validated_tx_body_.buffer();
     }
 
+    system::data_chunk& fee_tx_head() NOEXCEPT
+    {
+        return fee_tx_head_.buffer();
+    }
+
+    system::data_chunk& fee_tx_body() NOEXCEPT
+    {
+        return fee_tx_body_.buffer();
+    }
+
     // Optionals.
 
     system::data_chunk& address_head() NOEXCEPT
@@ -298,6 +318,46 @@ public:
     {
         return filter_tx_body_.buffer();
     }
+
+    system::data_chunk& fee_bk_head() NOEXCEPT
+    {
+        return fee_bk_head_.buffer();
+    }
+
+    system::data_chunk& fee_bk_body() NOEXCEPT
+    {
+        return fee_bk_body_.buffer();
+    }
+
+    system::data_chunk& summary_head() NOEXCEPT
+    {
+        return summary_head_.buffer();
+    }
+
+    system::data_chunk& summary_body() NOEXCEPT
+    {
+        return summary_body_.buffer();
+    }
+
+    system::data_chunk& touched_head() NOEXCEPT
+    {
+        return touched_head_.buffer();
+    }
+
+    system::data_chunk& touched_body() NOEXCEPT
+    {
+        return touched_body_.buffer();
+    }
+
+    system::data_chunk& activity_head() NOEXCEPT
+    {
+        return activity_head_.buffer();
+    }
+
+    system::data_chunk& activity_body() NOEXCEPT
+    {
+        return activity_body_.buffer();
+    }
 };
 
 using query_accessor = query<store<chunk_storages>>;
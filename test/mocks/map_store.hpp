@@ -65,6 +65,16 @@ public:
         return configuration_;
     }
 
+    inline size_t header_body_written() const NOEXCEPT
+    {
+        return header_body_.written();
+    }
+
+    inline size_t header_body_count() const NOEXCEPT
+    {
+        return header_body_.size();
+    }
+
     // Archives.
 
     inline const path& header_head_file() const NOEXCEPT
@@ -127,6 +137,16 @@ public:
         return outs_body_.file();
     }
 
+    inline const path& spend_head_file() const NOEXCEPT
+    {
+        return spend_head_.file();
+    }
+
+    inline const path& spend_body_file() const NOEXCEPT
+    {
+        return spend_body_.file();
+    }
+
     inline const path& tx_head_file() const NOEXCEPT
     {
         return tx_head_.file();
@@ -301,6 +321,16 @@ public:
         return validated_tx_body_.file();
     }
 
+    inline const path& fee_tx_head_file() const NOEXCEPT
+    {
+        return fee_tx_head_.file();
+    }
+
+    inline const path& fee_tx_body_file() const NOEXCEPT
+    {
+        return fee_tx_body_.file();
+    }
+
     // Optionals.
 
     inline const path& address_head_file() const NOEXCEPT
@@ -333,6 +363,46 @@ public:
         return filter_tx_body_.file();
     }
 
+    inline const path& fee_bk_head_file() const NOEXCEPT
+    {
+        return fee_bk_head_.file();
+    }
+
+    inline const path& fee_bk_body_file() const NOEXCEPT
+    {
+        return fee_bk_body_.file();
+    }
+
+    inline const path& summary_head_file() const NOEXCEPT
+    {
+        return summary_head_.file();
+    }
+
+    inline const path& summary_body_file() const NOEXCEPT
+    {
+        return summary_body_.file();
+    }
+
+    inline const path& touched_head_file() const NOEXCEPT
+    {
+        return touched_head_.file();
+    }
+
+    inline const path& touched_body_file() const NOEXCEPT
+    {
+        return touched_body_.file();
+    }
+
+    inline const path& activity_head_file() const NOEXCEPT
+    {
+        return activity_head_.file();
+    }
+
+    inline const path& activity_body_file() const NOEXCEPT
+    {
+        return activity_body_.file();
+    }
+
     // Locks.
 
     inline const path& flush_lock_file() const NOEXCEPT
@@ -752,6 +752,45 @@ BOOST_AUTO_TEST_CASE(arraymap__record_at__exists__true)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(arraymap__record_set__value__head_only)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    arraymap_<link3, big_record::size> instance{ head_store, body_store, initial_buckets };
+    BOOST_REQUIRE(instance.create());
+
+    constexpr uint32_t expected = 0x00abcdef;
+    BOOST_REQUIRE(instance.set(1, expected));
+    BOOST_REQUIRE_EQUAL(instance.at(1), expected);
+    BOOST_REQUIRE(instance.at(0).is_terminal());
+    BOOST_REQUIRE(!instance.set(link3::terminal, expected));
+    BOOST_REQUIRE(body_store.buffer().empty());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(arraymap__record_merge__value__head_only)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    arraymap_<link3, big_record::size> instance{ head_store, body_store, initial_buckets };
+    BOOST_REQUIRE(instance.create());
+
+    const auto add = [](const link3& prior) NOEXCEPT
+    {
+        return link3{ prior.is_terminal() ? 1u : add1(prior.value) };
+    };
+
+    BOOST_REQUIRE(instance.merge(1, add));
+    BOOST_REQUIRE(instance.merge(1, add));
+    BOOST_REQUIRE(instance.merge(add1(initial_buckets), add));
+    BOOST_REQUIRE_EQUAL(instance.at(1), 2u);
+    BOOST_REQUIRE_EQUAL(instance.at(add1(initial_buckets)), 1u);
+    BOOST_REQUIRE(instance.at(initial_buckets).is_terminal());
+    BOOST_REQUIRE(!instance.merge(link3::terminal, add));
+    BOOST_REQUIRE(body_store.buffer().empty());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 // record create/close/backup/restore/verify
 // ----------------------------------------------------------------------------
 
@@ -638,6 +638,312 @@ BOOST_AUTO_TEST_CASE(hashmap__slab_first__exists__true)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(hashmap__first_many__size_mismatch__false)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    const std::vector<key1> keys{ { 0x41 }, { 0x42 } };
+    std::vector<link5> links(1);
+    BOOST_REQUIRE(!instance.first_many(keys, links));
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__first_many__mixed__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    // Keys 0x41 and 0x51 may share a bucket, exercising conflict list rounds.
+    const auto link_a = instance.put_link(key1{ 0x41 }, big_record{ 0xa1_u32 });
+    const auto link_b = instance.put_link(key1{ 0x51 }, big_record{ 0xb1_u32 });
+    const auto link_c = instance.put_link(key1{ 0x61 }, big_record{ 0xc1_u32 });
+    BOOST_REQUIRE(!link_a.is_terminal());
+    BOOST_REQUIRE(!link_b.is_terminal());
+    BOOST_REQUIRE(!link_c.is_terminal());
+
+    const std::vector<key1> keys{ { 0x61 }, { 0x42 }, { 0x41 }, { 0x51 }, { 0x41 } };
+    std::vector<link5> links(keys.size());
+    BOOST_REQUIRE(instance.first_many(keys, links));
+    BOOST_REQUIRE_EQUAL(links[0], link_c);
+    BOOST_REQUIRE(links[1].is_terminal());
+    BOOST_REQUIRE_EQUAL(links[2], link_a);
+    BOOST_REQUIRE_EQUAL(links[3], link_b);
+    BOOST_REQUIRE_EQUAL(links[4], link_a);
+
+    // Batch results match single key results.
+    for (size_t index{}; index < keys.size(); ++index)
+        BOOST_REQUIRE_EQUAL(links[index], instance.first(keys[index]));
+
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__exists_many__mixed__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_slab::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(!instance.put_link(key1{ 0x41 }, big_slab{ 0xa1_u32 }).is_terminal());
+
+    const std::vector<key1> keys{ { 0x41 }, { 0x42 } };
+    std::array<bool, 2> found{ false, true };
+    BOOST_REQUIRE(instance.exists_many(keys, found));
+    BOOST_REQUIRE(found[0]);
+    BOOST_REQUIRE(!found[1]);
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__get_statistics__empty__unoccupied)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    hash_statistics statistics{};
+    BOOST_REQUIRE(instance.get_statistics(statistics, buckets));
+    BOOST_REQUIRE_EQUAL(statistics.buckets, buckets);
+    BOOST_REQUIRE_EQUAL(statistics.body_count, 0u);
+    BOOST_REQUIRE_EQUAL(statistics.elements, 0u);
+    BOOST_REQUIRE_EQUAL(statistics.longest, 0u);
+    BOOST_REQUIRE_EQUAL(statistics.chains.front(), buckets);
+    BOOST_REQUIRE_EQUAL(statistics.lookups, 0u);
+    BOOST_REQUIRE_EQUAL(statistics.load_factor(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__get_statistics__populated__expected)
+{
+    constexpr auto count = 40_size;
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    for (size_t key{}; key < count; ++key)
+    {
+        const auto value = possible_narrow_cast<uint8_t>(key);
+        BOOST_REQUIRE(!instance.put_link(key1{ value }, big_record{ value }).is_terminal());
+    }
+
+    // All buckets sampled, so each key is looked up.
+    hash_statistics statistics{};
+    BOOST_REQUIRE(instance.get_statistics(statistics, buckets));
+    BOOST_REQUIRE_EQUAL(statistics.buckets, buckets);
+    BOOST_REQUIRE_EQUAL(statistics.body_count, count);
+    BOOST_REQUIRE_EQUAL(statistics.elements, count);
+    BOOST_REQUIRE_EQUAL(statistics.lookups, count);
+    BOOST_REQUIRE_GE(statistics.probes, count);
+    BOOST_REQUIRE_EQUAL(statistics.load_factor(), 2.5);
+
+    size_t total{};
+    size_t elements{};
+    for (size_t bin{}; bin < hash_statistics::bins; ++bin)
+    {
+        total += statistics.chains.at(bin);
+        elements += bin * statistics.chains.at(bin);
+    }
+
+    BOOST_REQUIRE_EQUAL(total, buckets);
+    BOOST_REQUIRE_EQUAL(elements, count);
+    BOOST_REQUIRE_LE(statistics.filter_hits + statistics.filter_misses, count);
+
+    // No sampling, no lookups.
+    BOOST_REQUIRE(instance.get_statistics(statistics, 0));
+    BOOST_REQUIRE_EQUAL(statistics.elements, count);
+    BOOST_REQUIRE_EQUAL(statistics.lookups, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__rehash__not_begun__false)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    auto complete = false;
+    BOOST_REQUIRE(!instance.rehash(complete, buckets));
+    BOOST_REQUIRE(!instance.end_rehash([]() NOEXCEPT { return true; }));
+    BOOST_REQUIRE(!instance.abort_rehash());
+    BOOST_REQUIRE(!complete);
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__rehash__incremental__found)
+{
+    constexpr auto count = 64_size;
+    constexpr auto resize = 61_size;
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    test::chunk_storage shadow_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    for (size_t key{}; key < count; ++key)
+    {
+        const auto value = possible_narrow_cast<uint8_t>(key);
+        BOOST_REQUIRE(!instance.put_link(key1{ value }, big_record{ value }).is_terminal());
+    }
+
+    const auto found = [&](size_t limit) NOEXCEPT
+    {
+        for (size_t key{}; key < limit; ++key)
+        {
+            big_record record{};
+            const auto value = possible_narrow_cast<uint8_t>(key);
+            if (!instance.find(key1{ value }, record) || record.value != value)
+                return false;
+        }
+
+        return true;
+    };
+
+    BOOST_REQUIRE(instance.begin_rehash(shadow_store, resize));
+    BOOST_REQUIRE(!instance.begin_rehash(shadow_store, resize));
+
+    // Keys remain found (and insertable) between each step of migration.
+    auto complete = false;
+    auto added = count;
+    while (!complete)
+    {
+        BOOST_REQUIRE(instance.rehash(complete, 3));
+        const auto value = possible_narrow_cast<uint8_t>(added++);
+        BOOST_REQUIRE(!instance.put_link(key1{ value }, big_record{ value }).is_terminal());
+        BOOST_REQUIRE(found(added));
+    }
+
+    // Replace head with shadow (as by file rename).
+    BOOST_REQUIRE(instance.end_rehash([&]() NOEXCEPT
+    {
+        head_store.buffer() = shadow_store.buffer();
+        return true;
+    }));
+
+    BOOST_REQUIRE_EQUAL(instance.buckets(), resize);
+    BOOST_REQUIRE_EQUAL(head_store.buffer().size(), add1(resize) * link5::size);
+    BOOST_REQUIRE(found(added));
+    BOOST_REQUIRE(instance.verify());
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__abort_rehash__partially_migrated__restored)
+{
+    constexpr auto count = 64_size;
+    constexpr auto resize = 61_size;
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    test::chunk_storage shadow_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    for (size_t key{}; key < count; ++key)
+    {
+        const auto value = possible_narrow_cast<uint8_t>(key);
+        BOOST_REQUIRE(!instance.put_link(key1{ value }, big_record{ value }).is_terminal());
+    }
+
+    const auto found = [&](size_t limit) NOEXCEPT
+    {
+        for (size_t key{}; key < limit; ++key)
+        {
+            big_record record{};
+            const auto value = possible_narrow_cast<uint8_t>(key);
+            if (!instance.find(key1{ value }, record) || record.value != value)
+                return false;
+        }
+
+        return true;
+    };
+
+    // Migrate some (not all) buckets, inserting keys into both heads.
+    auto complete = false;
+    auto added = count;
+    BOOST_REQUIRE(instance.begin_rehash(shadow_store, resize));
+    for (size_t step{}; step < 3u; ++step)
+    {
+        BOOST_REQUIRE(instance.rehash(complete, 3));
+        const auto value = possible_narrow_cast<uint8_t>(added++);
+        BOOST_REQUIRE(!instance.put_link(key1{ value }, big_record{ value }).is_terminal());
+    }
+
+    BOOST_REQUIRE(!complete);
+    BOOST_REQUIRE(instance.abort_rehash());
+
+    // Shadow lists are restored to the head, which retains its buckets.
+    BOOST_REQUIRE_EQUAL(instance.buckets(), buckets);
+    BOOST_REQUIRE_EQUAL(instance.span(), buckets);
+    BOOST_REQUIRE(found(added));
+    BOOST_REQUIRE(!instance.abort_rehash());
+    BOOST_REQUIRE(!instance.end_rehash([]() NOEXCEPT { return true; }));
+
+    // Keys remain insertable and a rehash may begin again.
+    const auto value = possible_narrow_cast<uint8_t>(added++);
+    BOOST_REQUIRE(!instance.put_link(key1{ value }, big_record{ value }).is_terminal());
+    BOOST_REQUIRE(found(added));
+    BOOST_REQUIRE(shadow_store.truncate(zero));
+    BOOST_REQUIRE(instance.begin_rehash(shadow_store, resize));
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
+BOOST_AUTO_TEST_CASE(hashmap__rehash__top_scan__all_found)
+{
+    constexpr auto count = 64_size;
+    constexpr auto resize = 61_size;
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    test::chunk_storage shadow_store{};
+    hashmap_<link5, key1, big_record::size> instance{ head_store, body_store, buckets };
+    BOOST_REQUIRE(instance.create());
+
+    for (size_t key{}; key < count; ++key)
+    {
+        const auto value = possible_narrow_cast<uint8_t>(key);
+        BOOST_REQUIRE(!instance.put_link(key1{ value }, big_record{ value }).is_terminal());
+    }
+
+    // Count all links reachable by scanning each bucket conflict list.
+    constexpr auto row = link5::size + array_count<key1> + big_record::size;
+    const auto scanned = [&]() NOEXCEPT
+    {
+        size_t links{};
+        for (size_t bucket{}; bucket < instance.span(); ++bucket)
+        {
+            auto link = instance.top(possible_narrow_cast<link5::integer>(bucket));
+            for (; !link.is_terminal(); ++links)
+                link = unsafe_array_cast<uint8_t, link5::size>(std::next(
+                    body_store.buffer().data(), link.value * row));
+        }
+
+        return links;
+    };
+
+    BOOST_REQUIRE_EQUAL(instance.span(), buckets);
+    BOOST_REQUIRE_EQUAL(scanned(), count);
+    BOOST_REQUIRE(instance.begin_rehash(shadow_store, resize));
+    BOOST_REQUIRE_EQUAL(instance.span(), buckets + resize);
+
+    // Migrated lists are scanned in shadow buckets (following head buckets).
+    auto complete = false;
+    while (!complete)
+    {
+        BOOST_REQUIRE(instance.rehash(complete, 3));
+        BOOST_REQUIRE_EQUAL(scanned(), count);
+    }
+
+    BOOST_REQUIRE(instance.end_rehash([&]() NOEXCEPT
+    {
+        head_store.buffer() = shadow_store.buffer();
+        return true;
+    }));
+
+    BOOST_REQUIRE_EQUAL(instance.span(), resize);
+    BOOST_REQUIRE_EQUAL(scanned(), count);
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_CASE(hashmap__record_it__exists_copy__non_terminal)
 {
     test::chunk_storage head_store{};
@@ -101,4 +101,37 @@ BOOST_AUTO_TEST_CASE(keys__hash_thumb__similarity__expected)
     BOOST_REQUIRE_EQUAL(system::ones_count(xor2), 34u);
 }
 
+BOOST_AUTO_TEST_CASE(keys__read__point__expected)
+{
+    data_array<hash_size + 3> bytes{};
+    std::copy(hash1.begin(), hash1.end(), bytes.begin());
+    bytes[hash_size + 0] = 0x67;
+    bytes[hash_size + 1] = 0x45;
+    bytes[hash_size + 2] = 0x23;
+
+    const auto point = keys::read<chain::point>(bytes);
+    BOOST_REQUIRE_EQUAL(point.hash(), hash1);
+    BOOST_REQUIRE_EQUAL(point.index(), 0x00234567_u32);
+    BOOST_REQUIRE(keys::compare(bytes, point));
+}
+
+BOOST_AUTO_TEST_CASE(keys__read__null_point__null_index)
+{
+    data_array<hash_size + 3> bytes{};
+    bytes[hash_size + 0] = 0xff;
+    bytes[hash_size + 1] = 0xff;
+    bytes[hash_size + 2] = 0xff;
+
+    const auto point = keys::read<chain::point>(bytes);
+    BOOST_REQUIRE_EQUAL(point.hash(), null_hash);
+    BOOST_REQUIRE_EQUAL(point.index(), chain::point::null_index);
+    BOOST_REQUIRE(point.is_null());
+}
+
+BOOST_AUTO_TEST_CASE(keys__read__array__expected)
+{
+    const data_array<4> bytes{ 0x01, 0x02, 0x03, 0x04 };
+    BOOST_REQUIRE_EQUAL(keys::read<data_array<3>>(bytes), (data_array<3>{ 0x01, 0x02, 0x03 }));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
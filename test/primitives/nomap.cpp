@@ -162,6 +162,30 @@ BOOST_AUTO_TEST_CASE(nomap__record_count__truncate__expected)
     BOOST_REQUIRE(!instance.get_fault());
 }
 
+BOOST_AUTO_TEST_CASE(nomap__record_allocate__put_memory_link__expected)
+{
+    data_chunk head_file{};
+    data_chunk body_file{};
+    test::chunk_storage head_store{ head_file };
+    test::chunk_storage body_store{ body_file };
+    nomap<link5, big_record::size> instance{ head_store, body_store };
+
+    const auto link = instance.allocate(2);
+    BOOST_REQUIRE_EQUAL(link, 0u);
+    BOOST_REQUIRE_EQUAL(instance.count(), 2u);
+
+    // Records are written out of order into the single allocation.
+    const auto ptr = instance.get_memory();
+    BOOST_REQUIRE(instance.put(ptr, 1, big_record{ 0x01020304_u32 }));
+    BOOST_REQUIRE(instance.put(ptr, 0, big_record{ 0xa1b2c3d4_u32 }));
+    BOOST_REQUIRE(!instance.put(ptr, 2, big_record{ 0xa1b2c3d4_u32 }));
+    BOOST_REQUIRE(!instance.put(ptr, link5::terminal, big_record{ 0xa1b2c3d4_u32 }));
+
+    const data_chunk expected_file{ 0xa1, 0xb2, 0xc3, 0xd4, 0x01, 0x02, 0x03, 0x04 };
+    BOOST_REQUIRE_EQUAL(body_file, expected_file);
+    BOOST_REQUIRE(!instance.get_fault());
+}
+
 BOOST_AUTO_TEST_CASE(nomap__record_put_link__multiple__expected)
 {
     data_chunk head_file{};
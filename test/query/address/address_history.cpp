@@ -400,6 +400,63 @@ BOOST_AUTO_TEST_CASE(query_address__get_confirmed_history__start__excludes_prior
     BOOST_CHECK_EQUAL(out.size(), 3u);
 }
 
+BOOST_AUTO_TEST_CASE(query_address__get_confirmed_history__activity__bounded_by_cursor)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.activity_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1b, database::context{ 0, 1, 0 }, false, false));
+    BOOST_CHECK(query.set(test::block_valid_spend_internal_2b, database::context{ 0, 2, 0 }, false, false));
+    BOOST_CHECK(query.push_confirmed(query.to_header(test::block1b.hash()), true));
+    BOOST_CHECK(query.push_confirmed(query.to_header(test::block_valid_spend_internal_2b.hash()), true));
+
+    histories out{};
+    height_link cursor{};
+    const std::atomic_bool cancel{};
+    const auto& hash = test::block1a_address0;
+    const auto& txs1 = *test::block1b.transactions_ptr();
+
+    // One tx of block1b and three txs of block2b.
+    BOOST_CHECK_EQUAL(query.get_confirmed_history(cancel, cursor, out, hash, max_size_t, true), error::success);
+    BOOST_REQUIRE_EQUAL(out.size(), 4u);
+    BOOST_CHECK_EQUAL(out.at(0).tx.hash(), txs1.at(0)->hash(false));
+    BOOST_CHECK_EQUAL(out.at(0).tx.height(), 1u);
+    BOOST_CHECK_EQUAL(out.at(3).tx.height(), 2u);
+    BOOST_CHECK_EQUAL(cursor.value, 3u);
+
+    // Nothing since cursor (activity walk ends at first entry below cursor).
+    BOOST_CHECK_EQUAL(query.get_confirmed_history(cancel, cursor, out, hash, 0, true), error::success);
+    BOOST_CHECK(out.empty());
+
+    // Limit applies only to activity at or above cursor.
+    cursor = 2;
+    BOOST_CHECK_EQUAL(query.get_confirmed_history(cancel, cursor, out, hash, 2, true), error::depth_limited);
+    BOOST_CHECK(out.empty());
+
+    cursor = 2;
+    BOOST_CHECK_EQUAL(query.get_confirmed_history(cancel, cursor, out, hash, 3, true), error::success);
+    BOOST_REQUIRE_EQUAL(out.size(), 3u);
+    BOOST_CHECK_EQUAL(out.at(0).tx.height(), 2u);
+    BOOST_CHECK_EQUAL(out.at(1).tx.height(), 2u);
+    BOOST_CHECK_EQUAL(out.at(2).tx.height(), 2u);
+
+    // Reorganized activity is filtered.
+    BOOST_CHECK(query.pop_confirmed());
+    cursor = 2;
+    BOOST_CHECK_EQUAL(query.get_confirmed_history(cancel, cursor, out, hash, max_size_t, true), error::success);
+    BOOST_CHECK(out.empty());
+
+    // Reconfirmed activity is deduplicated.
+    BOOST_CHECK(query.push_confirmed(query.to_header(test::block_valid_spend_internal_2b.hash()), true));
+    cursor = 2;
+    BOOST_CHECK_EQUAL(query.get_confirmed_history(cancel, cursor, out, hash, max_size_t, true), error::success);
+    BOOST_CHECK_EQUAL(out.size(), 3u);
+}
+
 // get_tx_history
 
 BOOST_AUTO_TEST_CASE(query_address__get_tx_history__genesis__expected)
@@ -569,4 +626,40 @@ BOOST_AUTO_TEST_CASE(query_address__get_spenders_history__confirmed__expected)
     BOOST_CHECK_EQUAL(histories.at(3).tx.hash(), test::tx4.hash(false));
 }
 
+// get_history_many
+
+BOOST_AUTO_TEST_CASE(query_address__get_history_many__turbo_three_keys__grouped_as_get_history)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(test::setup_three_block_confirmed_address_store(query));
+
+    const hashes keys{ test::genesis_address0, test::block1a_address0, system::null_hash };
+    const std::atomic_bool cancel{};
+    histories expected0{};
+    histories expected1{};
+    histories expected2{};
+    height_link cursor0{};
+    height_link cursor1{};
+    height_link cursor2{};
+    BOOST_REQUIRE(!query.get_history(cancel, cursor0, expected0, keys.at(0), max_size_t, true));
+    BOOST_REQUIRE(!query.get_history(cancel, cursor1, expected1, keys.at(1), max_size_t, true));
+    BOOST_REQUIRE(!query.get_history(cancel, cursor2, expected2, keys.at(2), max_size_t, true));
+    BOOST_REQUIRE(!expected0.empty());
+    BOOST_REQUIRE(!expected1.empty());
+    BOOST_REQUIRE(expected2.empty());
+
+    history_sets out{};
+    height_link cursor{};
+    BOOST_REQUIRE(!query.get_history_many(cancel, cursor, out, keys, max_size_t, true));
+    BOOST_REQUIRE_EQUAL(cursor.value, cursor0.value);
+    BOOST_REQUIRE_EQUAL(out.size(), keys.size());
+    BOOST_REQUIRE(out.at(0) == expected0);
+    BOOST_REQUIRE(out.at(1) == expected1);
+    BOOST_REQUIRE(out.at(2) == expected2);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
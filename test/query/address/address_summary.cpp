@@ -0,0 +1,273 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/blocks.hpp"
+#include "../../mocks/chunk_store.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(query_address_summary_tests, test::directory_setup_fixture)
+
+class query_access
+  : public test::query_accessor
+{
+public:
+    using base = test::query_accessor;
+    using base::base;
+    using base::summary_changes;
+    using base::get_summary_changes;
+    using base::push_summaries;
+};
+
+using namespace system;
+using namespace system::chain;
+const auto pick_roll_pick = script{ { { opcode::pick }, { opcode::roll }, { opcode::pick } } }.hash();
+
+static std::string to_entry(const transaction& tx, size_t height) NOEXCEPT
+{
+    return encode_hash(tx.hash(false)) + ":" + std::to_string(height) + ":";
+}
+
+static hash_digest to_status(const std::string& preimage) NOEXCEPT
+{
+    return sha256_hash(data_chunk(preimage.begin(), preimage.end()));
+}
+
+static hash_digest to_status(const histories& history) NOEXCEPT
+{
+    address_status status{};
+    for (const auto& entry: history)
+        status.write(entry.tx.hash(), entry.tx.height());
+
+    return status.finalize();
+}
+
+BOOST_AUTO_TEST_CASE(query_address_summary__get_address_summary__disabled__not_found)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    address_summary out{};
+    BOOST_REQUIRE_EQUAL(query.get_address_summary(out, test::block1a_address0), error::not_found);
+    BOOST_REQUIRE(out == address_summary{});
+}
+
+BOOST_AUTO_TEST_CASE(query_address_summary__get_address_summary__unconfirmed__default)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.summary_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1b, test::context, false, false));
+
+    address_summary out{};
+    BOOST_REQUIRE(!query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE(out == address_summary{});
+}
+
+BOOST_AUTO_TEST_CASE(query_address_summary__push_confirmed__two_blocks__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.summary_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1b, database::context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block_valid_spend_internal_2b, database::context{ 0, 2, 0 }, false, false));
+
+    // block1b coinbase funds block1a_address0 twice (0xb1 each).
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block1b.hash()), true));
+
+    const auto& txs1 = *test::block1b.transactions_ptr();
+    const auto preimage1 = to_entry(*txs1.at(0), 1);
+
+    address_summary out{};
+    BOOST_REQUIRE(!query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out.balance, 0x162u);
+    BOOST_REQUIRE_EQUAL(out.funded, 2u);
+    BOOST_REQUIRE_EQUAL(out.spent, 0u);
+    BOOST_REQUIRE_EQUAL(out.height, 1u);
+    BOOST_REQUIRE_EQUAL(out.status.finalize(), to_status(preimage1));
+    const auto summary1 = out;
+
+    // block2b funds block1a_address0 twice (0xb1, 0xb0) and spends it three
+    // times (0xb1 each), funding pick_roll_pick once (0xb2).
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block_valid_spend_internal_2b.hash()), true));
+
+    const auto& txs2 = *test::block_valid_spend_internal_2b.transactions_ptr();
+    const auto preimage2 = preimage1 +
+        to_entry(*txs2.at(0), 2) +
+        to_entry(*txs2.at(1), 2) +
+        to_entry(*txs2.at(2), 2);
+
+    BOOST_REQUIRE(!query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out.balance, 0xb0u);
+    BOOST_REQUIRE_EQUAL(out.funded, 4u);
+    BOOST_REQUIRE_EQUAL(out.spent, 3u);
+    BOOST_REQUIRE_EQUAL(out.height, 2u);
+    BOOST_REQUIRE_EQUAL(out.status.finalize(), to_status(preimage2));
+    const auto summary2 = out;
+
+    BOOST_REQUIRE(!query.get_address_summary(out, pick_roll_pick));
+    BOOST_REQUIRE_EQUAL(out.balance, 0xb2u);
+    BOOST_REQUIRE_EQUAL(out.funded, 1u);
+    BOOST_REQUIRE_EQUAL(out.spent, 0u);
+    BOOST_REQUIRE_EQUAL(out.height, 2u);
+    BOOST_REQUIRE_EQUAL(out.status.finalize(), to_status(to_entry(*txs2.at(2), 2)));
+
+    // Confirmed balance is read from the summary.
+    uint64_t confirmed{};
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE(!query.get_confirmed_balance(cancel, confirmed, test::block1a_address0, true));
+    BOOST_REQUIRE_EQUAL(confirmed, 0xb0u);
+
+    // Pop leaves the prior summary current (and defaults the unconfirmed
+    // address), without writing summaries.
+    const auto records = query.summary_records();
+    BOOST_REQUIRE(query.pop_confirmed());
+    BOOST_REQUIRE_EQUAL(query.summary_records(), records);
+    BOOST_REQUIRE(!query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE(out == summary1);
+    BOOST_REQUIRE(!query.get_address_summary(out, pick_roll_pick));
+    BOOST_REQUIRE(out == address_summary{});
+    BOOST_REQUIRE(!query.get_confirmed_balance(cancel, confirmed, test::block1a_address0, true));
+    BOOST_REQUIRE_EQUAL(confirmed, 0x162u);
+
+    // Reconfirmation reproduces the popped summary.
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block_valid_spend_internal_2b.hash()), true));
+    BOOST_REQUIRE(!query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE(out == summary2);
+}
+
+BOOST_AUTO_TEST_CASE(query_address_summary__push_summaries__uncommitted__not_current)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.summary_buckets = 8;
+    test::chunk_store store{ settings };
+    query_access query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1b, database::context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block_valid_spend_internal_2b, database::context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block1b.hash()), true));
+
+    address_summary summary1{};
+    BOOST_REQUIRE(!query.get_address_summary(summary1, test::block1a_address0));
+
+    // Summaries written without commit of the block (e.g. interrupted by
+    // allocation failure) are not current.
+    const auto link = query.to_header(test::block_valid_spend_internal_2b.hash());
+    query_access::summary_changes changes{};
+    BOOST_REQUIRE(query.get_summary_changes(changes, link));
+    BOOST_REQUIRE(query.push_summaries(changes, link, 2));
+
+    address_summary out{};
+    BOOST_REQUIRE(!query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE(out == summary1);
+    BOOST_REQUIRE(!query.get_address_summary(out, pick_roll_pick));
+    BOOST_REQUIRE(out == address_summary{});
+
+    // Subsequent confirmation supersedes them from the current summaries.
+    BOOST_REQUIRE(query.push_confirmed(link, true));
+
+    const auto& txs1 = *test::block1b.transactions_ptr();
+    const auto& txs2 = *test::block_valid_spend_internal_2b.transactions_ptr();
+    const auto preimage = to_entry(*txs1.at(0), 1) +
+        to_entry(*txs2.at(0), 2) +
+        to_entry(*txs2.at(1), 2) +
+        to_entry(*txs2.at(2), 2);
+
+    BOOST_REQUIRE(!query.get_address_summary(out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out.balance, 0xb0u);
+    BOOST_REQUIRE_EQUAL(out.funded, 4u);
+    BOOST_REQUIRE_EQUAL(out.spent, 3u);
+    BOOST_REQUIRE_EQUAL(out.height, 2u);
+    BOOST_REQUIRE_EQUAL(out.status.finalize(), to_status(preimage));
+}
+
+BOOST_AUTO_TEST_CASE(query_address_summary__get_address_status__disabled__not_found)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    hash_digest out{ 0x42 };
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE_EQUAL(query.get_address_status(cancel, out, test::block1a_address0), error::not_found);
+    BOOST_REQUIRE_EQUAL(out, null_hash);
+}
+
+BOOST_AUTO_TEST_CASE(query_address_summary__get_address_status__no_history__null_hash)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.summary_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    hash_digest out{ 0x42 };
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE(!query.get_address_status(cancel, out, pick_roll_pick));
+    BOOST_REQUIRE_EQUAL(out, null_hash);
+}
+
+BOOST_AUTO_TEST_CASE(query_address_summary__get_address_status__confirmed_and_unconfirmed__history_status)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.summary_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1b, database::context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block_valid_spend_internal_2b, database::context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block1b.hash()), true));
+
+    // Confirmed midstate is finalized after appending unconfirmed history,
+    // which matches the status of the full (electrum sorted) history.
+    histories history{};
+    height_link cursor{};
+    hash_digest out{};
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE(!query.get_history(cancel, cursor, history, test::block1a_address0));
+    BOOST_REQUIRE(!query.get_address_status(cancel, out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out, to_status(history));
+
+    BOOST_REQUIRE(query.push_confirmed(query.to_header(test::block_valid_spend_internal_2b.hash()), true));
+    cursor = {};
+    BOOST_REQUIRE(!query.get_history(cancel, cursor, history, test::block1a_address0));
+    BOOST_REQUIRE(!query.get_address_status(cancel, out, test::block1a_address0));
+    BOOST_REQUIRE_EQUAL(out, to_status(history));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/blocks.hpp"
+#include "../../mocks/chunk_store.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(query_address_touched_tests, test::directory_setup_fixture)
+
+using namespace system;
+using namespace system::chain;
+
+// block_valid_spend_internal_2b funds pick (tx2b, tx3) and pick_roll_pick
+// (tx4), and spends pick (tx2b:0 by tx3, block1b:0 and block1b:1 by tx4).
+static hashes expected_touched() NOEXCEPT
+{
+    const auto pick_roll_pick = script{ { { opcode::pick }, { opcode::roll }, { opcode::pick } } }.hash();
+    hashes keys{ test::block1a_address0, pick_roll_pick };
+    std::sort(keys.begin(), keys.end());
+    return keys;
+}
+
+BOOST_AUTO_TEST_CASE(query_address_touched__get_touched__terminal__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    hashes out{};
+    BOOST_REQUIRE(!query.get_touched(out, header_link{}));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(query_address_touched__get_touched__genesis__output_key)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    hashes out{};
+    const auto& coinbase = *test::genesis.transactions_ptr()->front();
+    BOOST_REQUIRE(query.get_touched(out, 0));
+    BOOST_REQUIRE_EQUAL(out.size(), 1u);
+    BOOST_REQUIRE_EQUAL(out.front(), coinbase.outputs_ptr()->front()->script().hash());
+}
+
+BOOST_AUTO_TEST_CASE(query_address_touched__get_touched__disabled__computed)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1b, test::context, false, false));
+    BOOST_REQUIRE(query.set(test::block_valid_spend_internal_2b, test::context, false, false));
+
+    const auto link = query.to_header(test::block_valid_spend_internal_2b.hash());
+    BOOST_REQUIRE(query.set_touched(link));
+    BOOST_REQUIRE(!query.is_touched(link));
+
+    hashes out{};
+    BOOST_REQUIRE(query.get_touched(out, link));
+    BOOST_REQUIRE(out == expected_touched());
+}
+
+BOOST_AUTO_TEST_CASE(query_address_touched__set_touched__enabled__stored)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.touched_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1b, test::context, false, false));
+    BOOST_REQUIRE(query.set(test::block_valid_spend_internal_2b, test::context, false, false));
+
+    const auto link = query.to_header(test::block_valid_spend_internal_2b.hash());
+    BOOST_REQUIRE(!query.is_touched(link));
+    BOOST_REQUIRE(query.set_touched(link));
+    BOOST_REQUIRE(query.is_touched(link));
+    BOOST_REQUIRE(!query.is_touched(query.to_header(test::block1b.hash())));
+
+    hashes out{};
+    BOOST_REQUIRE(query.get_touched(out, link));
+    BOOST_REQUIRE(out == expected_touched());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -171,4 +171,63 @@ BOOST_AUTO_TEST_CASE(query_address__get_unspent__turbo_genesis__expected)
     BOOST_CHECK_EQUAL(out.at(5).out.point().hash(), test::block2b.transactions_ptr()->at(0)->hash(false));
 }
 
+// get_unspent_many
+
+BOOST_AUTO_TEST_CASE(query_address__get_unspent_many__turbo_three_keys__grouped_as_get_unspent)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(test::setup_three_block_confirmed_address_store(query));
+
+    const hashes keys{ test::genesis_address0, test::block1a_address0, system::null_hash };
+    const std::atomic_bool cancel{};
+    unspents expected0{};
+    unspents expected1{};
+    unspents expected2{};
+    BOOST_REQUIRE(!query.get_unspent(cancel, expected0, keys.at(0), true));
+    BOOST_REQUIRE(!query.get_unspent(cancel, expected1, keys.at(1), true));
+    BOOST_REQUIRE(!query.get_unspent(cancel, expected2, keys.at(2), true));
+    BOOST_REQUIRE(!expected1.empty());
+    BOOST_REQUIRE(expected2.empty());
+
+    unspent_sets out{};
+    BOOST_REQUIRE(!query.get_unspent_many(cancel, out, keys, true));
+    BOOST_REQUIRE_EQUAL(out.size(), keys.size());
+    BOOST_REQUIRE(out.at(0) == expected0);
+    BOOST_REQUIRE(out.at(1) == expected1);
+    BOOST_REQUIRE(out.at(2) == expected2);
+}
+
+BOOST_AUTO_TEST_CASE(query_address__get_unspent_many__empty__empty)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    unspent_sets out{ unspents{} };
+    const std::atomic_bool cancel{};
+    BOOST_REQUIRE(!query.get_unspent_many(cancel, out, {}));
+    BOOST_REQUIRE(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(query_address__get_unspent_many__canceled__query_canceled)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    unspent_sets out{};
+    const std::atomic_bool cancel{ true };
+    BOOST_REQUIRE_EQUAL(query.get_unspent_many(cancel, out, { test::genesis_address0 }), error::query_canceled);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -149,6 +149,100 @@ BOOST_AUTO_TEST_CASE(query_chain_reader__get_header__default__expected)
     BOOST_CHECK_EQUAL(pointer1->hash(), block_hash);
 }
 
+BOOST_AUTO_TEST_CASE(query_chain_reader__get_header__cache_enabled__same_object)
+{
+    settings settings{};
+    settings.header_cache = 10;
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    const auto pointer1 = query.get_header(0);
+    const auto pointer2 = query.get_header(0);
+    BOOST_CHECK(pointer1);
+    BOOST_CHECK_EQUAL(pointer1, pointer2);
+    BOOST_CHECK_EQUAL(query.header_cache_hits(), 1u);
+    BOOST_CHECK_EQUAL(query.header_cache_misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(query_chain_reader__get_header__cache_disabled__distinct_objects)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    const auto pointer1 = query.get_header(0);
+    const auto pointer2 = query.get_header(0);
+    BOOST_CHECK(pointer1);
+    BOOST_CHECK(pointer1 != pointer2);
+    BOOST_CHECK(*pointer1 == *pointer2);
+    BOOST_CHECK_EQUAL(query.header_cache_hits(), 0u);
+    BOOST_CHECK_EQUAL(query.header_cache_misses(), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(query_chain_reader__get_transaction__cache_enabled__witness_only)
+{
+    settings settings{};
+    settings.tx_cache = 10;
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    const auto nominal1 = query.get_transaction(0, false);
+    const auto nominal2 = query.get_transaction(0, false);
+    BOOST_CHECK(nominal1 != nominal2);
+    BOOST_CHECK_EQUAL(query.tx_cache_hits(), 0u);
+    BOOST_CHECK_EQUAL(query.tx_cache_misses(), 0u);
+
+    // Cached objects are copied, as callers may populate their inputs.
+    const auto witness1 = query.get_transaction(0, true);
+    const auto witness2 = query.get_transaction(0, true);
+    BOOST_CHECK(witness1);
+    BOOST_CHECK(witness1 != witness2);
+    BOOST_CHECK(*witness1 == *witness2);
+    BOOST_CHECK(witness1->inputs_ptr()->front() != witness2->inputs_ptr()->front());
+    BOOST_CHECK_EQUAL(query.tx_cache_hits(), 1u);
+    BOOST_CHECK_EQUAL(query.tx_cache_misses(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(query_chain_reader__get_transaction__cache_enabled_populated__unshared)
+{
+    settings settings{};
+    settings.tx_cache = 10;
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1a, test::context, false, false));
+    BOOST_CHECK(query.set(test::tx4));
+
+    const auto link = query.to_tx(test::tx4.hash(false));
+    const auto tx1 = query.get_transaction(link, true);
+    BOOST_CHECK(tx1);
+    BOOST_CHECK(query.populate_with_metadata(*tx1));
+    BOOST_CHECK(tx1->inputs_ptr()->front()->prevout);
+    BOOST_CHECK_EQUAL(tx1->inputs_ptr()->front()->metadata.parent_tx, 1u);
+
+    // Metadata of one caller's population does not leak into another's.
+    tx1->inputs_ptr()->front()->metadata.parent_tx = 42;
+    const auto tx2 = query.get_transaction(link, true);
+    BOOST_CHECK(tx2);
+    BOOST_CHECK(!tx2->inputs_ptr()->front()->prevout);
+    BOOST_CHECK(query.populate_with_metadata(*tx2));
+    BOOST_CHECK(tx2->inputs_ptr()->front()->prevout);
+    BOOST_CHECK_EQUAL(tx2->inputs_ptr()->front()->metadata.parent_tx, 1u);
+    BOOST_CHECK_EQUAL(tx1->inputs_ptr()->front()->metadata.parent_tx, 42u);
+    BOOST_CHECK_EQUAL(query.tx_cache_hits(), 1u);
+}
+
 // is_coinbase
 
 BOOST_AUTO_TEST_CASE(query_chain_reader__is_coinbase__coinbase__true)
@@ -735,6 +735,51 @@ BOOST_AUTO_TEST_CASE(query_chain_writer__set_block_txs__get_block__expected)
     BOOST_CHECK_EQUAL(hashes, test::genesis.transaction_hashes(false));
 }
 
+BOOST_AUTO_TEST_CASE(query_chain_writer__set_block_txs__group_commit__same_as_set_txs)
+{
+    settings settings{};
+    settings.tx_buckets = 8;
+    settings.point_buckets = 8;
+    settings.address_buckets = 8;
+    settings.path = TEST_DIRECTORY;
+
+    // Block txs are set by group commit.
+    test::chunk_store store1{ settings };
+    test::query_accessor query1{ store1 };
+    BOOST_CHECK(!store1.create(test::events_handler));
+    BOOST_CHECK(query1.initialize(test::genesis));
+    BOOST_CHECK(query1.set(test::block1b, test::context, false, false));
+    BOOST_CHECK(query1.set(test::block_valid_spend_internal_2b, test::context, false, false));
+
+    // Block txs are set individually.
+    test::chunk_store store2{ settings };
+    test::query_accessor query2{ store2 };
+    BOOST_CHECK(!store2.create(test::events_handler));
+    BOOST_CHECK(query2.initialize(test::genesis));
+    BOOST_CHECK(query2.set(test::block1b, test::context, false, false));
+    for (const auto& tx: *test::block_valid_spend_internal_2b.transactions_ptr())
+        BOOST_CHECK(query2.set(*tx));
+
+    BOOST_CHECK(!store1.close(test::events_handler));
+    BOOST_CHECK(!store2.close(test::events_handler));
+
+    BOOST_CHECK_EQUAL(store1.tx_head(), store2.tx_head());
+    BOOST_CHECK_EQUAL(store1.tx_body(), store2.tx_body());
+    BOOST_CHECK_EQUAL(store1.point_head(), store2.point_head());
+    BOOST_CHECK_EQUAL(store1.point_body(), store2.point_body());
+    BOOST_CHECK_EQUAL(store1.input_head(), store2.input_head());
+    BOOST_CHECK_EQUAL(store1.input_body(), store2.input_body());
+    BOOST_CHECK_EQUAL(store1.output_head(), store2.output_head());
+    BOOST_CHECK_EQUAL(store1.output_body(), store2.output_body());
+    BOOST_CHECK_EQUAL(store1.ins_head(), store2.ins_head());
+    BOOST_CHECK_EQUAL(store1.ins_body(), store2.ins_body());
+    BOOST_CHECK_EQUAL(store1.outs_head(), store2.outs_head());
+    BOOST_CHECK_EQUAL(store1.outs_body(), store2.outs_body());
+    BOOST_CHECK_EQUAL(store1.address_head(), store2.address_head());
+    BOOST_CHECK_EQUAL(store1.address_body(), store2.address_body());
+    BOOST_CHECK_EQUAL(store1.duplicate_body(), store2.duplicate_body());
+}
+
 // populate_with_metadata
 // ----------------------------------------------------------------------------
 
@@ -777,6 +822,28 @@ BOOST_AUTO_TEST_CASE(query_chain_writer__populate_with_metadata__null_prevouts__
     BOOST_CHECK(query.populate_with_metadata(copy3));
 }
 
+BOOST_AUTO_TEST_CASE(query_chain_writer__populate_with_metadata__second_coinbase__true)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    // Invalid block with a coinbase (null point) tx that is not first.
+    const system::chain::block block
+    {
+        test::block1.header(),
+        {
+            *test::block1.transactions_ptr()->front(),
+            *test::block2.transactions_ptr()->front()
+        }
+    };
+
+    BOOST_CHECK(query.populate_with_metadata(clean_(block)));
+}
+
 BOOST_AUTO_TEST_CASE(query_chain_writer__populate_with_metadata__partial_prevouts__false)
 {
     settings settings{};
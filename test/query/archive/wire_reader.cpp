@@ -132,4 +132,86 @@ BOOST_AUTO_TEST_CASE(query_wire_reader__get_wire_block__witness_false__expected)
     BOOST_CHECK(!store.close(test::events_handler));
 }
 
+// get_wire_tx_iov
+
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_wire_tx_iov__witness_true__expected)
+{
+    using namespace system;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+    BOOST_CHECK_EQUAL(query.get_wire_tx_iov(0, true).to_data(), test::genesis.transactions_ptr()->at(0)->to_data(true));
+    BOOST_CHECK_EQUAL(query.get_wire_tx_iov(1, true).to_data(), test::block1a.transactions_ptr()->at(0)->to_data(true));
+    BOOST_CHECK_EQUAL(query.get_wire_tx_iov(2, true).to_data(), test::block2a.transactions_ptr()->at(0)->to_data(true));
+    BOOST_CHECK_EQUAL(query.get_wire_tx_iov(3, true).to_data(), test::block2a.transactions_ptr()->at(1)->to_data(true));
+    BOOST_CHECK(query.get_wire_tx_iov(42, true).get_segments().empty());
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_wire_tx_iov__witness_false__expected)
+{
+    using namespace system;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+    BOOST_CHECK_EQUAL(query.get_wire_tx_iov(0, false).to_data(), test::genesis.transactions_ptr()->at(0)->to_data(false));
+    BOOST_CHECK_EQUAL(query.get_wire_tx_iov(1, false).to_data(), test::block1a.transactions_ptr()->at(0)->to_data(false));
+    BOOST_CHECK_EQUAL(query.get_wire_tx_iov(2, false).to_data(), test::block2a.transactions_ptr()->at(0)->to_data(false));
+    BOOST_CHECK_EQUAL(query.get_wire_tx_iov(3, false).to_data(), test::block2a.transactions_ptr()->at(1)->to_data(false));
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
+// get_wire_block_iov
+
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_wire_block_iov__genesis_and_not__expected)
+{
+    using namespace system;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_store(query));
+
+    BOOST_CHECK_EQUAL(query.get_wire_block_iov(1, true).size(), test::block1.serialized_size(true));
+    BOOST_CHECK_EQUAL(query.get_wire_block_iov(1, true).to_data(), test::block1.to_data(true));
+    BOOST_CHECK_EQUAL(query.get_wire_block_iov(0, true).to_data(), test::genesis.to_data(true));
+    BOOST_CHECK(query.get_wire_block_iov(42, true).get_segments().empty());
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_wire_block_iov__witness_true__expected)
+{
+    using namespace system;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+    BOOST_CHECK_EQUAL(query.get_wire_block_iov(0, true).to_data(), test::genesis.to_data(true));
+    BOOST_CHECK_EQUAL(query.get_wire_block_iov(1, true).to_data(), test::block1a.to_data(true));
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
+BOOST_AUTO_TEST_CASE(query_wire_reader__get_wire_block_iov__witness_false__expected)
+{
+    using namespace system;
+    database::settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::store_t store{ settings };
+    test::query_t query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(test::setup_three_block_witness_store(query));
+    BOOST_CHECK_EQUAL(query.get_wire_block_iov(0, false).to_data(), test::genesis.to_data(false));
+    BOOST_CHECK_EQUAL(query.get_wire_block_iov(1, false).to_data(), test::block1a.to_data(false));
+    BOOST_CHECK(!store.close(test::events_handler));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
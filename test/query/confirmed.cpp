@@ -144,6 +144,86 @@ BOOST_AUTO_TEST_CASE(query_confirmed__is_confirmed_tx__confirm__expected)
     BOOST_REQUIRE(query.is_confirmed_tx(2));
 }
 
+BOOST_AUTO_TEST_CASE(query_confirmed__set_strong__strong_cache__expected_contexts)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.strong_cache = true;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{ 0, 1, 42 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2, context{ 0, 2, 43 }, false, false));
+
+    uint32_t height{};
+    uint32_t mtp{};
+    BOOST_REQUIRE(!store.strong_contexts.get(height, mtp, 1));
+    BOOST_REQUIRE(query.set_strong(1));
+    BOOST_REQUIRE(query.set_strong(2));
+    BOOST_REQUIRE(store.strong_contexts.get(height, mtp, 1));
+    BOOST_REQUIRE_EQUAL(height, 1u);
+    BOOST_REQUIRE_EQUAL(mtp, 42u);
+    BOOST_REQUIRE(store.strong_contexts.get(height, mtp, 2));
+    BOOST_REQUIRE_EQUAL(height, 2u);
+    BOOST_REQUIRE_EQUAL(mtp, 43u);
+
+    BOOST_REQUIRE(query.set_unstrong(2));
+    BOOST_REQUIRE(!store.strong_contexts.get(height, mtp, 2));
+    BOOST_REQUIRE(store.strong_contexts.get(height, mtp, 1));
+}
+
+BOOST_AUTO_TEST_CASE(query_confirmed__initialize_strong_cache__confirmed__expected_contexts)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.strong_cache = true;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{ 0, 1, 42 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2, context{ 0, 2, 43 }, false, false));
+    BOOST_REQUIRE(query.push_confirmed(1, true));
+    BOOST_REQUIRE(query.set_strong(2));
+
+    // Strong but unconfirmed block 2 is not restored.
+    store.strong_contexts.clear();
+    BOOST_REQUIRE(query.initialize_strong_cache());
+
+    uint32_t height{};
+    uint32_t mtp{};
+    BOOST_REQUIRE(store.strong_contexts.get(height, mtp, 0));
+    BOOST_REQUIRE_EQUAL(height, 0u);
+    BOOST_REQUIRE(store.strong_contexts.get(height, mtp, 1));
+    BOOST_REQUIRE_EQUAL(height, 1u);
+    BOOST_REQUIRE_EQUAL(mtp, 42u);
+    BOOST_REQUIRE(!store.strong_contexts.get(height, mtp, 2));
+}
+
+BOOST_AUTO_TEST_CASE(query_confirmed__initialize_strong__confirmed__expected_strong)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context{ 0, 1, 42 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2, context{ 0, 2, 43 }, false, false));
+    BOOST_REQUIRE(query.push_confirmed(1, true));
+    BOOST_REQUIRE(query.set_strong(2));
+    BOOST_REQUIRE(query.is_strong_block(2));
+
+    // Strong but unconfirmed block 2 is not restored.
+    BOOST_REQUIRE(query.initialize_strong());
+    BOOST_REQUIRE(query.is_strong_block(0));
+    BOOST_REQUIRE(query.is_strong_block(1));
+    BOOST_REQUIRE(!query.is_strong_block(2));
+    BOOST_REQUIRE_EQUAL(query.find_strong(1), 1u);
+    BOOST_REQUIRE(query.find_strong(2).is_terminal());
+}
+
 BOOST_AUTO_TEST_CASE(query_confirmed__find_strong__unconfirmed_duplicate__expected)
 {
     settings settings{};
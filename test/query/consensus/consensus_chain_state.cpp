@@ -98,4 +98,66 @@ BOOST_AUTO_TEST_CASE(query_consensus__get_candidate_chain_state__block1__expecte
     BOOST_REQUIRE(state->context() == expected);
 }
 
+BOOST_AUTO_TEST_CASE(query_consensus__get_candidate_chain_state__fields_cache_block1__expected)
+{
+    const system::settings system_settings{ system::chain::selection::mainnet };
+    const database::context context{ 16523u, 1u, test::genesis.header().timestamp() };
+
+    database::settings database_settings{};
+    database_settings.path = TEST_DIRECTORY;
+    database_settings.fields_cache = true;
+    test::chunk_store store{ database_settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, context, true, false));
+    BOOST_REQUIRE(query.push_candidate(query.to_header(test::block1.hash())));
+    BOOST_REQUIRE_EQUAL(store.candidate_fields.count(), 2u);
+
+    const auto cached = query.get_candidate_chain_state(system_settings);
+    BOOST_REQUIRE(cached);
+
+    store.candidate_fields.clear();
+    const auto uncached = query.get_candidate_chain_state(system_settings);
+    BOOST_REQUIRE(uncached);
+    BOOST_REQUIRE(cached->context() == uncached->context());
+    BOOST_REQUIRE_EQUAL(cached->cumulative_work(), uncached->cumulative_work());
+
+    // Rebuilt from the candidate index.
+    BOOST_REQUIRE(query.initialize_fields_cache());
+    BOOST_REQUIRE_EQUAL(store.candidate_fields.count(), 2u);
+
+    // Pop uncaches the top candidate.
+    BOOST_REQUIRE(query.pop_candidate());
+    BOOST_REQUIRE_EQUAL(store.candidate_fields.count(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(query_consensus__get_chain_state__fields_cache_non_candidate__expected)
+{
+    const system::settings system_settings{ system::chain::selection::mainnet };
+    const auto mtp = test::genesis.header().timestamp();
+
+    database::settings database_settings{};
+    database_settings.path = TEST_DIRECTORY;
+    database_settings.fields_cache = true;
+    test::chunk_store store{ database_settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1, database::context{ 16523u, 1u, mtp }, true, false));
+    BOOST_REQUIRE(query.set(test::block2, database::context{ 16523u, 2u, mtp }, true, false));
+    BOOST_REQUIRE(query.push_candidate(query.to_header(test::block1.hash())));
+
+    // block2 is not candidate, its ancestry is read from the cache.
+    const auto cached = query.get_chain_state(system_settings, test::block2.hash());
+    BOOST_REQUIRE(cached);
+    BOOST_REQUIRE_EQUAL(cached->height(), 2u);
+
+    store.candidate_fields.clear();
+    const auto uncached = query.get_chain_state(system_settings, test::block2.hash());
+    BOOST_REQUIRE(uncached);
+    BOOST_REQUIRE(cached->context() == uncached->context());
+    BOOST_REQUIRE_EQUAL(cached->cumulative_work(), uncached->cumulative_work());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -45,12 +45,13 @@ BOOST_AUTO_TEST_CASE(query_extent__body_sizes__genesis__expected)
     BOOST_REQUIRE_EQUAL(query.point_body_size(), schema::point::minrow);
     BOOST_REQUIRE_EQUAL(query.ins_body_size(), schema::ins::minrow);
     BOOST_REQUIRE_EQUAL(query.outs_body_size(), schema::outs::minrow);
+    BOOST_REQUIRE_EQUAL(query.spend_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.txs_body_size(), add1(schema::txs::minrow));
     BOOST_REQUIRE_EQUAL(query.tx_body_size(), schema::transaction::minrow);
 
     BOOST_REQUIRE_EQUAL(query.candidate_body_size(), schema::height::minrow);
     BOOST_REQUIRE_EQUAL(query.confirmed_body_size(), schema::height::minrow);
-    BOOST_REQUIRE_EQUAL(query.strong_tx_body_size(), schema::strong_tx::minrow);
+    BOOST_REQUIRE_EQUAL(query.strong_tx_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.ecdsa_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.schnorr_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.silent_body_size(), zero);
@@ -59,8 +60,13 @@ BOOST_AUTO_TEST_CASE(query_extent__body_sizes__genesis__expected)
     BOOST_REQUIRE_EQUAL(query.prevout_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.validated_bk_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.validated_tx_body_size(), zero);
+    BOOST_REQUIRE_EQUAL(query.fee_tx_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.filter_bk_body_size(), schema::filter_bk::minrow);
     BOOST_REQUIRE_EQUAL(query.filter_tx_body_size(), 5u);
+    BOOST_REQUIRE_EQUAL(query.fee_bk_body_size(), zero);
+    BOOST_REQUIRE_EQUAL(query.summary_body_size(), zero);
+    BOOST_REQUIRE_EQUAL(query.touched_body_size(), zero);
+    BOOST_REQUIRE_EQUAL(query.activity_body_size(), zero);
     BOOST_REQUIRE_EQUAL(query.address_body_size(), schema::address::minrow);
 }
 
@@ -75,6 +81,7 @@ BOOST_AUTO_TEST_CASE(query_extent__buckets__genesis__expected)
 
     BOOST_REQUIRE_EQUAL(query.header_buckets(), 128u);
     BOOST_REQUIRE_EQUAL(query.point_buckets(), 128u);
+    BOOST_REQUIRE_EQUAL(query.spend_buckets(), 0u);
     BOOST_REQUIRE_EQUAL(query.txs_buckets(), 128u);
     BOOST_REQUIRE_EQUAL(query.tx_buckets(), 128u);
 
@@ -83,11 +90,36 @@ BOOST_AUTO_TEST_CASE(query_extent__buckets__genesis__expected)
     BOOST_REQUIRE_EQUAL(query.prevout_buckets(), 128);
     BOOST_REQUIRE_EQUAL(query.validated_tx_buckets(), 128u);
     BOOST_REQUIRE_EQUAL(query.validated_bk_buckets(), 128u);
+    BOOST_REQUIRE_EQUAL(query.fee_tx_buckets(), 0u);
     BOOST_REQUIRE_EQUAL(query.filter_tx_buckets(), 128u);
     BOOST_REQUIRE_EQUAL(query.filter_bk_buckets(), 128u);
+    BOOST_REQUIRE_EQUAL(query.fee_bk_buckets(), 0u);
+    BOOST_REQUIRE_EQUAL(query.summary_buckets(), 0u);
+    BOOST_REQUIRE_EQUAL(query.touched_buckets(), 0u);
+    BOOST_REQUIRE_EQUAL(query.activity_buckets(), 0u);
     BOOST_REQUIRE_EQUAL(query.address_buckets(), 128u);
 }
 
+BOOST_AUTO_TEST_CASE(query_extent__get_statistics__genesis__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    hash_statistics statistics{};
+    BOOST_REQUIRE(query.get_statistics(statistics, table_t::tx_table, max_size_t));
+    BOOST_REQUIRE_EQUAL(statistics.buckets, query.tx_buckets());
+    BOOST_REQUIRE_EQUAL(statistics.elements, 1u);
+    BOOST_REQUIRE_EQUAL(statistics.longest, 1u);
+    BOOST_REQUIRE_EQUAL(statistics.chains.at(1), 1u);
+    BOOST_REQUIRE_EQUAL(statistics.lookups, 1u);
+    BOOST_REQUIRE_EQUAL(statistics.probes, 1u);
+    BOOST_REQUIRE(!query.get_statistics(statistics, table_t::ins_table, max_size_t));
+}
+
 BOOST_AUTO_TEST_CASE(query_extent__records__genesis__expected)
 {
     settings settings{};
@@ -104,7 +136,6 @@ BOOST_AUTO_TEST_CASE(query_extent__records__genesis__expected)
 
     BOOST_REQUIRE_EQUAL(query.candidate_records(), one);
     BOOST_REQUIRE_EQUAL(query.confirmed_records(), one);
-    BOOST_REQUIRE_EQUAL(query.strong_tx_records(), one);
     BOOST_REQUIRE_EQUAL(query.ecdsa_records(), zero);
     BOOST_REQUIRE_EQUAL(query.schnorr_records(), zero);
     BOOST_REQUIRE_EQUAL(query.silent_records(), zero);
@@ -172,4 +203,122 @@ BOOST_AUTO_TEST_CASE(query_extent__filter_enabled__disabled__false)
     BOOST_REQUIRE(!query.filter_enabled());
 }
 
+BOOST_AUTO_TEST_CASE(query_extent__histogram_enabled__default__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(!query.histogram_enabled());
+}
+
+BOOST_AUTO_TEST_CASE(query_extent__histogram_enabled__enabled__true)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.fee_bk_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.histogram_enabled());
+}
+
+BOOST_AUTO_TEST_CASE(query_extent__summary_enabled__default__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(!query.summary_enabled());
+}
+
+BOOST_AUTO_TEST_CASE(query_extent__summary_enabled__enabled__true)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.summary_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.summary_enabled());
+}
+
+BOOST_AUTO_TEST_CASE(query_extent__touched_enabled__default__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(!query.touched_enabled());
+}
+
+BOOST_AUTO_TEST_CASE(query_extent__touched_enabled__enabled__true)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.touched_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.touched_enabled());
+}
+
+BOOST_AUTO_TEST_CASE(query_extent__activity_enabled__default__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(!query.activity_enabled());
+}
+
+BOOST_AUTO_TEST_CASE(query_extent__activity_enabled__enabled__true)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.activity_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.activity_enabled());
+
+    // Genesis confirmation appends the activity of its output address.
+    BOOST_REQUIRE_EQUAL(query.activity_records(), one);
+}
+
+BOOST_AUTO_TEST_CASE(query_extent__spend_enabled__default__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(!query.spend_enabled());
+}
+
+BOOST_AUTO_TEST_CASE(query_extent__spend_enabled__enabled__true)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.spend_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.spend_enabled());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -20,6 +20,8 @@
 #include "../mocks/blocks.hpp"
 #include "../mocks/chunk_store.hpp"
 
+#include <thread>
+
 // TODO:
 // get_tx_virtual_size
 // get_block_virtual_size
@@ -132,6 +134,75 @@ BOOST_AUTO_TEST_CASE(query_fee_rate__get_tx_fee__valid_non_coinbase__expected)
     BOOST_CHECK_EQUAL(rate.fee, test::tx2b.fee());
 }
 
+BOOST_AUTO_TEST_CASE(query_fee_rate__get_tx_fees__valid_non_coinbase__not_persisted)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.fee_tx_buckets = 128;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1b, test::context, false, false));
+    BOOST_CHECK(query.set(test::block_valid_spend_internal_2b, test::context, false, false));
+    BOOST_CHECK(query.fee_enabled());
+    BOOST_CHECK(store.fee_tx_body().empty());
+
+    // Computation does not persist the fee rate (only connection persists).
+    fee_rate rate{};
+    BOOST_CHECK(query.get_tx_fees(rate, 2));
+    BOOST_CHECK(store.fee_tx_body().empty());
+    BOOST_CHECK_EQUAL(rate.bytes, test::tx2b.virtual_size());
+    BOOST_CHECK_EQUAL(rate.fee, test::tx2b.fee());
+}
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__get_tx_fees__connected__persisted_fee)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.fee_tx_buckets = 128;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1b, test::context, false, false));
+    BOOST_CHECK(query.set(test::block_valid_spend_internal_2b, test::context, false, false));
+
+    // Connection persists the validated fee (distinct here to prove the read).
+    BOOST_CHECK(query.set_tx_connected(2, test::context, 42, 0));
+    BOOST_CHECK_EQUAL(store.fee_tx_body().size(), schema::fee_tx::minrow);
+
+    fee_rate rate{};
+    BOOST_CHECK(query.get_tx_fees(rate, 2));
+    BOOST_CHECK_EQUAL(rate.bytes, test::tx2b.virtual_size());
+    BOOST_CHECK_EQUAL(rate.fee, 42u);
+
+    // Coinbase is not persisted.
+    BOOST_CHECK(query.set_tx_connected(0, test::context, 0, 0));
+    BOOST_CHECK_EQUAL(store.fee_tx_body().size(), schema::fee_tx::minrow);
+    BOOST_CHECK(!query.get_tx_fees(rate, 0));
+}
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__get_tx_fees__default__not_persisted)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1b, test::context, false, false));
+    BOOST_CHECK(query.set(test::block_valid_spend_internal_2b, test::context, false, false));
+    BOOST_CHECK(!query.fee_enabled());
+
+    BOOST_CHECK(query.set_tx_connected(2, test::context, 42, 0));
+
+    fee_rate rate{};
+    BOOST_CHECK(query.get_tx_fees(rate, 2));
+    BOOST_CHECK_EQUAL(rate.fee, test::tx2b.fee());
+    BOOST_CHECK(store.fee_tx_body().empty());
+}
+
 // get_block_fee
 // get_block_fees
 // get_block_value
@@ -453,4 +524,244 @@ BOOST_AUTO_TEST_CASE(query_fee_rate__get_branch_fees__cancel_three_blocks__false
     BOOST_CHECK(rates_sets.empty());
 }
 
+
+// fee histograms
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__set_fee_histogram__disabled__true_not_persisted)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(!query.histogram_enabled());
+    BOOST_CHECK(query.set_fee_histogram(0));
+    BOOST_CHECK(store.fee_bk_body().empty());
+
+    fee_histogram out{};
+    BOOST_CHECK(!query.get_fee_histogram(out, 0));
+}
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__set_fee_histogram__genesis__empty_histogram)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.fee_bk_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.histogram_enabled());
+
+    fee_histogram out{};
+    BOOST_CHECK(!query.get_fee_histogram(out, 0));
+    BOOST_CHECK(query.set_fee_histogram(0));
+    BOOST_CHECK_EQUAL(store.fee_bk_body().size(), schema::fee_bk::minrow);
+    BOOST_CHECK(query.get_fee_histogram(out, 0));
+    BOOST_CHECK(out == fee_histogram{});
+
+    // Block-invariant, so not rewritten.
+    BOOST_CHECK(query.set_fee_histogram(0));
+    BOOST_CHECK_EQUAL(store.fee_bk_body().size(), schema::fee_bk::minrow);
+}
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__set_fee_histogram__missing_prevout__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.fee_bk_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1b, test::context, false, false));
+    BOOST_CHECK(query.set(test::block_missing_prevout_2b, test::context, false, false));
+    BOOST_CHECK(!query.set_fee_histogram(2));
+    BOOST_CHECK(store.fee_bk_body().empty());
+}
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__set_fee_histograms__confirmed_non_empty_blocks__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.fee_bk_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1b, test::context, false, false));
+    BOOST_CHECK(query.set(test::block_valid_spend_internal_2b, test::context, false, false));
+    BOOST_CHECK(query.push_confirmed(1, true));
+    BOOST_CHECK(query.push_confirmed(2, true));
+
+    std::atomic_bool cancel{};
+    fee_histograms out{};
+    BOOST_CHECK(!query.set_fee_histograms(cancel, 0, 4));
+    BOOST_CHECK(!query.get_fee_histograms(out, 0, 3));
+    BOOST_CHECK(out.empty());
+    BOOST_CHECK(query.set_fee_histograms(cancel, 0, 3));
+    BOOST_CHECK(query.get_fee_histograms(out, 0, 3));
+    BOOST_CHECK_EQUAL(out.size(), 3u);
+    BOOST_CHECK(out.at(0) == fee_histogram{});
+    BOOST_CHECK(out.at(1) == fee_histogram{});
+
+    // Rates are 15 (63 vbytes) and 1644 (107 vbytes) sat/kvB.
+    const auto& histogram = out.at(2);
+    BOOST_CHECK_EQUAL(histogram.weights.at(0), 63u);
+    BOOST_CHECK_EQUAL(histogram.weights.at(1), 107u);
+    BOOST_CHECK_EQUAL(histogram.minimum, 15u);
+    BOOST_CHECK_EQUAL(histogram.median, 1'644u);
+    BOOST_CHECK_EQUAL(histogram.maximum, 1'644u);
+
+    BOOST_CHECK(query.get_fee_histograms(out, 2, 1));
+    BOOST_CHECK_EQUAL(out.size(), 1u);
+    BOOST_CHECK(out.front() == histogram);
+    BOOST_CHECK(query.get_fee_histograms(out, 3, 0));
+    BOOST_CHECK(out.empty());
+}
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__set_fee_histograms__concurrent__written_once)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.fee_bk_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1b, test::context, false, false));
+    BOOST_CHECK(query.set(test::block_valid_spend_internal_2b, test::context, false, false));
+    BOOST_CHECK(query.push_confirmed(1, true));
+    BOOST_CHECK(query.push_confirmed(2, true));
+
+    // Concurrent backfill and per-block calls do not duplicate histograms.
+    std::atomic_bool cancel{};
+    std::atomic_bool success{ true };
+    std::vector<std::thread> threads{};
+    for (size_t thread{}; thread < 4u; ++thread)
+    {
+        threads.emplace_back([&]() NOEXCEPT
+        {
+            if (!query.set_fee_histograms(cancel, 0, 3) ||
+                !query.set_fee_histogram(query.to_confirmed(2)))
+                success.store(false);
+        });
+    }
+
+    for (auto& thread: threads)
+        thread.join();
+
+    BOOST_CHECK(success.load());
+    BOOST_CHECK_EQUAL(store.fee_bk_body().size(), 3u * schema::fee_bk::minrow);
+}
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__set_fee_histograms__cancel__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.fee_bk_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    std::atomic_bool cancel{ true };
+    BOOST_CHECK(!query.set_fee_histograms(cancel, 0, 1));
+    BOOST_CHECK(store.fee_bk_body().empty());
+}
+
+// set_block_fees
+// set_branch_fees
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__set_block_fees__disabled__true_not_persisted)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1b, test::context, false, false));
+    BOOST_CHECK(query.set(test::block_valid_spend_internal_2b, test::context, false, false));
+    BOOST_CHECK(!query.fee_enabled());
+    BOOST_CHECK(query.set_block_fees(2));
+    BOOST_CHECK(store.fee_tx_body().empty());
+}
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__set_block_fees__connected__unconnected_persisted_once)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.fee_tx_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1b, test::context, false, false));
+    BOOST_CHECK(query.set(test::block_valid_spend_internal_2b, test::context, false, false));
+
+    // Connection persists the validated fee (distinct here to prove the read).
+    BOOST_CHECK(query.set_tx_connected(3, test::context, 42, 0));
+    BOOST_CHECK_EQUAL(store.fee_tx_body().size(), schema::fee_tx::minrow);
+
+    // Backfill persists only the unconnected tx (first tx is skipped).
+    BOOST_CHECK(query.set_block_fees(2));
+    BOOST_CHECK_EQUAL(store.fee_tx_body().size(), two * schema::fee_tx::minrow);
+    BOOST_CHECK(query.set_block_fees(2));
+    BOOST_CHECK_EQUAL(store.fee_tx_body().size(), two * schema::fee_tx::minrow);
+
+    fee_rates rates{};
+    BOOST_CHECK(query.get_block_fees(rates, 2));
+    BOOST_CHECK_EQUAL(rates.size(), two);
+    BOOST_CHECK_EQUAL(rates.front().fee, 42u);
+
+    // Coinbase only block persists nothing.
+    BOOST_CHECK(query.set_block_fees(1));
+    BOOST_CHECK_EQUAL(store.fee_tx_body().size(), two * schema::fee_tx::minrow);
+}
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__set_branch_fees__confirmed__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.fee_tx_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+    BOOST_CHECK(query.set(test::block1b, test::context, false, false));
+    BOOST_CHECK(query.set(test::block_valid_spend_internal_2b, test::context, false, false));
+    BOOST_CHECK(query.push_confirmed(1, true));
+    BOOST_CHECK(query.push_confirmed(2, true));
+
+    std::atomic_bool cancel{};
+    BOOST_CHECK(!query.set_branch_fees(cancel, 0, 4));
+    BOOST_CHECK(store.fee_tx_body().empty());
+    BOOST_CHECK(query.set_branch_fees(cancel, 0, 3));
+    BOOST_CHECK_EQUAL(store.fee_tx_body().size(), two * schema::fee_tx::minrow);
+
+    // Branch fees are read from the persisted records (63 and 107 vbytes).
+    fee_rate_sets out{};
+    BOOST_CHECK(query.get_branch_fees(cancel, out, 2, 1));
+    BOOST_CHECK_EQUAL(out.size(), one);
+    BOOST_CHECK_EQUAL(out.front().size(), two);
+    BOOST_CHECK_EQUAL(out.front().front().bytes + out.front().back().bytes, 170u);
+}
+
+BOOST_AUTO_TEST_CASE(query_fee_rate__set_branch_fees__cancel__false)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.fee_tx_buckets = 8;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_CHECK(!store.create(test::events_handler));
+    BOOST_CHECK(query.initialize(test::genesis));
+
+    std::atomic_bool cancel{ true };
+    BOOST_CHECK(!query.set_branch_fees(cancel, 0, 1));
+    BOOST_CHECK(store.fee_tx_body().empty());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
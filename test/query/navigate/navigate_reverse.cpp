@@ -411,6 +411,72 @@ BOOST_AUTO_TEST_CASE(query_navigate__to_prevout_tx__to_prevout__expected)
 
 // to_spenders1
 // to_spenders2
+
+BOOST_AUTO_TEST_CASE(query_navigate__to_spenders__spend_index__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.spend_buckets = 128;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+    BOOST_REQUIRE(query.set(test::block1a, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.set(test::block2a, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(query.spend_enabled());
+
+    // Indexed spenders, each resolved without point search.
+    const point_links expected1{ 4u };
+    const point_links expected2{ 5u };
+    BOOST_REQUIRE_EQUAL(query.to_spenders(output_link{ 0x51u }), expected1);
+    BOOST_REQUIRE_EQUAL(query.to_spenders(output_link{ 0x51u + 7u }), expected2);
+    BOOST_REQUIRE(query.is_spent(0x51u));
+    BOOST_REQUIRE(query.is_spent(0x51u + 7u));
+
+    // Indexed spenders by tx and index, each resolved from one spend cell.
+    BOOST_REQUIRE_EQUAL(query.to_spenders(tx_link{ 1 }, 0u), expected1);
+    BOOST_REQUIRE_EQUAL(query.to_spenders(tx_link{ 1 }, 1u), expected2);
+
+    // Genesis output is indexed and unspent.
+    BOOST_REQUIRE_EQUAL(query.to_spenders(output_link{ 0u }), point_links{});
+    BOOST_REQUIRE(!query.is_spent(0u));
+}
+
+BOOST_AUTO_TEST_CASE(query_navigate__to_spenders__spender_before_funder__expected)
+{
+    settings settings{};
+    settings.path = TEST_DIRECTORY;
+    settings.spend_buckets = 128;
+    test::chunk_store store{ settings };
+    test::query_accessor query{ store };
+    BOOST_REQUIRE(!store.create(test::events_handler));
+    BOOST_REQUIRE(query.initialize(test::genesis));
+
+    // Spenders are archived (as txs) before their funders.
+    for (const auto& tx: *test::block2a.transactions_ptr())
+        BOOST_REQUIRE(query.set(*tx));
+
+    BOOST_REQUIRE(query.set(test::block1a, context{ 0, 1, 0 }, false, false));
+
+    // Spend index (by output link and by tx) matches point search (by hash).
+    size_t spent{};
+    for (const auto& tx: *test::block1a.transactions_ptr())
+    {
+        const auto tx_fk = query.to_tx(tx->hash(false));
+        const auto outputs = query.to_outputs(tx_fk);
+        for (uint32_t index{}; index < outputs.size(); ++index)
+        {
+            const auto spenders = query.to_spenders(outputs.at(index));
+            BOOST_REQUIRE_EQUAL(spenders, query.to_spenders(tx_fk, index));
+            BOOST_REQUIRE_EQUAL(spenders, query.to_spenders(tx->hash(false), index));
+            BOOST_REQUIRE_EQUAL(query.is_spent(outputs.at(index)), !spenders.empty());
+            spent += spenders.size();
+        }
+    }
+
+    BOOST_REQUIRE_EQUAL(spent, 2u);
+}
+
 // to_duplicates
 
 // to_block
@@ -26,6 +26,15 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
     BOOST_REQUIRE_EQUAL(configuration.turbo, false);
     BOOST_REQUIRE_EQUAL(configuration.mark_unconfirmable, true);
     BOOST_REQUIRE_EQUAL(configuration.interval_depth, 255u);
+    BOOST_REQUIRE_EQUAL(configuration.concurrent_files, true);
+    BOOST_REQUIRE_EQUAL(configuration.incremental_snapshot, false);
+    BOOST_REQUIRE_EQUAL(configuration.snapshot_bytes, 268435456u);
+    BOOST_REQUIRE_EQUAL(configuration.writeback_bytes, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.rehash_range, 4096u);
+    BOOST_REQUIRE_EQUAL(configuration.header_cache, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.tx_cache, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.strong_cache, false);
+    BOOST_REQUIRE_EQUAL(configuration.fields_cache, false);
     BOOST_REQUIRE_EQUAL(configuration.path, "bitcoin");
 
     // Archives.
@@ -35,17 +44,32 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
     BOOST_REQUIRE_EQUAL(configuration.point_buckets, 128u);
     BOOST_REQUIRE_EQUAL(configuration.point_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.point_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.point_reserve, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.point_resident, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.point_head_huge, false);
+    BOOST_REQUIRE_EQUAL(configuration.point_head_populate, false);
+    BOOST_REQUIRE_EQUAL(configuration.point_head_lock, false);
     BOOST_REQUIRE_EQUAL(configuration.input_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.input_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.input_reserve, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.input_resident, 0u);
     BOOST_REQUIRE_EQUAL(configuration.output_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.output_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.output_reserve, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.output_resident, 0u);
     BOOST_REQUIRE_EQUAL(configuration.ins_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.ins_rate, 50u);
     BOOST_REQUIRE_EQUAL(configuration.outs_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.outs_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.spend_buckets, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.spend_size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.spend_rate, 50u);
     BOOST_REQUIRE_EQUAL(configuration.tx_buckets, 128u);
     BOOST_REQUIRE_EQUAL(configuration.tx_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.tx_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.tx_head_huge, false);
+    BOOST_REQUIRE_EQUAL(configuration.tx_head_populate, false);
+    BOOST_REQUIRE_EQUAL(configuration.tx_head_lock, false);
     BOOST_REQUIRE_EQUAL(configuration.txs_buckets, 128u);
     BOOST_REQUIRE_EQUAL(configuration.txs_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.txs_rate, 50u);
@@ -80,17 +104,35 @@ BOOST_AUTO_TEST_CASE(settings__construct__default__expected)
     BOOST_REQUIRE_EQUAL(configuration.validated_tx_buckets, 128u);
     BOOST_REQUIRE_EQUAL(configuration.validated_tx_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.validated_tx_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.fee_tx_buckets, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.fee_tx_size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.fee_tx_rate, 50u);
 
     // Optionals.
     BOOST_REQUIRE_EQUAL(configuration.address_buckets, 128u);
     BOOST_REQUIRE_EQUAL(configuration.address_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.address_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.address_head_huge, false);
+    BOOST_REQUIRE_EQUAL(configuration.address_head_populate, false);
+    BOOST_REQUIRE_EQUAL(configuration.address_head_lock, false);
     BOOST_REQUIRE_EQUAL(configuration.filter_bk_buckets, 128u);
     BOOST_REQUIRE_EQUAL(configuration.filter_bk_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.filter_bk_rate, 50u);
     BOOST_REQUIRE_EQUAL(configuration.filter_tx_buckets, 128u);
     BOOST_REQUIRE_EQUAL(configuration.filter_tx_size, 1u);
     BOOST_REQUIRE_EQUAL(configuration.filter_tx_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.fee_bk_buckets, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.fee_bk_size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.fee_bk_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.summary_buckets, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.summary_size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.summary_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.touched_buckets, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.touched_size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.touched_rate, 50u);
+    BOOST_REQUIRE_EQUAL(configuration.activity_buckets, 0u);
+    BOOST_REQUIRE_EQUAL(configuration.activity_size, 1u);
+    BOOST_REQUIRE_EQUAL(configuration.activity_rate, 50u);
 }
 
 BOOST_AUTO_TEST_SUITE_END()
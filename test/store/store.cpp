@@ -126,6 +126,8 @@ BOOST_AUTO_TEST_CASE(store__paths__default_configuration__expected)
     BOOST_REQUIRE_EQUAL(instance.point_body_file(), "bitcoin/archive_point.data");
     BOOST_REQUIRE_EQUAL(instance.outs_head_file(), "bitcoin/heads/archive_outs.head");
     BOOST_REQUIRE_EQUAL(instance.outs_body_file(), "bitcoin/archive_outs.data");
+    BOOST_REQUIRE_EQUAL(instance.spend_head_file(), "bitcoin/heads/archive_spend.head");
+    BOOST_REQUIRE_EQUAL(instance.spend_body_file(), "bitcoin/archive_spend.data");
     BOOST_REQUIRE_EQUAL(instance.tx_head_file(), "bitcoin/heads/archive_tx.head");
     BOOST_REQUIRE_EQUAL(instance.tx_body_file(), "bitcoin/archive_tx.data");
     BOOST_REQUIRE_EQUAL(instance.txs_head_file(), "bitcoin/heads/archive_txs.head");
@@ -146,6 +148,8 @@ BOOST_AUTO_TEST_CASE(store__paths__default_configuration__expected)
     BOOST_REQUIRE_EQUAL(instance.prevout_body_file(), "bitcoin/cache_prevout.data");
     BOOST_REQUIRE_EQUAL(instance.validated_tx_head_file(), "bitcoin/heads/validated_tx.head");
     BOOST_REQUIRE_EQUAL(instance.validated_tx_body_file(), "bitcoin/validated_tx.data");
+    BOOST_REQUIRE_EQUAL(instance.fee_tx_head_file(), "bitcoin/heads/fee_tx.head");
+    BOOST_REQUIRE_EQUAL(instance.fee_tx_body_file(), "bitcoin/fee_tx.data");
 
     /// Option.
     BOOST_REQUIRE_EQUAL(instance.address_head_file(), "bitcoin/heads/option_address.head");
@@ -154,6 +158,14 @@ BOOST_AUTO_TEST_CASE(store__paths__default_configuration__expected)
     BOOST_REQUIRE_EQUAL(instance.filter_bk_body_file(), "bitcoin/option_filter_bk.data");
     BOOST_REQUIRE_EQUAL(instance.filter_tx_head_file(), "bitcoin/heads/option_filter_tx.head");
     BOOST_REQUIRE_EQUAL(instance.filter_tx_body_file(), "bitcoin/option_filter_tx.data");
+    BOOST_REQUIRE_EQUAL(instance.fee_bk_head_file(), "bitcoin/heads/option_fee_bk.head");
+    BOOST_REQUIRE_EQUAL(instance.fee_bk_body_file(), "bitcoin/option_fee_bk.data");
+    BOOST_REQUIRE_EQUAL(instance.summary_head_file(), "bitcoin/heads/option_summary.head");
+    BOOST_REQUIRE_EQUAL(instance.summary_body_file(), "bitcoin/option_summary.data");
+    BOOST_REQUIRE_EQUAL(instance.touched_head_file(), "bitcoin/heads/option_touched.head");
+    BOOST_REQUIRE_EQUAL(instance.touched_body_file(), "bitcoin/option_touched.data");
+    BOOST_REQUIRE_EQUAL(instance.activity_head_file(), "bitcoin/heads/option_activity.head");
+    BOOST_REQUIRE_EQUAL(instance.activity_body_file(), "bitcoin/option_activity.data");
 
     /// Lock.
     BOOST_REQUIRE_EQUAL(instance.flush_lock_file(), "bitcoin/flush.lock");
@@ -17,6 +17,7 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include "../mocks/blocks.hpp"
 #include "../mocks/map_store.hpp"
 
 // these include the slow tests (mmap)
@@ -97,4 +98,35 @@ BOOST_AUTO_TEST_CASE(store__open__created__success)
     BOOST_REQUIRE(!instance.close(test::events));
 }
 
+BOOST_AUTO_TEST_CASE(store__open__strong_tx_body_records__migrated)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    test::map_store instance{ configuration };
+    query<store<database::mmap>> query_{ instance };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(query_.initialize(test::genesis));
+    BOOST_REQUIRE(!instance.close(test::events));
+
+    // Prior (hashmap) layout wrote strong_tx body records.
+    BOOST_REQUIRE(test::create(instance.strong_tx_body_file(), "abcdefghijk"));
+
+    // Open succeeds with prior cells nullified, pending migration.
+    BOOST_REQUIRE(!instance.open(test::events));
+    BOOST_REQUIRE(instance.strong_tx.obsolete());
+    BOOST_REQUIRE(!query_.is_strong_block(0));
+
+    // Migration rebuilds from the confirmed index and drops the prior body.
+    BOOST_REQUIRE(query_.migrate_strong());
+    BOOST_REQUIRE(!instance.strong_tx.obsolete());
+    BOOST_REQUIRE(query_.is_strong_block(0));
+    BOOST_REQUIRE(query_.migrate_strong());
+    BOOST_REQUIRE(!instance.close(test::events));
+
+    BOOST_REQUIRE(!instance.open(test::events));
+    BOOST_REQUIRE(!instance.strong_tx.obsolete());
+    BOOST_REQUIRE(query_.is_strong_block(0));
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../mocks/blocks.hpp"
+#include "../mocks/map_store.hpp"
+
+// these include the slow tests (mmap)
+
+BOOST_FIXTURE_TEST_SUITE(store_tests, test::directory_setup_fixture)
+
+// rehash
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(store__rehash__unsupported_table__rehash_table)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<database::mmap> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE_EQUAL(instance.rehash(table_t::header_table, 42, test::events), error::rehash_table);
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__rehash__tx_table__found_after_reopen)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.rehash_range = 3;
+    store<database::mmap> instance{ configuration };
+    query<store<database::mmap>> query_{ instance };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(query_.initialize(test::genesis));
+
+    const auto hash = test::genesis.transactions_ptr()->front()->hash(false);
+    const auto link = query_.to_tx(hash);
+    BOOST_REQUIRE(!link.is_terminal());
+
+    BOOST_REQUIRE(!instance.rehash(table_t::tx_table, 7, test::events));
+    BOOST_REQUIRE_EQUAL(instance.tx.buckets(), 7u);
+    BOOST_REQUIRE_EQUAL(query_.to_tx(hash), link);
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(!instance.close(test::events));
+
+    // Rehashed bucket count supersedes configured bucket count.
+    BOOST_REQUIRE(!instance.open(test::events));
+    BOOST_REQUIRE_EQUAL(instance.tx.buckets(), 7u);
+    BOOST_REQUIRE_EQUAL(query_.to_tx(hash), link);
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__rehash__tx_table__incremental_snapshot_restores)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.incremental_snapshot = true;
+    test::map_store instance{ configuration };
+    query<store<database::mmap>> query_{ instance };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(query_.initialize(test::genesis));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(!instance.rehash(table_t::tx_table, 7, test::events));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+
+    // Tx head writes following rehash must be patched into later snapshots.
+    const auto hash = test::block1.transactions_ptr()->front()->hash(false);
+    BOOST_REQUIRE(query_.set(test::block1, context{ 0, 1, 0 }, false, false));
+    const auto link = query_.to_tx(hash);
+    BOOST_REQUIRE(!link.is_terminal());
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(!instance.close(test::events));
+
+    // Restore heads from the last (incremental) snapshot.
+    BOOST_REQUIRE(test::create(test::flush_lock_file(configuration.path)));
+    BOOST_REQUIRE(!instance.restore(test::events));
+    BOOST_REQUIRE_EQUAL(instance.tx.buckets(), 7u);
+    BOOST_REQUIRE_EQUAL(query_.to_tx(hash), link);
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__rehash__point_table__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<database::mmap> instance{ configuration };
+    query<store<database::mmap>> query_{ instance };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(query_.initialize(test::genesis));
+    BOOST_REQUIRE(!instance.rehash(table_t::point_table, 42, test::events));
+    BOOST_REQUIRE_EQUAL(instance.point.buckets(), 42u);
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -17,7 +17,32 @@
  * along with this program.  If not, see <http://www.gnu.org/licenses/>.
  */
 #include "../test.hpp"
+#include "../mocks/blocks.hpp"
+#include "../mocks/map_store.hpp"
 
 BOOST_FIXTURE_TEST_SUITE(store_tests, test::directory_setup_fixture)
 
+BOOST_AUTO_TEST_CASE(store__report_statistics__genesis__hash_tables)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<database::mmap> instance{ configuration };
+    query<store<database::mmap>> query_{ instance };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(query_.initialize(test::genesis));
+
+    size_t tables{};
+    size_t elements{};
+    instance.report([&](const hash_statistics& statistics, table_t table) NOEXCEPT
+    {
+        ++tables;
+        if (table == table_t::header_table)
+            elements = statistics.elements;
+    }, 100);
+
+    BOOST_REQUIRE_EQUAL(tables, 7u);
+    BOOST_REQUIRE_EQUAL(elements, 1u);
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
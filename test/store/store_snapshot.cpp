@@ -20,6 +20,8 @@
 #include "../mocks/blocks.hpp"
 #include "../mocks/map_store.hpp"
 
+#include <fstream>
+
  // these include the slow tests (mmap)
 
 BOOST_FIXTURE_TEST_SUITE(store_tests, test::directory_setup_fixture)
@@ -27,12 +29,13 @@ BOOST_FIXTURE_TEST_SUITE(store_tests, test::directory_setup_fixture)
 // snapshot
 // ----------------------------------------------------------------------------
 
-BOOST_AUTO_TEST_CASE(store__snapshot__uncreated__flush_unloaded)
+// Body counts are captured (from heads) before bodies are flushed.
+BOOST_AUTO_TEST_CASE(store__snapshot__uncreated__backup_table)
 {
     settings configuration{};
     configuration.path = TEST_DIRECTORY;
     store<database::mmap> instance{ configuration };
-    BOOST_REQUIRE_EQUAL(instance.snapshot(test::events), error::flush_unloaded);
+    BOOST_REQUIRE_EQUAL(instance.snapshot(test::events), error::backup_table);
 }
 
 BOOST_AUTO_TEST_CASE(store__snapshot__opened__success)
@@ -45,4 +48,134 @@ BOOST_AUTO_TEST_CASE(store__snapshot__opened__success)
     BOOST_REQUIRE(!instance.close(test::events));
 }
 
+BOOST_AUTO_TEST_CASE(store__snapshot__sequential_files__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.concurrent_files = false;
+    store<database::mmap> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__snapshot__incremental_repeated__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.incremental_snapshot = true;
+    store<database::mmap> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(test::events));
+
+    // Third snapshot patches the recycled first (secondary) snapshot.
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(test::folder(configuration.path / schema::dir::primary));
+    BOOST_REQUIRE(test::folder(configuration.path / schema::dir::secondary));
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__snapshot__incremental_writes_between__restores_heads)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.incremental_snapshot = true;
+    test::map_store instance{ configuration };
+    query<store<database::mmap>> query_{ instance };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(query_.initialize(test::genesis));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+
+    // Second snapshot is full (secondary), third patches the first's pages.
+    BOOST_REQUIRE(query_.set(test::block1, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(query_.set(test::block2, context{ 0, 2, 0 }, false, false));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(!instance.close(test::events));
+
+    // The patched snapshot heads are identical to the closed (full) heads.
+    const auto read = [](const std::filesystem::path& file) NOEXCEPT
+    {
+        std::ifstream stream{ file, std::ios::binary };
+        return std::string{ std::istreambuf_iterator<char>{ stream }, {} };
+    };
+
+    const auto primary = configuration.path / schema::dir::primary;
+    for (const auto& file: { instance.header_head_file(),
+        instance.point_head_file(), instance.tx_head_file(),
+        instance.txs_head_file() })
+    {
+        const auto closed = read(file);
+        BOOST_REQUIRE(!closed.empty());
+        BOOST_REQUIRE_EQUAL(read(primary / file.filename()), closed);
+    }
+
+    // Restore heads from the last (incremental) snapshot.
+    BOOST_REQUIRE(test::create(test::flush_lock_file(configuration.path)));
+    BOOST_REQUIRE(!instance.restore(test::events));
+    BOOST_REQUIRE(!query_.to_header(test::genesis.hash()).is_terminal());
+    BOOST_REQUIRE(!query_.to_header(test::block1.hash()).is_terminal());
+    BOOST_REQUIRE(!query_.to_header(test::block2.hash()).is_terminal());
+    for (const auto& tx: *test::block2.transactions_ptr())
+        BOOST_REQUIRE(!query_.to_tx(tx->hash(false)).is_terminal());
+
+    BOOST_REQUIRE(query_.is_associated(query_.to_header(test::block1.hash())));
+    BOOST_REQUIRE(query_.is_associated(query_.to_header(test::block2.hash())));
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__snapshot__zero_capture_bytes__staged_restores)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.snapshot_bytes = 0;
+    test::map_store instance{ configuration };
+    BOOST_REQUIRE(!instance.create(test::events));
+
+    // All heads are staged, and then moved to /primary.
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(test::folder(configuration.path / schema::dir::primary));
+    BOOST_REQUIRE(test::folder(configuration.path / schema::dir::secondary));
+    BOOST_REQUIRE(test::exists(configuration.path / schema::dir::primary /
+        (std::string{ schema::archive::header } + schema::ext::head)));
+    BOOST_REQUIRE(!test::exists(configuration.path / schema::dir::heads /
+        (std::string{ schema::archive::header } + schema::ext::staged)));
+    BOOST_REQUIRE(!instance.close(test::events));
+
+    BOOST_REQUIRE(test::create(test::flush_lock_file(configuration.path)));
+    BOOST_REQUIRE(!instance.restore(test::events));
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__snapshot__opened__reports_flushed_body_timing)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<database::mmap> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+
+    size_t flushed{};
+    auto header_body{ false };
+    instance.report_timing([&](const auto&, table_t table) NOEXCEPT
+    {
+        ++flushed;
+        header_body |= (table == table_t::header_body);
+    });
+
+    // Each body file of the store is flushed (and timed) once.
+    size_t bodies{};
+    for (const auto& file: std::filesystem::directory_iterator(
+        configuration.path))
+        if (file.path().extension() == schema::ext::data)
+            ++bodies;
+
+    BOOST_REQUIRE(header_body);
+    BOOST_REQUIRE(!is_zero(bodies));
+    BOOST_REQUIRE_EQUAL(flushed, bodies);
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,123 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+#include "../mocks/blocks.hpp"
+#include "../mocks/map_store.hpp"
+
+BOOST_FIXTURE_TEST_SUITE(store_tests, test::directory_setup_fixture)
+
+// writeback
+// ----------------------------------------------------------------------------
+
+BOOST_AUTO_TEST_CASE(store__writeback__disabled_uncreated__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    store<database::mmap> instance{ configuration };
+    BOOST_REQUIRE(!instance.writeback(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__writeback__uncreated__flush_unloaded)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.writeback_bytes = 1;
+    store<database::mmap> instance{ configuration };
+    BOOST_REQUIRE_EQUAL(instance.writeback(test::events), error::flush_unloaded);
+}
+
+BOOST_AUTO_TEST_CASE(store__writeback__opened__success)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.writeback_bytes = 1;
+    store<database::mmap> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(!instance.writeback(test::events));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+    BOOST_REQUIRE(!instance.writeback(test::events));
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__writeback__below_threshold__deferred)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.writeback_bytes = max_size_t;
+    test::map_store instance{ configuration };
+    query<store<database::mmap>> query_{ instance };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(query_.initialize(test::genesis));
+    BOOST_REQUIRE(is_nonzero(instance.header_body_count()));
+    BOOST_REQUIRE(!instance.writeback(test::events));
+    BOOST_REQUIRE_EQUAL(instance.header_body_written(), zero);
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__writeback__at_threshold__written_advances)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.writeback_bytes = 1;
+    test::map_store instance{ configuration };
+    query<store<database::mmap>> query_{ instance };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(query_.initialize(test::genesis));
+    BOOST_REQUIRE_EQUAL(instance.header_body_written(), zero);
+    BOOST_REQUIRE(!instance.writeback(test::events));
+    BOOST_REQUIRE_EQUAL(instance.header_body_written(), instance.header_body_count());
+
+    // Appended rows are written back from the prior writeback.
+    BOOST_REQUIRE(query_.set(test::block1, context{ 0, 1, 0 }, false, false));
+    BOOST_REQUIRE_GT(instance.header_body_count(), instance.header_body_written());
+    BOOST_REQUIRE(!instance.writeback(test::events));
+    BOOST_REQUIRE_EQUAL(instance.header_body_written(), instance.header_body_count());
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_CASE(store__writeback__snapshotted__timing_unchanged)
+{
+    settings configuration{};
+    configuration.path = TEST_DIRECTORY;
+    configuration.writeback_bytes = 1;
+    store<database::mmap> instance{ configuration };
+    BOOST_REQUIRE(!instance.create(test::events));
+    BOOST_REQUIRE(!instance.snapshot(test::events));
+
+    using timing = std::vector<std::pair<table_t, store<database::mmap>::duration>>;
+    const auto report = [&]() NOEXCEPT
+    {
+        timing out{};
+        instance.report_timing([&](const auto& elapsed, table_t table) NOEXCEPT
+        {
+            out.emplace_back(table, elapsed);
+        });
+
+        std::sort(out.begin(), out.end());
+        return out;
+    };
+
+    // Background writeback does not accumulate into snapshot (flush) timing.
+    const auto snapshotted = report();
+    BOOST_REQUIRE(!instance.writeback(test::events));
+    BOOST_REQUIRE(report() == snapshotted);
+    BOOST_REQUIRE(!instance.close(test::events));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
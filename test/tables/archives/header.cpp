@@ -234,6 +234,13 @@ BOOST_AUTO_TEST_CASE(header__put__get_context__expected)
     BOOST_REQUIRE(check_context.ctx == expected.ctx);
     BOOST_REQUIRE_EQUAL(check_context.timestamp, expected.timestamp);
     BOOST_REQUIRE_EQUAL(check_context.key, key);
+
+    table::header::get_fields fields{};
+    BOOST_REQUIRE(instance.get(1, fields));
+    BOOST_REQUIRE_EQUAL(fields.mtp, expected.ctx.mtp);
+    BOOST_REQUIRE_EQUAL(fields.version, expected.version);
+    BOOST_REQUIRE_EQUAL(fields.timestamp, expected.timestamp);
+    BOOST_REQUIRE_EQUAL(fields.bits, expected.bits);
 }
 
 BOOST_AUTO_TEST_CASE(header__it__pk__expected)
@@ -0,0 +1,111 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(spend_tests)
+
+using namespace system;
+constexpr auto unindexed = table::spend::link::terminal;
+constexpr auto unspent = table::spend::point::terminal;
+constexpr auto multiple = 0x0000000100000000_u64;
+const table::spend::record spender1{ 0x01020304 };
+const table::spend::record spender2{ 0x00000010 };
+const table::spend::record spender3{ 0x00000005 };
+
+const auto expected_head = base16_chunk
+(
+    "0000000000ffffff" // body count (padded cell)
+    "ffffffffffffffff" // outs0 (unindexed)
+    "0403020100000000" // outs1 (spender1)
+    "0500000001000000" // outs2 (spender2 & spender3: lesser, multiple)
+    "ffffffff00000000" // outs3 (unspent)
+);
+
+BOOST_AUTO_TEST_CASE(spend__merge__unindexed__other)
+{
+    static_assert(table::spend::merge(unindexed, unindexed) == unindexed);
+    static_assert(table::spend::merge(unindexed, unspent) == unspent);
+    static_assert(table::spend::merge(unspent, unindexed) == unspent);
+    static_assert(table::spend::merge(unindexed, 42u) == 42u);
+    static_assert(table::spend::merge(42u, unindexed) == 42u);
+}
+
+BOOST_AUTO_TEST_CASE(spend__merge__unspent__other)
+{
+    static_assert(table::spend::merge(unspent, unspent) == unspent);
+    static_assert(table::spend::merge(unspent, 42u) == 42u);
+    static_assert(table::spend::merge(42u, unspent) == 42u);
+}
+
+BOOST_AUTO_TEST_CASE(spend__merge__spenders__lesser_multiple)
+{
+    static_assert(table::spend::merge(42u, 42u) == 42u);
+    static_assert(table::spend::merge(42u, 7u) == bit_or(multiple, 7u));
+    static_assert(table::spend::merge(7u, 42u) == bit_or(multiple, 7u));
+    static_assert(table::spend::merge(bit_or(multiple, 7u), 42u) == bit_or(multiple, 7u));
+    static_assert(table::spend::merge(bit_or(multiple, 42u), 7u) == bit_or(multiple, 7u));
+    static_assert(table::spend::merge(bit_or(multiple, 7u), 7u) == bit_or(multiple, 7u));
+}
+
+BOOST_AUTO_TEST_CASE(spend__put__merged__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::spend instance{ head_store, body_store, 2 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(1, spender1));
+    BOOST_REQUIRE(instance.put(1, table::spend::record{}));
+    BOOST_REQUIRE(instance.put(2, spender2));
+    BOOST_REQUIRE(instance.put(2, spender3));
+    BOOST_REQUIRE(instance.put(3, table::spend::record{}));
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
+    BOOST_REQUIRE(body_store.buffer().empty());
+    BOOST_REQUIRE(instance.close());
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
+}
+
+BOOST_AUTO_TEST_CASE(spend__find__merged__expected)
+{
+    auto head = expected_head;
+    test::chunk_storage head_store{ head };
+    test::chunk_storage body_store{};
+    table::spend instance{ head_store, body_store, 2 };
+
+    table::spend::record out{};
+    BOOST_REQUIRE(!instance.find(0u, out));
+    BOOST_REQUIRE(!instance.find(42u, out));
+
+    BOOST_REQUIRE(instance.find(1u, out));
+    BOOST_REQUIRE(!out.unspent());
+    BOOST_REQUIRE(!out.multiple());
+    BOOST_REQUIRE_EQUAL(out.point_fk(), 0x01020304u);
+
+    BOOST_REQUIRE(instance.find(2u, out));
+    BOOST_REQUIRE(!out.unspent());
+    BOOST_REQUIRE(out.multiple());
+    BOOST_REQUIRE_EQUAL(out.point_fk(), 0x00000005u);
+
+    BOOST_REQUIRE(instance.find(3u, out));
+    BOOST_REQUIRE(out.unspent());
+    BOOST_REQUIRE(!out.multiple());
+    BOOST_REQUIRE_EQUAL(out.point_fk(), unspent);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,96 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(fee_tx_tests)
+
+using namespace system;
+const table::fee_tx::record record1{ {}, 0x0102030405060708, 0x00abcd };
+const table::fee_tx::record record2{ {}, 0x000000000000002a, 0x000100 };
+const auto expected_head = base16_chunk
+(
+    "00000000"
+    "00000000"
+    "ffffffff"
+    "01000000"
+    "ffffffff"
+    "ffffffff"
+    "ffffffff"
+    "ffffffff"
+    "ffffffff"
+);
+const auto closed_head = base16_chunk
+(
+    "02000000"
+    "00000000"
+    "ffffffff"
+    "01000000"
+    "ffffffff"
+    "ffffffff"
+    "ffffffff"
+    "ffffffff"
+    "ffffffff"
+);
+const auto expected_body = base16_chunk
+(
+    "0807060504030201" // fee1
+    "cdab00"           // virtual_size1
+    "2a00000000000000" // fee2
+    "000100"           // virtual_size2
+);
+
+BOOST_AUTO_TEST_CASE(fee_tx__put__two__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::fee_tx instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+
+    BOOST_REQUIRE(instance.put(0, record1));
+    BOOST_REQUIRE_EQUAL(instance.at(0), 0u);
+    BOOST_REQUIRE(instance.put(2, record2));
+    BOOST_REQUIRE_EQUAL(instance.at(2), 1u);
+    BOOST_REQUIRE(instance.at(1).is_terminal());
+
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+    BOOST_REQUIRE(instance.close());
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), closed_head);
+}
+
+BOOST_AUTO_TEST_CASE(fee_tx__at__two__expected)
+{
+    auto head = expected_head;
+    auto body = expected_body;
+    test::chunk_storage head_store{ head };
+    test::chunk_storage body_store{ body };
+    table::fee_tx instance{ head_store, body_store, 8 };
+
+    table::fee_tx::record out{};
+    BOOST_REQUIRE(instance.at(0, out));
+    BOOST_REQUIRE(out == record1);
+    BOOST_REQUIRE(!instance.at(1, out));
+    BOOST_REQUIRE(instance.at(2, out));
+    BOOST_REQUIRE(out == record2);
+    BOOST_REQUIRE_EQUAL(out.fee, 42u);
+    BOOST_REQUIRE_EQUAL(out.virtual_size, 256u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
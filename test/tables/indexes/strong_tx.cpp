@@ -22,44 +22,34 @@
 BOOST_AUTO_TEST_SUITE(strong_tx_tests)
 
 using namespace system;
-const table::strong_tx::key key1{ 0x01, 0x02, 0x03, 0x04 };
-const table::strong_tx::key key2{ 0xa1, 0xa2, 0xa3, 0xa4 };
-const table::strong_tx::record strong1{ {}, table::strong_tx::merge(true, 0x0078f87f) };
-const table::strong_tx::record strong2{ {}, table::strong_tx::merge(false, 0x0078f87f) };
+const table::strong_tx::record strong1{ table::strong_tx::merge(true, 0x0078f87f) };
+const table::strong_tx::record strong2{ table::strong_tx::merge(false, 0x0078f87f) };
 
 const auto expected_head = base16_chunk
 (
-    "00000000"
-    "ffffffff"
-    "01000000"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
+    "00000000" // body count
+    "ffffffff" // tx0
+    "7ff8f800" // tx1: 0x0078f87f | 0x00800000
+    "ffffffff" // tx2
+    "7ff87800" // tx3: 0x0078f87f | 0x00000000
+    "ffffffff" // tx4
+    "ffffffff" // tx5
+    "ffffffff" // tx6
+    "ffffffff" // tx7
 );
-const auto closed_head = base16_chunk
+const auto expanded_head = base16_chunk
 (
-    "02000000"
-    "ffffffff"
-    "01000000"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
-    "ffffffff"
-);
-const auto expected_body = base16_chunk
-(
-    "ffffffff" // next->end
-    "01020304" // key1
-    "7ff8f8"   // 0x0078f87f | 0x00800000
-
-    "00000000" // next->
-    "a1a2a3a4" // key2
-    "7ff878"   // 0x0078f87f | 0x00000000
+    "00000000" // body count
+    "ffffffff" // tx0
+    "7ff8f800" // tx1
+    "ffffffff" // tx2
+    "7ff87800" // tx3
+    "ffffffff" // tx4
+    "ffffffff" // tx5
+    "ffffffff" // tx6
+    "ffffffff" // tx7
+    "ffffffff" // tx8 (fill)
+    "7ff8f800" // tx9
 );
 
 BOOST_AUTO_TEST_CASE(strong_tx__put__two__expected)
@@ -68,41 +58,61 @@ BOOST_AUTO_TEST_CASE(strong_tx__put__two__expected)
     test::chunk_storage body_store{};
     table::strong_tx instance{ head_store, body_store, 8 };
     BOOST_REQUIRE(instance.create());
-
-    table::strong_tx::link link1{};
-    BOOST_REQUIRE(instance.put_link(link1, key1, strong1));
-    BOOST_REQUIRE_EQUAL(link1, 0u);
-
-    table::strong_tx::link link2{};
-    BOOST_REQUIRE(instance.put_link(link2, key2, strong2));
-    BOOST_REQUIRE_EQUAL(link2, 1u);
-
+    BOOST_REQUIRE(instance.put(1, strong1));
+    BOOST_REQUIRE(instance.put(3, strong2));
     BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
-    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+    BOOST_REQUIRE(body_store.buffer().empty());
     BOOST_REQUIRE(instance.close());
-    BOOST_REQUIRE_EQUAL(head_store.buffer(), closed_head);
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
 }
 
-BOOST_AUTO_TEST_CASE(strong_tx__get__two__expected)
+BOOST_AUTO_TEST_CASE(strong_tx__put__beyond_buckets__expanded_and_filled)
 {
     auto head = expected_head;
-    auto body = expected_body;
     test::chunk_storage head_store{ head };
-    test::chunk_storage body_store{ body };
-    table::strong_tx instance{ head_store, body_store, 32 };
-    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
-    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+    test::chunk_storage body_store{};
+    table::strong_tx instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.put(9, strong1));
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expanded_head);
+    BOOST_REQUIRE_EQUAL(instance.buckets(), 10u);
+}
+
+BOOST_AUTO_TEST_CASE(strong_tx__find__two__expected)
+{
+    auto head = expected_head;
+    test::chunk_storage head_store{ head };
+    test::chunk_storage body_store{};
+    table::strong_tx instance{ head_store, body_store, 8 };
 
     table::strong_tx::record out{};
-    BOOST_REQUIRE(instance.get(0u, out));
+    BOOST_REQUIRE(!instance.find(0u, out));
+    BOOST_REQUIRE(!instance.find(2u, out));
+    BOOST_REQUIRE(!instance.find(42u, out));
+
+    BOOST_REQUIRE(instance.find(1u, out));
     BOOST_REQUIRE_EQUAL(out.header_fk(), strong1.header_fk());
     BOOST_REQUIRE_EQUAL(out.positive(), strong1.positive());
     BOOST_REQUIRE_EQUAL(out.signed_block_fk, bit_or(0x0078f87fu, 0x00800000u));
 
-    BOOST_REQUIRE(instance.get(1u, out));
+    BOOST_REQUIRE(instance.find(3u, out));
     BOOST_REQUIRE_EQUAL(out.header_fk(), strong2.header_fk());
     BOOST_REQUIRE_EQUAL(out.positive(), strong2.positive());
     BOOST_REQUIRE_EQUAL(out.signed_block_fk, bit_or(0x0078f87fu, 0x00000000u));
 }
 
+BOOST_AUTO_TEST_CASE(strong_tx__put__overwrite__last_state)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::strong_tx instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(1, strong1));
+    BOOST_REQUIRE(instance.put(1, strong2));
+
+    table::strong_tx::record out{};
+    BOOST_REQUIRE(instance.find(1u, out));
+    BOOST_REQUIRE(!out.positive());
+    BOOST_REQUIRE_EQUAL(out.header_fk(), 0x0078f87fu);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,124 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(activity_tests)
+
+using namespace system;
+const table::activity::key key1 = base16_array("100000000000000000000000000000000000000000000000000000000000000a");
+const table::activity::key key2 = base16_array("200000000000000000000000000000000000000000000000000000000000000b");
+const table::activity::record record1{ {}, 0x123456, 0x01020304 };
+const table::activity::record record2{ {}, 7, 0x2a };
+const auto expected_head = base16_chunk
+(
+    "0000000000"
+    "0100000000"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+);
+const auto closed_head = base16_chunk
+(
+    "0200000000"
+    "0100000000"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+);
+const auto expected_body = base16_chunk
+(
+    "ffffffffff" // next->end
+    "100000000000000000000000000000000000000000000000000000000000000a" // key1
+    "563412"     // height1
+    "04030201"   // tx1
+
+    "0000000000" // next->0
+    "200000000000000000000000000000000000000000000000000000000000000b" // key2
+    "070000"     // height2
+    "2a000000"   // tx2
+);
+
+BOOST_AUTO_TEST_CASE(activity__put__two__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::activity instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+
+    table::activity::link link1{};
+    BOOST_REQUIRE(instance.put_link(link1, key1, record1));
+    BOOST_REQUIRE_EQUAL(link1, 0u);
+
+    table::activity::link link2{};
+    BOOST_REQUIRE(instance.put_link(link2, key2, record2));
+    BOOST_REQUIRE_EQUAL(link2, 1u);
+
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+    BOOST_REQUIRE(instance.close());
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), closed_head);
+}
+
+BOOST_AUTO_TEST_CASE(activity__get__two__expected)
+{
+    auto head = expected_head;
+    auto body = expected_body;
+    test::chunk_storage head_store{ head };
+    test::chunk_storage body_store{ body };
+    table::activity instance{ head_store, body_store, 8 };
+
+    table::activity::record out{};
+    BOOST_REQUIRE(instance.get(0, out));
+    BOOST_REQUIRE(out == record1);
+    BOOST_REQUIRE(instance.get(1, out));
+    BOOST_REQUIRE(out == record2);
+    BOOST_REQUIRE_EQUAL(out.height, 7u);
+    BOOST_REQUIRE_EQUAL(out.tx_fk, 0x2au);
+}
+
+BOOST_AUTO_TEST_CASE(activity__put__same_key__latest_first)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::activity instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(key1, record1));
+    BOOST_REQUIRE(instance.put(key1, record2));
+    BOOST_REQUIRE_EQUAL(instance.first(key1), 1u);
+
+    table::activity::record out{};
+    auto it = instance.it(key1);
+    BOOST_REQUIRE(instance.get(it.get(), out));
+    BOOST_REQUIRE(out == record2);
+    BOOST_REQUIRE(it.advance());
+    BOOST_REQUIRE(instance.get(it.get(), out));
+    BOOST_REQUIRE(out == record1);
+    BOOST_REQUIRE(!it.advance());
+}
+
+BOOST_AUTO_TEST_SUITE_END()
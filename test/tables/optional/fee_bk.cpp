@@ -0,0 +1,112 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(fee_bk_tests)
+
+using namespace system;
+const table::fee_bk::record record1
+{
+    {},
+    fee_histogram::from_rates({ { 50, 50'000 }, { 100, 100 }, { 200, 1'000 } })
+};
+const auto expected_head = base16_chunk
+(
+    "000000"
+    "ffffff"
+    "000000"
+    "ffffff"
+    "ffffff"
+    "ffffff"
+    "ffffff"
+    "ffffff"
+    "ffffff"
+);
+const auto closed_head = base16_chunk
+(
+    "010000"
+    "ffffff"
+    "000000"
+    "ffffff"
+    "ffffff"
+    "ffffff"
+    "ffffff"
+    "ffffff"
+    "ffffff"
+);
+const auto expected_body = base16_chunk
+(
+    "000000" "640000" "000000" "000000" // weights[0..3]
+    "000000" "c80000" "000000" "000000" // weights[4..7]
+    "000000" "000000" "000000" "000000" // weights[8..11]
+    "000000" "000000" "000000" "320000" // weights[12..15]
+    "e8030000"                          // minimum
+    "88130000"                          // median
+    "40420f00"                          // maximum
+);
+
+BOOST_AUTO_TEST_CASE(fee_bk__put__one__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::fee_bk instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+
+    BOOST_REQUIRE(instance.put(1, record1));
+    BOOST_REQUIRE_EQUAL(instance.at(1), 0u);
+    BOOST_REQUIRE(instance.at(0).is_terminal());
+
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+    BOOST_REQUIRE(instance.close());
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), closed_head);
+}
+
+BOOST_AUTO_TEST_CASE(fee_bk__at__one__expected)
+{
+    auto head = expected_head;
+    auto body = expected_body;
+    test::chunk_storage head_store{ head };
+    test::chunk_storage body_store{ body };
+    table::fee_bk instance{ head_store, body_store, 8 };
+
+    table::fee_bk::record out{};
+    BOOST_REQUIRE(!instance.at(0, out));
+    BOOST_REQUIRE(instance.at(1, out));
+    BOOST_REQUIRE(out == record1);
+}
+
+BOOST_AUTO_TEST_CASE(fee_bk__put__excess_weight__saturated)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::fee_bk instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+
+    table::fee_bk::record record{};
+    record.histogram.weights.front() = 0x01000000;
+    BOOST_REQUIRE(instance.put(0, record));
+
+    table::fee_bk::record out{};
+    BOOST_REQUIRE(instance.at(0, out));
+    BOOST_REQUIRE_EQUAL(out.histogram.weights.front(), 0x00ffffffu);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,161 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(summary_tests)
+
+using namespace system;
+const table::summary::key key1 = base16_array("100000000000000000000000000000000000000000000000000000000000000a");
+const table::summary::key key2 = base16_array("200000000000000000000000000000000000000000000000000000000000000b");
+const address_status status1{ { 1, 2, 3, 4, 5, 6, 7, 8 }, { 0x42 }, 0x2a };
+const table::summary::record record1{ {}, { 0x0102030405060708, 0x0a0b0c0d, 0x01020304, 0x123456, status1 }, 0x0a0b0c };
+const table::summary::record record2{ {}, { 0x2a, 1, 0, 7, {} }, 5 };
+const auto expected_head = base16_chunk
+(
+    "0000000000"
+    "0100000000"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+);
+const auto closed_head = base16_chunk
+(
+    "0200000000"
+    "0100000000"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+    "ffffffffff"
+);
+const auto expected_body = base16_chunk
+(
+    "ffffffffff" // next->end
+    "100000000000000000000000000000000000000000000000000000000000000a" // key1
+    "0807060504030201" // balance1
+    "0d0c0b0a"         // funded1
+    "04030201"         // spent1
+    "563412"           // height1
+    "0c0b0a"           // header1
+    "0100000002000000030000000400000005000000060000000700000008000000" // state1
+    "42000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" // buffer1
+    "2a00000000000000" // size1
+
+    "0000000000" // next->0
+    "200000000000000000000000000000000000000000000000000000000000000b" // key2
+    "2a00000000000000" // balance2
+    "01000000"         // funded2
+    "00000000"         // spent2
+    "070000"           // height2
+    "050000"           // header2
+    "67e6096a85ae67bb72f36e3c3af54fa57f520e518c68059babd9831f19cde05b" // state2
+    "00000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000000" // buffer2
+    "0000000000000000" // size2
+);
+
+BOOST_AUTO_TEST_CASE(summary__put__two__expected)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::summary instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+
+    table::summary::link link1{};
+    BOOST_REQUIRE(instance.put_link(link1, key1, record1));
+    BOOST_REQUIRE_EQUAL(link1, 0u);
+
+    table::summary::link link2{};
+    BOOST_REQUIRE(instance.put_link(link2, key2, record2));
+    BOOST_REQUIRE_EQUAL(link2, 1u);
+
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+    BOOST_REQUIRE(instance.close());
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), closed_head);
+}
+
+BOOST_AUTO_TEST_CASE(summary__get__two__expected)
+{
+    auto head = expected_head;
+    auto body = expected_body;
+    test::chunk_storage head_store{ head };
+    test::chunk_storage body_store{ body };
+    table::summary instance{ head_store, body_store, 8 };
+
+    table::summary::record out{};
+    BOOST_REQUIRE(instance.get(0, out));
+    BOOST_REQUIRE(out == record1);
+    BOOST_REQUIRE(instance.get(1, out));
+    BOOST_REQUIRE(out == record2);
+    BOOST_REQUIRE_EQUAL(out.summary.height, 7u);
+    BOOST_REQUIRE_EQUAL(out.header_fk, 5u);
+}
+
+BOOST_AUTO_TEST_CASE(summary__put__superseded__latest_first)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::summary instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+    BOOST_REQUIRE(instance.put(key1, record1));
+    BOOST_REQUIRE(instance.put(key1, record2));
+    BOOST_REQUIRE_EQUAL(instance.first(key1), 1u);
+
+    table::summary::record out{};
+    auto it = instance.it(key1);
+    BOOST_REQUIRE(instance.get(it.get(), out));
+    BOOST_REQUIRE(out == record2);
+    BOOST_REQUIRE(it.advance());
+    BOOST_REQUIRE(instance.get(it.get(), out));
+    BOOST_REQUIRE(out == record1);
+    BOOST_REQUIRE(!it.advance());
+}
+
+BOOST_AUTO_TEST_CASE(summary__get__extended_status__midstate_restored)
+{
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::summary instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+
+    // Preimage of three entries spans two blocks and a partial tail.
+    table::summary::record record{};
+    record.summary.status.write(null_hash, 1);
+    record.summary.status.write(null_hash, 2);
+    BOOST_REQUIRE(instance.put(key1, record));
+
+    table::summary::record out{};
+    BOOST_REQUIRE(instance.get(instance.first(key1), out));
+    BOOST_REQUIRE(out == record);
+
+    out.summary.status.write(null_hash, 3);
+    const std::string entry{ encode_hash(null_hash) };
+    const auto preimage = entry + ":1:" + entry + ":2:" + entry + ":3:";
+    BOOST_REQUIRE_EQUAL(out.summary.status.finalize(),
+        sha256_hash(data_chunk(preimage.begin(), preimage.end())));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,95 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../../test.hpp"
+#include "../../mocks/chunk_storage.hpp"
+
+BOOST_AUTO_TEST_SUITE(touched_tests)
+
+using namespace system;
+const hash_digest key1 = base16_array("0100000000000000000000000000000000000000000000000000000000000000");
+const hash_digest key2 = base16_array("0200000000000000000000000000000000000000000000000000000000000000");
+
+BOOST_AUTO_TEST_CASE(touched__put__three__expected)
+{
+    const auto expected_head = base16_chunk
+    (
+        "0000000000"
+        "0000000000"
+        "0100000000"
+        "4200000000"
+        "ffffffffff"
+        "ffffffffff"
+        "ffffffffff"
+        "ffffffffff"
+        "ffffffffff"
+    );
+    const auto closed_head = base16_chunk
+    (
+        "6300000000"
+        "0000000000"
+        "0100000000"
+        "4200000000"
+        "ffffffffff"
+        "ffffffffff"
+        "ffffffffff"
+        "ffffffffff"
+        "ffffffffff"
+    );
+    const auto expected_body = base16_chunk
+    (
+        "00"
+        "02""0100000000000000000000000000000000000000000000000000000000000000"
+            "0200000000000000000000000000000000000000000000000000000000000000"
+        "01""0200000000000000000000000000000000000000000000000000000000000000"
+    );
+
+    const hashes none{};
+    const hashes both{ key1, key2 };
+    const hashes single{ key2 };
+    const table::touched::put_ref put0{ {}, none };
+    const table::touched::put_ref put1{ {}, both };
+    const table::touched::put_ref put2{ {}, single };
+
+    test::chunk_storage head_store{};
+    test::chunk_storage body_store{};
+    table::touched instance{ head_store, body_store, 8 };
+    BOOST_REQUIRE(instance.create());
+
+    BOOST_REQUIRE(instance.put(0, put0));
+    BOOST_REQUIRE(instance.put(1, put1));
+    BOOST_REQUIRE(instance.put(2, put2));
+
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), expected_head);
+    BOOST_REQUIRE_EQUAL(body_store.buffer(), expected_body);
+    BOOST_REQUIRE(instance.close());
+    BOOST_REQUIRE_EQUAL(head_store.buffer(), closed_head);
+
+    table::touched::get_keys get0{};
+    table::touched::get_keys get1{};
+    table::touched::get_keys get2{};
+    BOOST_REQUIRE(instance.at(0, get0));
+    BOOST_REQUIRE(instance.at(1, get1));
+    BOOST_REQUIRE(instance.at(2, get2));
+    BOOST_REQUIRE(get0.keys.empty());
+    BOOST_REQUIRE(get1.keys == both);
+    BOOST_REQUIRE(get2.keys == single);
+    BOOST_REQUIRE(!instance.exists(3));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -0,0 +1,87 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(address_summary_tests)
+
+using namespace system;
+const auto tx1 = base16_hash("0000000000000000000000000000000000000000000000000000000000000001");
+const auto tx2 = base16_hash("00000000000000000000000000000000000000000000000000000000000000ff");
+
+static hash_digest to_status(const std::string& preimage) NOEXCEPT
+{
+    return sha256_hash(data_chunk(preimage.begin(), preimage.end()));
+}
+
+BOOST_AUTO_TEST_CASE(address_status__finalize__default__null_hash)
+{
+    const address_status instance{};
+    BOOST_REQUIRE_EQUAL(instance.finalize(), null_hash);
+}
+
+BOOST_AUTO_TEST_CASE(address_status__write__confirmed__electrum_preimage)
+{
+    address_status instance{};
+    instance.write(tx1, 42);
+    BOOST_REQUIRE_EQUAL(instance.size, 68u);
+    BOOST_REQUIRE_EQUAL(instance.finalize(), to_status(encode_hash(tx1) + ":42:"));
+}
+
+BOOST_AUTO_TEST_CASE(address_status__write__unconfirmed__electrum_preimage)
+{
+    address_status instance{};
+    instance.write(tx1, 7);
+    instance.write(tx2, history::rooted_height);
+    instance.write(tx1, history::unrooted_height);
+    BOOST_REQUIRE_EQUAL(instance.finalize(), to_status(
+        encode_hash(tx1) + ":7:" +
+        encode_hash(tx2) + ":0:" +
+        encode_hash(tx1) + ":-1:"));
+}
+
+BOOST_AUTO_TEST_CASE(address_status__finalize__all_tail_sizes__expected)
+{
+    // Each write advances the tail by 67 + digits, covering every tail size
+    // and both single and double block padding.
+    address_status instance{};
+    std::string preimage{};
+    for (size_t height{}; height < 200; ++height)
+    {
+        instance.write(tx2, height);
+        preimage += encode_hash(tx2) + ":" + std::to_string(height) + ":";
+        BOOST_REQUIRE_EQUAL(instance.size, preimage.size());
+        BOOST_REQUIRE_EQUAL(instance.finalize(), to_status(preimage));
+    }
+}
+
+BOOST_AUTO_TEST_CASE(address_status__finalize__extended__midstate_retained)
+{
+    address_status instance{};
+    instance.write(tx1, 1);
+    const auto copy = instance;
+    BOOST_REQUIRE_EQUAL(instance.finalize(), copy.finalize());
+    BOOST_REQUIRE(instance == copy);
+
+    instance.write(tx2, 2);
+    BOOST_REQUIRE_EQUAL(instance.finalize(), to_status(
+        encode_hash(tx1) + ":1:" +
+        encode_hash(tx2) + ":2:"));
+}
+
+BOOST_AUTO_TEST_SUITE_END()
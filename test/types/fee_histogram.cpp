@@ -0,0 +1,83 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(fee_histogram_tests)
+
+using namespace system;
+
+BOOST_AUTO_TEST_CASE(fee_histogram__to_rate__zero_bytes__max_uint32)
+{
+    BOOST_REQUIRE_EQUAL(fee_histogram::to_rate({ 0, 42 }), max_uint32);
+}
+
+BOOST_AUTO_TEST_CASE(fee_histogram__to_rate__non_zero_bytes__per_kilobyte)
+{
+    BOOST_REQUIRE_EQUAL(fee_histogram::to_rate({ 100, 100 }), 1'000u);
+    BOOST_REQUIRE_EQUAL(fee_histogram::to_rate({ 107, 0xb0 }), 1'644u);
+    BOOST_REQUIRE_EQUAL(fee_histogram::to_rate({ 63, 1 }), 15u);
+}
+
+BOOST_AUTO_TEST_CASE(fee_histogram__to_rate__overflow__saturated)
+{
+    BOOST_REQUIRE_EQUAL(fee_histogram::to_rate({ 1, max_uint32 }), max_uint32);
+}
+
+BOOST_AUTO_TEST_CASE(fee_histogram__from_rates__empty__default)
+{
+    BOOST_REQUIRE(fee_histogram::from_rates({}) == fee_histogram{});
+}
+
+BOOST_AUTO_TEST_CASE(fee_histogram__from_rates__disordered__expected)
+{
+    const fee_rates rates
+    {
+        { 50, 50'000 },
+        { 100, 100 },
+        { 200, 1'000 }
+    };
+
+    const auto instance = fee_histogram::from_rates(rates);
+    BOOST_REQUIRE_EQUAL(instance.minimum, 1'000u);
+    BOOST_REQUIRE_EQUAL(instance.median, 5'000u);
+    BOOST_REQUIRE_EQUAL(instance.maximum, 1'000'000u);
+
+    std::array<uint32_t, fee_histogram::buckets> expected{};
+    expected.at(1) = 100;
+    expected.at(5) = 200;
+    expected.at(15) = 50;
+    BOOST_REQUIRE(instance.weights == expected);
+}
+
+BOOST_AUTO_TEST_CASE(fee_histogram__from_rates__same_bucket__accumulated)
+{
+    const fee_rates rates
+    {
+        { 100, 10 },
+        { 300, 20 }
+    };
+
+    const auto instance = fee_histogram::from_rates(rates);
+    BOOST_REQUIRE_EQUAL(instance.minimum, 66u);
+    BOOST_REQUIRE_EQUAL(instance.median, 66u);
+    BOOST_REQUIRE_EQUAL(instance.maximum, 100u);
+    BOOST_REQUIRE_EQUAL(instance.weights.front(), 400u);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
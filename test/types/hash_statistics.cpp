@@ -0,0 +1,45 @@
+/**
+ * Copyright (c) 2011-2026 libbitcoin developers (see AUTHORS)
+ *
+ * This file is part of libbitcoin.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Affero General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Affero General Public License for more details.
+ *
+ * You should have received a copy of the GNU Affero General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+#include "../test.hpp"
+
+BOOST_AUTO_TEST_SUITE(hash_statistics_tests)
+
+BOOST_AUTO_TEST_CASE(hash_statistics__rates__default__zero)
+{
+    const hash_statistics instance{};
+    BOOST_REQUIRE_EQUAL(instance.load_factor(), 0.0);
+    BOOST_REQUIRE_EQUAL(instance.average_probes(), 0.0);
+    BOOST_REQUIRE_EQUAL(instance.filter_hit_rate(), 0.0);
+}
+
+BOOST_AUTO_TEST_CASE(hash_statistics__rates__populated__expected)
+{
+    hash_statistics instance{};
+    instance.buckets = 4;
+    instance.elements = 6;
+    instance.lookups = 4;
+    instance.probes = 10;
+    instance.filter_hits = 3;
+    instance.filter_misses = 1;
+    BOOST_REQUIRE_EQUAL(instance.load_factor(), 1.5);
+    BOOST_REQUIRE_EQUAL(instance.average_probes(), 2.5);
+    BOOST_REQUIRE_EQUAL(instance.filter_hit_rate(), 0.75);
+}
+
+BOOST_AUTO_TEST_SUITE_END()